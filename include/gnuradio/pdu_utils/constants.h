@@ -22,7 +22,7 @@ enum pack_unpack_mode { MODE_UNPACK_BYTE = 0, MODE_PACK_BYTE = 1, MODE_BITSWAP_B
 enum input_type {
     INPUTTYPE_UNPACKED_BYTE = 0,
     INPUTTYPE_PACKED_BYTE = 1,
-    INPUTTYPE_FLOAT = 1
+    INPUTTYPE_FLOAT = 2
 };
 enum early_burst_behavior {
     EARLY_BURST_BEHAVIOR__APPEND = 0,
@@ -86,6 +86,16 @@ PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__system();
 PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__phase_inc();
 PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__bit_reversed();
 PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__bit_index();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__symbol_rate_min();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__symbol_rate_max();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__demod();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__filtered();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__realization();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__center_frequency();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__channel();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__delay();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__time_in();
+PDU_UTILS_API const pmt::pmt_t PMTCONSTSTR__time_out();
 
 
 enum message_trigger_mode : uint64_t { TX_UNLIMITED = 0xFFFFFFFFFFFFFFFF, TX_OFF = 0 };
@@ -95,6 +105,19 @@ enum noise_dist { UNIFORM = 0, GAUSSIAN = 1 };
 
 enum window_type { TUKEY_WIN = 0, GAUSSIAN_WIN = 1 }; // end enum window_type
 
+// pdu logger file sync policies
+enum fsync_policy { FSYNC_NEVER = 0, FSYNC_ON_CLOSE = 1, FSYNC_EVERY_PDU = 2 };
+
+// pdu log source pacing modes
+enum replay_mode { REPLAY_RATE = 0, REPLAY_ASAP = 1, REPLAY_TIMESTAMP = 2 };
+
+// pdu round robin output selection
+enum dispatch_mode {
+    DISPATCH_ROUND_ROBIN = 0,
+    DISPATCH_LEAST_LOADED = 1,
+    DISPATCH_SIZE_WEIGHTED = 2
+};
+
 //! pdu align modes
 enum align_modes {
     //! do not emit a packet if sync word is not found
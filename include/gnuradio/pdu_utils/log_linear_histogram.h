@@ -0,0 +1,155 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_LOG_LINEAR_HISTOGRAM_H
+#define INCLUDED_PDU_UTILS_LOG_LINEAR_HISTOGRAM_H
+
+#include <pmt/pmt.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Fixed size histogram of unsigned values with log-linear buckets
+ *
+ * Each power of two range is split into 2^sub_bits equal buckets, so the relative
+ * bucket width is bounded (25% for the default of 2 sub bits) over the full 64 bit
+ * range while the histogram stays a few hundred counters. Values below 2^sub_bits
+ * have a bucket each. Recording is a handful of integer operations and never
+ * allocates.
+ *
+ * Not thread safe.
+ */
+class log_linear_histogram
+{
+public:
+    log_linear_histogram(unsigned sub_bits = 2)
+        : d_sub_bits(std::min(sub_bits, 8u)),
+          d_counts((64 - d_sub_bits + 1) << d_sub_bits, 0),
+          d_count(0),
+          d_max(0)
+    {
+    }
+
+    void record(uint64_t value)
+    {
+        d_counts[bucket(value)]++;
+        d_count++;
+        d_max = std::max(d_max, value);
+    }
+
+    void reset()
+    {
+        std::fill(d_counts.begin(), d_counts.end(), 0);
+        d_count = 0;
+        d_max = 0;
+    }
+
+    uint64_t count() const { return d_count; }
+    uint64_t max() const { return d_max; }
+
+    /**
+     * Upper bound of the bucket holding the p quantile, p in [0, 1]
+     */
+    uint64_t percentile(double p) const
+    {
+        if (d_count == 0) {
+            return 0;
+        }
+        uint64_t target = std::max<uint64_t>(1, (uint64_t)(p * d_count + 0.5));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < d_counts.size(); b++) {
+            seen += d_counts[b];
+            if (seen >= target) {
+                return std::min(bucket_upper(b), d_max);
+            }
+        }
+        return d_max;
+    }
+
+    /**
+     * Dictionary with the count, max, p50, p90 and p99 and the non-empty buckets as
+     * parallel 'lower' (inclusive lower bound) and 'counts' u64vectors
+     */
+    pmt::pmt_t to_pmt() const
+    {
+        std::vector<uint64_t> lower;
+        std::vector<uint64_t> counts;
+        for (size_t b = 0; b < d_counts.size(); b++) {
+            if (d_counts[b]) {
+                lower.push_back(bucket_lower(b));
+                counts.push_back(d_counts[b]);
+            }
+        }
+        pmt::pmt_t dict = pmt::make_dict();
+        dict = pmt::dict_add(dict, pmt::mp("count"), pmt::from_uint64(d_count));
+        dict = pmt::dict_add(dict, pmt::mp("max"), pmt::from_uint64(d_max));
+        dict = pmt::dict_add(dict, pmt::mp("p50"), pmt::from_uint64(percentile(0.5)));
+        dict = pmt::dict_add(dict, pmt::mp("p90"), pmt::from_uint64(percentile(0.9)));
+        dict = pmt::dict_add(dict, pmt::mp("p99"), pmt::from_uint64(percentile(0.99)));
+        dict = pmt::dict_add(
+            dict, pmt::mp("lower"), pmt::init_u64vector(lower.size(), lower));
+        dict = pmt::dict_add(
+            dict, pmt::mp("counts"), pmt::init_u64vector(counts.size(), counts));
+        return dict;
+    }
+
+private:
+    unsigned d_sub_bits;
+    std::vector<uint64_t> d_counts;
+    uint64_t d_count;
+    uint64_t d_max;
+
+    static unsigned log2_floor(uint64_t v)
+    {
+        unsigned e = 0;
+        while (v >>= 1) {
+            e++;
+        }
+        return e;
+    }
+
+    size_t bucket(uint64_t v) const
+    {
+        const uint64_t n_sub = 1ULL << d_sub_bits;
+        if (v < n_sub) {
+            return v;
+        }
+        unsigned e = log2_floor(v);
+        uint64_t sub = (v >> (e - d_sub_bits)) & (n_sub - 1);
+        return ((e - d_sub_bits + 1) << d_sub_bits) + sub;
+    }
+
+    uint64_t bucket_lower(size_t b) const
+    {
+        const uint64_t n_sub = 1ULL << d_sub_bits;
+        if (b < n_sub) {
+            return b;
+        }
+        unsigned e = (b >> d_sub_bits) + d_sub_bits - 1;
+        return (n_sub + (b & (n_sub - 1))) << (e - d_sub_bits);
+    }
+
+    uint64_t bucket_upper(size_t b) const
+    {
+        if (b + 1 >= d_counts.size()) {
+            return UINT64_MAX;
+        }
+        return bucket_lower(b + 1) - 1;
+    }
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_LOG_LINEAR_HISTOGRAM_H */
@@ -32,6 +32,16 @@ namespace pdu_utils {
  *
  * U8 noise is binary.
  *
+ * Noise for a whole PDU is generated into a buffer before it is applied. By default the
+ * gr::random generator is used, which reproduces the sequence of previous versions of
+ * this block for a given seed. If fast RNG is set, a vectorized xoshiro128+ generator
+ * with block Box-Muller gaussians is used instead; output is still reproducible for a
+ * given seed, but differs from the gr::random sequence.
+ *
+ * Realizations - number of independently noised copies of each input PDU to emit.
+ * If greater than one, each output carries its index (from 0) in the realization
+ * metadata key.
+ *
  */
 class PDU_UTILS_API pdu_add_noise : virtual public gr::block
 {
@@ -47,9 +57,16 @@ public:
      * @param scale - signal scaling
      * @param seed - RNG seed
      * @param dist - noise distribution from enum #noise_dist
+     * @param realizations - number of noisy copies of each PDU to emit
+     * @param fast_rng - use the vectorized generator instead of gr::random
      */
-    static sptr make(
-        float noise_level, float offset, float scale, long seed = 12345678, int dist = 0);
+    static sptr make(float noise_level,
+                     float offset,
+                     float scale,
+                     long seed = 12345678,
+                     int dist = 0,
+                     int realizations = 1,
+                     bool fast_rng = false);
 
     /**
      * Set Noise Level
@@ -85,6 +102,20 @@ public:
      * @param x - seed
      */
     virtual void set_seed(int x) = 0;
+
+    /**
+     * Set number of realizations emitted per input PDU
+     *
+     * @param n - realizations, at least 1
+     */
+    virtual void set_realizations(int n) = 0;
+
+    /**
+     * Select the vectorized generator
+     *
+     * @param fast - true to use the vectorized generator
+     */
+    virtual void set_fast_rng(bool fast) = 0;
 };
 
 } // namespace pdu_utils
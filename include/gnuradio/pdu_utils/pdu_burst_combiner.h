@@ -24,7 +24,21 @@ namespace pdu_utils {
  *
  * Only operates on PDUs with c32vector data
  *
- * Uses burst_index meta data
+ * Uses burst_index meta data, a (index, count) pair with index starting at 1. The
+ * output PDU carries the metadata of the fragment with index 1.
+ *
+ * Several bursts may be reassembled at once; fragments are grouped by the value of
+ * the burst_id metadata key (fragments without one share a single group). Fragments
+ * are held by reference and copied once into the output when the last fragment of a
+ * burst arrives, in any order. A fragment whose index has already been received for
+ * its burst id discards the partial burst and starts a new one.
+ *
+ * Timeout - partial bursts that have not received a fragment for this many seconds
+ * are dropped, 0 to disable. This is checked while the flowgraph is running whether
+ * or not more fragments arrive, and any partial bursts left when it stops are dropped.
+ *
+ * Max Samples - limit on samples held in partial bursts; the oldest partial bursts are
+ * dropped to stay under it, 0 to disable
  */
 class PDU_UTILS_API pdu_burst_combiner : virtual public gr::block
 {
@@ -38,8 +52,30 @@ public:
      * constructor is in a private implementation
      * class. pdu_utils::pdu_burst_combiner::make is the public interface for
      * creating new instances.
+     *
+     * @param timeout - partial burst timeout in seconds, 0 to disable
+     * @param max_samples - maximum number of buffered samples, 0 to disable
+     */
+    static sptr make(double timeout = 0, uint64_t max_samples = 0);
+
+    /**
+     * Set partial burst timeout
+     *
+     * @param timeout - seconds, 0 to disable
+     */
+    virtual void set_timeout(double timeout) = 0;
+
+    /**
+     * Set limit on buffered samples
+     *
+     * @param max_samples - 0 to disable
+     */
+    virtual void set_max_samples(uint64_t max_samples) = 0;
+
+    /**
+     * Number of partial bursts dropped so far
      */
-    static sptr make();
+    virtual uint64_t get_n_dropped() = 0;
 };
 
 } // namespace pdu_utils
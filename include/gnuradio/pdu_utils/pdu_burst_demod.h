@@ -0,0 +1,114 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_H
+#define INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_H
+
+#include "constants.h"
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Fused FSK burst demodulator
+ * \ingroup pdu_utils
+ *
+ * Performs the equivalent of PDU Quadrature Demod -> PDU FIR Filter -> PDU Clock
+ * Recovery in a single handler. The intermediate waveforms are kept in scratch buffers
+ * owned by the block and reused between bursts, so only the final symbols are
+ * allocated as a PMT and no intermediate PDUs are passed between blocks.
+ *
+ * Input: c32vector PDU with a sample_rate metadata key
+ *
+ * Output: f32vector PDU of soft symbols, or u8vector PDU of hard symbols if binary
+ * slice is set
+ *
+ * Meta Data: Removes sample rate, Inserts symbol rate. The start_time is adjusted
+ * for the half sample offset of an even length filter in the same way as the PDU FIR
+ * Filter block.
+ *
+ * The symbol rate search band may be restricted with the min_symbol_rate and
+ * max_symbol_rate parameters or per-PDU with the symbol_rate_min and symbol_rate_max
+ * metadata keys, as for PDU Clock Recovery.
+ *
+ * If debug is set the demodulated and filtered waveforms are published as PDUs on the
+ * demod and filtered ports, and the clock recovery intermediate results on the debug,
+ * zeroX and window ports.
+ */
+class PDU_UTILS_API pdu_burst_demod : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_burst_demod> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_burst_demod.
+     *
+     * @param sensitivity - quadrature demodulator gain
+     * @param taps - post demodulation filter taps, empty for no filtering
+     * @param decimation - post demodulation filter decimation
+     * @param remove_dc - subtract the mean of the demodulated burst
+     * @param binary_slice - true to slice symbols and produce a u8vector
+     * @param debug - true to enable debug ports & logging
+     * @param type - clock recovery window type
+     * @param min_symbol_rate - lower bound of symbol rate search band, 0 to disable
+     * @param max_symbol_rate - upper bound of symbol rate search band, 0 to disable
+     */
+    static sptr make(float sensitivity,
+                     const std::vector<float> taps,
+                     int decimation = 1,
+                     bool remove_dc = false,
+                     bool binary_slice = true,
+                     bool debug = false,
+                     window_type type = TUKEY_WIN,
+                     float min_symbol_rate = 0,
+                     float max_symbol_rate = 0);
+
+    /**
+     * Set quadrature demodulator sensitivity
+     *
+     * @param sensitivity -
+     */
+    virtual void set_sensitivity(float sensitivity) = 0;
+
+    /**
+     * Set DC removal
+     *
+     * @param remove_dc -
+     */
+    virtual void set_remove_dc(bool remove_dc) = 0;
+
+    /**
+     * Set filter taps
+     *
+     * @param taps - filter taps, empty for no filtering
+     */
+    virtual void set_taps(std::vector<float> taps) = 0;
+
+    /**
+     * Set filter decimation
+     *
+     * @param decimation -
+     */
+    virtual void set_decimation(int decimation) = 0;
+
+    /**
+     * Specify the expected symbol rate range.
+     *
+     * @param min_symbol_rate - lower bound of symbol rate search band
+     * @param max_symbol_rate - upper bound of symbol rate search band
+     */
+    virtual void set_symbol_rate_range(float min_symbol_rate, float max_symbol_rate) = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_H */
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_CHANNELIZER_H
+#define INCLUDED_PDU_UTILS_PDU_CHANNELIZER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief PDU Channelizer
+ * \ingroup pdu_utils
+ *
+ * Extracts several narrowband channels from one wideband PDU. For each center
+ * frequency offset one PDU is produced that is equivalent to the output of a PDU Freq
+ * Xlating FIR Filter tuned to that offset. The input is copied once into a padded
+ * scratch buffer shared by every channel, and each channel only computes its
+ * decimated outputs with taps rotated to its offset, so no full rate intermediate is
+ * created per channel. Channel offsets need not be uniformly spaced.
+ *
+ * Input may be float or complex and must carry a sample_rate metadata key, output is
+ * always complex. Output PDUs are published in channel order on pdu_out. Each carries
+ * the input metadata with sample_rate divided by the decimation, start_time
+ * compensated for even length filters, the channel index in the channel key, and
+ * center_frequency set to the input center_frequency (0 if absent) plus the channel
+ * offset.
+ *
+ */
+class PDU_UTILS_API pdu_channelizer : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_channelizer> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_channelizer.
+     *
+     * Throws std::invalid_argument if decimation is less than 1.
+     *
+     * @param decimation - decimation factor to apply
+     * @param taps - FIR taps (lowpass prototype)
+     * @param center_freqs - channel center frequency offsets, Hz
+     */
+    static sptr make(int decimation,
+                     const std::vector<float> taps,
+                     const std::vector<double> center_freqs);
+
+    /**
+     * Set FIR taps
+     *
+     * @param taps - FIR taps (lowpass prototype)
+     */
+    virtual void set_taps(std::vector<float> taps) = 0;
+
+    /**
+     * Set Decimation factor, values below 1 are rejected and the previous factor is
+     * kept
+     *
+     * @param decimation - decimation factor
+     */
+    virtual void set_decimation(int decimation) = 0;
+
+    /**
+     * Set channel center frequency offsets
+     *
+     * @param center_freqs - Hz
+     */
+    virtual void set_center_freqs(std::vector<double> center_freqs) = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_CHANNELIZER_H */
@@ -39,6 +39,14 @@ namespace pdu_utils {
  *
  * Debug port window = windowed version of zeroX
  *
+ * Symbol Rate Hint: if a symbol rate range is specified (either with the
+ * min_symbol_rate/max_symbol_rate parameters or per-PDU with the symbol_rate_min
+ * and symbol_rate_max metadata keys), the full band FFT is skipped. The spectrum of
+ * the zero crossing waveform is instead evaluated directly from the crossing
+ * locations at FFT bin spacing over the hinted band only, and the peak is then
+ * refined with a zoomed evaluation around the coarse maximum. The debug port will
+ * contain the coarse band magnitudes in this mode.
+ *
  */
 class PDU_UTILS_API pdu_clock_recovery : virtual public gr::block
 {
@@ -51,8 +59,14 @@ public:
      * @param binary_slice - true if binary slicing to produce a u8vector
      * @param debug - true to enable debug ports & logging
      * @param type - window type to use.
+     * @param min_symbol_rate - lower bound of symbol rate search band, 0 to disable
+     * @param max_symbol_rate - upper bound of symbol rate search band, 0 to disable
      */
-    static sptr make(bool binary_slice, bool debug = false, window_type type = TUKEY_WIN);
+    static sptr make(bool binary_slice,
+                     bool debug = false,
+                     window_type type = TUKEY_WIN,
+                     float min_symbol_rate = 0,
+                     float max_symbol_rate = 0);
 
     /**
      * Specify what window type to use.
@@ -77,6 +91,16 @@ public:
      * @param dc_reject - DC rejection
      */
     virtual void set_dc_reject(float dc_reject) = 0;
+
+    /**
+     * Specify the expected symbol rate range. If both values are positive and
+     * min_symbol_rate < max_symbol_rate the symbol rate search is restricted to that
+     * band, otherwise the full band search is used.
+     *
+     * @param min_symbol_rate - lower bound of symbol rate search band
+     * @param max_symbol_rate - upper bound of symbol rate search band
+     */
+    virtual void set_symbol_rate_range(float min_symbol_rate, float max_symbol_rate) = 0;
 };
 
 } // namespace pdu_utils
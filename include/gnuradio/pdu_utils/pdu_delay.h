@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_DELAY_H
+#define INCLUDED_PDU_UTILS_PDU_DELAY_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Delays each PDU by a fixed or per-PDU amount of time
+ * \ingroup pdu_utils
+ *
+ * Each PDU is released the given number of seconds after it was received. If the
+ * metadata dictionary has a non-negative 'delay' value, that is used instead of the
+ * default delay. Pending PDUs are kept in a single queue ordered by release time and
+ * released by one timer thread, so PDUs leave in release time order (in arrival
+ * order when the release times are equal). PDUs still pending when the flowgraph
+ * stops are discarded.
+ *
+ * In debug mode the wall clock time the PDU was received and released are added to
+ * the metadata as 'time_in' and 'time_out'.
+ */
+class PDU_UTILS_API pdu_delay : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_delay> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_delay.
+     *
+     * @param delay - default delay in seconds, must be non-negative
+     * @param debug - add 'time_in' and 'time_out' to the metadata
+     */
+    static sptr make(double delay, bool debug = false);
+
+    /**
+     * Set the default delay, throws if negative
+     *
+     * @param delay - seconds
+     */
+    virtual void set_delay(double delay) = 0;
+    virtual double get_delay() = 0;
+
+    /**
+     * Enable or disable debug mode
+     *
+     * @param debug - add 'time_in' and 'time_out' to the metadata
+     */
+    virtual void set_debug(bool debug) = 0;
+    virtual bool get_debug() = 0;
+
+    /**
+     * Number of PDUs waiting to be released
+     */
+    virtual size_t get_pending() = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_DELAY_H */
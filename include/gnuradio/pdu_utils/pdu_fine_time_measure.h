@@ -33,6 +33,12 @@ namespace pdu_utils {
  * Signal/Noise calculations.  Remove this percent of points from
  * consideration. (0 - 100%)
  *
+ * Trim End - If set, the end of burst is found in the same way, searching backwards
+ * from the last sample above threshold, and samples after it are removed as well.
+ *
+ * All power sums are taken from a single prefix sum of the burst magnitude squared,
+ * so the cost of the estimate does not depend on the average width.
+ *
  */
 class PDU_UTILS_API pdu_fine_time_measure : virtual public gr::block
 {
@@ -46,11 +52,13 @@ public:
      * @param post_burst_time - Unit: sec
      * @param average_width -
      * @param buffer_percent - Range[0..100]
+     * @param trim_end - also estimate the end of burst and trim trailing samples
      */
     static sptr make(float pre_burst_time,
                      float post_burst_time,
                      size_t average_width,
-                     float buffer_percent);
+                     float buffer_percent,
+                     bool trim_end = false);
 };
 
 } // namespace pdu_utils
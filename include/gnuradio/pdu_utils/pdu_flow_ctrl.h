@@ -0,0 +1,134 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_H
+#define INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Limits the number of messages waiting at downstream blocks
+ * \ingroup pdu_utils
+ *
+ * Message passing in GNU Radio has no flow control, so a slow block lets its input
+ * queue grow without bound. This block is placed in-line, usually right after the
+ * PDU source, and checks the input queues of a set of watched blocks before passing
+ * each PDU through. If no blocks are given, the blocks connected to pdu_out are
+ * watched.
+ *
+ * When any watched queue holds max_nmsgs or more messages the PDU is either dropped
+ * or, with backpressure set, held until every watched queue has drained to
+ * low_watermark messages or fewer. Holding a PDU stalls this block's message
+ * handler, so its own input queue grows instead; a producer that watches that queue,
+ * such as pdu_log_source in REPLAY_ASAP mode, is slowed down rather than losing
+ * bursts.
+ *
+ * References to the watched blocks are held while the flowgraph runs so the queue
+ * check does not resolve them for every PDU.
+ *
+ * Every queue check also updates the depth statistics of the watched ports, and the
+ * time spent handling each PDU, including any time it was held, is recorded in a
+ * log-linear histogram. With a positive stats_interval the queues are additionally
+ * sampled on a timer and the statistics are published as a dictionary on the 'stats'
+ * port. The high-water mark and latency percentiles are exported over ControlPort.
+ */
+class PDU_UTILS_API pdu_flow_ctrl : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_flow_ctrl> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_flow_ctrl.
+     *
+     * @param blocks - blocks whose input queues are watched, empty for the blocks
+     * connected to pdu_out
+     * @param max_nmsgs - queue depth at which PDUs are dropped or held
+     * @param backpressure - hold PDUs instead of dropping them
+     * @param low_watermark - queue depth at which held PDUs are released, negative
+     * for half of max_nmsgs
+     * @param stats_interval - seconds between statistics messages, zero to disable
+     */
+    static sptr make(std::vector<gr::basic_block_sptr> blocks,
+                     int max_nmsgs,
+                     bool backpressure = false,
+                     int low_watermark = -1,
+                     double stats_interval = 0);
+
+    /**
+     * Set the queue depth at which PDUs are dropped or held
+     *
+     * @param max_nmsgs - maximum queue depth
+     */
+    virtual void set_max_nmsgs(int max_nmsgs) = 0;
+
+    /**
+     * Set the queue depth at which held PDUs are released
+     *
+     * @param low_watermark - queue depth, negative for half of max_nmsgs
+     */
+    virtual void set_low_watermark(int low_watermark) = 0;
+
+    /**
+     * Hold PDUs instead of dropping them
+     *
+     * @param backpressure - true to hold PDUs
+     */
+    virtual void set_backpressure(bool backpressure) = 0;
+
+    /**
+     * Number of PDUs dropped
+     */
+    virtual uint64_t get_dropped() = 0;
+
+    /**
+     * Number of PDUs held for backpressure
+     */
+    virtual uint64_t get_held() = 0;
+
+    /**
+     * Set the time between statistics messages
+     *
+     * @param stats_interval - seconds, zero to disable
+     */
+    virtual void set_stats_interval(double stats_interval) = 0;
+
+    /**
+     * Largest queue depth seen at any watched port
+     */
+    virtual int get_high_water() = 0;
+
+    /**
+     * Median PDU handling time in microseconds
+     */
+    virtual uint64_t get_latency_p50() = 0;
+
+    /**
+     * 99th percentile PDU handling time in microseconds
+     */
+    virtual uint64_t get_latency_p99() = 0;
+
+    /**
+     * All statistics as a dictionary, the same as published on the 'stats' port
+     */
+    virtual pmt::pmt_t get_stats() = 0;
+
+    /**
+     * Clear the high-water marks and histograms
+     */
+    virtual void reset_stats() = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_H */
@@ -12,6 +12,7 @@
 
 #include <gnuradio/basic_block.h>
 #include <gnuradio/pdu_utils/api.h>
+#include <gnuradio/pdu_utils/log_linear_histogram.h>
 
 namespace gr {
 namespace pdu_utils {
@@ -21,6 +22,10 @@ typedef std::weak_ptr<gr::basic_block> basic_block_wptr;
 /*!
  * \brief Convenience functions for watching the number of messages waiting
  * at the given blocks' inputs.
+ *
+ * Every queue read by max_nmsgs() or sample() also updates that port's statistics:
+ * the last depth seen, the high-water mark and a log-linear histogram of the sampled
+ * depths. A port whose histogram sits well above the others is the bottleneck.
  */
 class PDU_UTILS_API pdu_flow_ctrl_helper
 {
@@ -37,15 +42,67 @@ public:
      */
     virtual ~pdu_flow_ctrl_helper();
 
+    /**
+     * Watch a single input port of a block
+     *
+     * @param block - block to watch
+     * @param port - input port name
+     */
+    void add_port(gr::basic_block_sptr block, pmt::pmt_t port);
+
+    /**
+     * Hold references to the watched blocks so max_nmsgs() does not lock a weak
+     * pointer per block on every call. Blocks are held until release() is called,
+     * normally for the duration of a flowgraph run.
+     */
+    void resolve();
+
+    /**
+     * Drop the references taken by resolve()
+     */
+    void release();
+
     int max_nmsgs();
     void print_nmsgs();
 
+    /**
+     * Read every watched queue and update the statistics without returning a depth
+     */
+    void sample();
+
+    /**
+     * Largest depth seen at any watched port since the last reset_stats()
+     */
+    int max_high_water();
+
+    /**
+     * Per port statistics as a list of dictionaries with the keys 'block' (alias),
+     * 'port', 'depth', 'high_water' and 'depth_histogram'
+     */
+    pmt::pmt_t stats();
+
+    /**
+     * Clear the high-water marks and histograms
+     */
+    void reset_stats();
+
 private:
+    struct port_stats {
+        pmt::pmt_t port;
+        int depth = 0;
+        int high_water = 0;
+        log_linear_histogram depths;
+    };
+
     struct block_port {
         basic_block_wptr block;
-        std::vector<pmt::pmt_t> ports;
+        basic_block_sptr resolved;
+        std::string alias;
+        std::vector<port_stats> ports;
     };
 
+    static int read_port(basic_block* block, port_stats& ps);
+
     std::vector<block_port> d_blocks;
 };
 
@@ -0,0 +1,75 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_H
+#define INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief PDU Frequency Translating FIR filter
+ * \ingroup pdu_utils
+ *
+ * This block is equivalent to a PDU Rotate followed by a PDU FIR Filter with
+ * decimation, without producing the full rate rotated intermediate. The taps are
+ * rotated by the phase increment, only the decimated outputs are computed, and the
+ * residual rotation is applied to the decimated output. Input may be float or
+ * complex, output is always complex.
+ *
+ * As with PDU Rotate, a "phase_inc" metadata key will override the block phase
+ * increment for that PDU only. As with PDU FIR Filter, the sample_rate metadata key
+ * is updated for decimation and start_time is compensated for even length filters.
+ *
+ */
+class PDU_UTILS_API pdu_freq_xlating_fir_filter : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_freq_xlating_fir_filter> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of
+     * pdu_utils::pdu_freq_xlating_fir_filter.
+     *
+     * @param decimation - decimation factor to apply
+     * @param taps - FIR taps (lowpass prototype)
+     * @param phase_inc - phase increment in radians per input sample
+     */
+    static sptr make(int decimation, const std::vector<float> taps, double phase_inc);
+
+    /**
+     * Set FIR taps
+     *
+     * @param taps - FIR taps (lowpass prototype)
+     */
+    virtual void set_taps(std::vector<float> taps) = 0;
+
+    /**
+     * Set Decimation factor, values below 1 are rejected and the previous factor is
+     * kept
+     *
+     * @param decimation - decimation factor
+     */
+    virtual void set_decimation(int decimation) = 0;
+
+    /**
+     * Set Phase Increment
+     *
+     * @param phase_inc - Phase Increment
+     */
+    virtual void set_phase_inc(double phase_inc) = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_H */
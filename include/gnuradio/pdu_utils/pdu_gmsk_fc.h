@@ -24,6 +24,13 @@ namespace pdu_utils {
  * This block accepts a float PDU of size n containing baseband
  * data, applies GMSK modulation, then sends a gr_complex PDU of
  * size n-len(taps)+1.
+ *
+ * If samples per symbol is nonzero the input PDU instead holds one value per
+ * symbol, which is sliced to +/-1, and the output is identical to running the
+ * symbols repeated samples_per_symbol times through the per-sample modulator.
+ * In this mode the phase trajectory of each symbol is precomputed for every
+ * pattern of the neighboring symbols that the taps span, so modulation is a
+ * table lookup and a complex multiply per output sample.
  */
 class PDU_UTILS_API pdu_gmsk_fc : virtual public gr::block
 {
@@ -35,8 +42,11 @@ public:
      *
      * @param sensitivity -
      * @param taps -
+     * @param samples_per_symbol - 0 for per-sample input, else symbol input mode
      */
-    static sptr make(float sensitivity, const std::vector<float> taps);
+    static sptr make(float sensitivity,
+                     const std::vector<float> taps,
+                     int samples_per_symbol = 0);
 
     /**
      * Sets sensitivity
@@ -51,6 +61,13 @@ public:
      * @param taps -
      */
     virtual void set_taps(std::vector<float> taps) = 0;
+
+    /**
+     * Sets samples per symbol, 0 for per-sample input
+     *
+     * @param samples_per_symbol -
+     */
+    virtual void set_samples_per_symbol(int samples_per_symbol) = 0;
 };
 
 } // namespace pdu_utils
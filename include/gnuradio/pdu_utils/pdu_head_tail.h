@@ -10,6 +10,7 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_HEAD_TAIL_H
 #define INCLUDED_PDU_UTILS_PDU_HEAD_TAIL_H
 
+#include "constants.h"
 #include <gnuradio/block.h>
 #include <gnuradio/pdu_utils/api.h>
 
@@ -23,7 +24,14 @@ namespace pdu_utils {
  * Block accumulates the start and end of bursts and emits PDUs suitable for bit
  * rastering.
  *
+ * The first and last length items of each PDU are stored as one row of a history of
+ * histsize rows, and the history is published on the head and tail ports oldest row
+ * first. Unpacked byte PDUs are converted to 0/1 bits, packed byte PDUs are unpacked
+ * to 0/1 bits in the configured bit order and length counts bits, and float PDUs are
+ * kept as is.
  *
+ * The history may be published only every publish_interval updates, or in delta mode
+ * only the newest row is published on each update.
  */
 class PDU_UTILS_API pdu_head_tail : virtual public gr::block
 {
@@ -33,11 +41,17 @@ public:
     /*!
      * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_head_tail.
      *
-     * @param pdu_type -
-     * @param length -
-     * @param histsize -
+     * @param pdu_type - INPUTTYPE_UNPACKED_BYTE, INPUTTYPE_PACKED_BYTE, INPUTTYPE_FLOAT
+     * @param length - number of items (bits for packed bytes) kept from each end
+     * @param histsize - number of rows of history
+     * @param publish_interval - publish on every Nth update
+     * @param delta - publish only the newest row instead of the history
      */
-    static sptr make(uint32_t pdu_type, uint32_t length, uint32_t histsize);
+    static sptr make(uint32_t pdu_type,
+                     uint32_t length,
+                     uint32_t histsize,
+                     uint32_t publish_interval = 1,
+                     bool delta = false);
 
     /**
      * Set Length
@@ -59,6 +73,27 @@ public:
      * @param spacebytes - insert space between bytes?
      */
     virtual void set_space_bytes(bool spacebytes) = 0;
+
+    /**
+     * Set the bit order used to unpack INPUTTYPE_PACKED_BYTE PDUs
+     *
+     * @param order - BIT_ORDER_LSB_FIRST, BIT_ORDER_MSB_FIRST
+     */
+    virtual void set_bit_order(bit_order order) = 0;
+
+    /**
+     * Set publish interval
+     *
+     * @param publish_interval - publish on every Nth update
+     */
+    virtual void set_publish_interval(uint32_t publish_interval) = 0;
+
+    /**
+     * Set delta mode
+     *
+     * @param delta - publish only the newest row instead of the history
+     */
+    virtual void set_delta(bool delta) = 0;
 };
 
 } // namespace pdu_utils
@@ -0,0 +1,168 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_LOG_READER_H
+#define INCLUDED_PDU_UTILS_PDU_LOG_READER_H
+
+#include <gnuradio/pdu_utils/api.h>
+#include <pmt/pmt.h>
+
+#include <cstdint>
+#include <string>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * Data types of logged PDUs, as stored in pdu_log_record::dtype
+ */
+enum pdu_log_dtype { PDU_LOG_C32 = 0, PDU_LOG_F32 = 1, PDU_LOG_U8 = 2 };
+
+/*!
+ * Header at the start of a pdu_logger index file
+ */
+struct pdu_log_header {
+    char magic[8];        // PDU_LOG_MAGIC
+    uint32_t version;     // PDU_LOG_VERSION
+    uint32_t record_size; // sizeof(pdu_log_record)
+    uint64_t reserved[2];
+};
+
+/*!
+ * Index entry of one logged PDU. Stored in host byte order.
+ */
+struct pdu_log_record {
+    static const uint8_t HAS_PDU_NUM = 0x01;
+    static const uint8_t HAS_TIME = 0x02;
+
+    uint64_t pdu_num;     // 'pdu_num' metadata, or the position in the file if absent
+    uint64_t time_sec;    // integer seconds of 'burst_time', or of 'start_time'
+    double time_frac;     // fractional seconds of the same
+    uint64_t data_offset; // byte offset of the samples in the data file
+    uint64_t data_length; // length of the samples in bytes
+    uint64_t meta_offset; // byte offset of the serialized metadata in the meta file
+    uint32_t meta_length; // length of the serialized metadata in bytes
+    uint8_t dtype;        // pdu_log_dtype
+    uint8_t flags;        // HAS_PDU_NUM | HAS_TIME
+    uint16_t reserved;
+};
+
+static const char PDU_LOG_MAGIC[8] = { 'G', 'R', 'P', 'D', 'U', 'L', 'O', 'G' };
+static const uint32_t PDU_LOG_VERSION = 1;
+
+/*!
+ * \brief Random access reader for pdu_logger files written with index enabled
+ * \ingroup pdu_utils
+ *
+ * The data file, its index (data file name + ".idx") and its metadata file (data
+ * file name + ".meta") are memory mapped, so opening a file does not read it and
+ * sample data is accessed in place through data() without copying.
+ *
+ * find_pdu_num() and find_time() binary search the index when the key is
+ * nondecreasing across the file, as it is for PDUs from tags_to_pdu, and fall back
+ * to a linear scan otherwise. Records past the end of a truncated data or metadata
+ * file, such as after a crash, are ignored.
+ *
+ * The index may also be written by other tools to describe bursts within a raw
+ * sample file; the metadata file is optional if no record has metadata.
+ *
+ * Throws std::runtime_error if the files cannot be opened or the index is not
+ * valid.
+ */
+class PDU_UTILS_API pdu_log_reader
+{
+public:
+    /**
+     * Constructor
+     *
+     * @param filename - data file written by pdu_logger
+     */
+    pdu_log_reader(const std::string& filename);
+
+    /**
+     * Deconstructor
+     */
+    virtual ~pdu_log_reader();
+
+    pdu_log_reader(const pdu_log_reader&) = delete;
+    pdu_log_reader& operator=(const pdu_log_reader&) = delete;
+
+    /**
+     * Number of PDUs in the file
+     */
+    size_t size() const { return d_nrecords; }
+
+    /**
+     * Index entry of PDU i
+     */
+    const pdu_log_record& record(size_t i) const;
+
+    /**
+     * Pointer to the samples of PDU i in the mapped data file, valid for the lifetime
+     * of the reader. The length in bytes is record(i).data_length.
+     */
+    const void* data(size_t i) const;
+
+    /**
+     * Number of samples in PDU i
+     */
+    size_t nitems(size_t i) const;
+
+    /**
+     * Deserialized metadata dictionary of PDU i
+     */
+    pmt::pmt_t metadata(size_t i) const;
+
+    /**
+     * PDU i as a (metadata . vector) pair, copying the samples into a new vector
+     */
+    pmt::pmt_t pdu(size_t i) const;
+
+    /**
+     * Index of the first PDU with pdu_num >= the given value, size() if none
+     */
+    size_t find_pdu_num(uint64_t pdu_num) const;
+
+    /**
+     * Index of the first PDU with a time >= the given time, size() if none
+     *
+     * @param sec - integer seconds
+     * @param frac - fractional seconds
+     */
+    size_t find_time(uint64_t sec, double frac = 0) const;
+
+    /**
+     * Size in bytes of one sample of the given pdu_log_dtype
+     */
+    static size_t item_size(uint8_t dtype);
+
+private:
+    struct mapping {
+        int fd = -1;
+        const uint8_t* addr = nullptr;
+        size_t size = 0;
+    };
+
+    mapping d_data;
+    mapping d_index;
+    mapping d_meta;
+
+    const pdu_log_record* d_records;
+    size_t d_nrecords;
+    bool d_sorted_pdu_num;
+    bool d_sorted_time;
+
+    static void map_file(const std::string& path, mapping& m, bool optional = false);
+    static void unmap_file(mapping& m);
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_LOG_READER_H */
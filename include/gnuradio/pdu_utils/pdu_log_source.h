@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_H
+#define INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+#include <gnuradio/pdu_utils/constants.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Replays PDUs from an indexed pdu_logger file
+ * \ingroup pdu_utils
+ *
+ * Reads a data file and its index through pdu_log_reader and emits every PDU in the
+ * index, with its original metadata, from a dedicated thread while the flowgraph
+ * runs. The index may describe a pdu_logger file or bursts within any raw sample
+ * file, in which case the ".meta" file may be omitted. PDUs whose metadata cannot be
+ * deserialized into a dictionary are skipped with a warning.
+ *
+ * Pacing is selected by mode:
+ *  - REPLAY_RATE: rate PDUs per second
+ *  - REPLAY_ASAP: as fast as the blocks connected to pdu_out accept them, keeping
+ *    fewer than queue_depth messages waiting at each of their input ports
+ *  - REPLAY_TIMESTAMP: at the spacing of the recorded burst times, sped up by a
+ *    factor of rate; PDUs without a time are emitted immediately
+ *
+ * Files are memory mapped, so only the PDUs being emitted are read from disk.
+ */
+class PDU_UTILS_API pdu_log_source : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_log_source> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_log_source.
+     *
+     * @param filename - data file written by pdu_logger with index enabled
+     * @param mode - pacing, from #replay_mode
+     * @param rate - PDUs per second, or speedup factor in REPLAY_TIMESTAMP mode
+     * @param queue_depth - messages allowed to wait downstream in REPLAY_ASAP mode
+     * @param repeat - start over at the beginning of the file after the last PDU
+     */
+    static sptr make(std::string filename,
+                     replay_mode mode = REPLAY_RATE,
+                     double rate = 1000,
+                     uint32_t queue_depth = 8,
+                     bool repeat = false);
+
+    /**
+     * Set the pacing rate
+     *
+     * @param rate - PDUs per second, or speedup factor in REPLAY_TIMESTAMP mode
+     */
+    virtual void set_rate(double rate) = 0;
+
+    /**
+     * Number of PDUs in the file
+     */
+    virtual uint64_t get_size() = 0;
+
+    /**
+     * Number of PDUs emitted since the flowgraph was started
+     */
+    virtual uint64_t get_emitted() = 0;
+
+    /**
+     * Returns true once every PDU in the file has been emitted, never if repeating
+     */
+    virtual bool is_done() = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_H */
@@ -10,6 +10,7 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_LOGGER_H
 #define INCLUDED_PDU_UTILS_PDU_LOGGER_H
 
+#include "constants.h"
 #include <gnuradio/sync_block.h>
 #include <gnuradio/pdu_utils/api.h>
 
@@ -25,7 +26,20 @@ namespace pdu_utils {
  * PDU data vectors are printed to each file. Note that there is no delimiter
  * between data vectors printed to the same file.
  *
+ * Files are written by a dedicated writer thread so filesystem stalls do not block
+ * the message handler. PDUs are passed to the writer by reference through a queue of
+ * queue_depth entries; when the queue is full PDUs are dropped, or with backpressure
+ * set the message handler waits for space while the writer is running. Files stay
+ * open until pdus_per_file PDUs have been written to them and are written through
+ * large aligned buffers, optionally with O_DIRECT. Files are flushed to the device
+ * according to the fsync policy. All queued PDUs are written out when the flowgraph
+ * stops.
  *
+ * With index set, each data file is accompanied by an index file (data file name +
+ * ".idx") holding a fixed size pdu_log_record per PDU with its offset, length, type,
+ * pdu_num and burst_time, and a metadata file (data file name + ".meta") holding the
+ * serialized metadata dictionaries. Both are appended as PDUs are written, and the
+ * files can be read back with pdu_log_reader.
  */
 class PDU_UTILS_API pdu_logger : virtual public gr::block
 {
@@ -38,8 +52,19 @@ public:
      * @param logfile - Filename to write to
      *
      * @param pdus_per_file - how many PDUs to print to a file
+     * @param queue_depth - number of PDUs queued for the writer thread
+     * @param backpressure - wait for queue space instead of dropping PDUs
+     * @param fsync - when files are flushed to the device, from #fsync_policy
+     * @param direct_io - bypass the page cache with O_DIRECT where supported
+     * @param index - also write an index and the metadata of each PDU
      */
-    static sptr make(std::string logfile, uint32_t pdus_per_file);
+    static sptr make(std::string logfile,
+                     uint32_t pdus_per_file,
+                     uint32_t queue_depth = 1024,
+                     bool backpressure = false,
+                     fsync_policy fsync = FSYNC_NEVER,
+                     bool direct_io = false,
+                     bool index = false);
 
     /*!
      * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_logger,
@@ -48,6 +73,28 @@ public:
      * @param logfile - Filename to write to
      */
     static sptr make(std::string logfile);
+
+    /**
+     * Number of PDUs written to file
+     */
+    virtual uint64_t get_written() = 0;
+
+    /**
+     * Number of PDUs dropped because the writer queue was full
+     */
+    virtual uint64_t get_dropped() = 0;
+
+    /**
+     * Number of times the message handler waited for queue space in backpressure mode
+     */
+    virtual uint64_t get_backpressure_waits() = 0;
+
+    /**
+     * Set the writer queue behavior when full
+     *
+     * @param backpressure - wait for queue space instead of dropping PDUs
+     */
+    virtual void set_backpressure(bool backpressure) = 0;
 };
 
 } // namespace pdu_utils
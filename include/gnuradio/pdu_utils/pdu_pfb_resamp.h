@@ -22,6 +22,20 @@ namespace pdu_utils {
  *
  * This block will apply a PFB resampling kernel to input data.
  *
+ * Rates that are rational (L/M) within a tolerance are processed by an exact
+ * L branch polyphase filterbank derived from the supplied prototype taps, other
+ * rates use the in-tree arbitrary resampler. Filterbanks are cached by ratio.
+ *
+ * If an output rate is set, the resampling rate for each PDU is determined from
+ * the `sample_rate` metadata key so PDUs of differing rates are all resampled to
+ * the same output rate.
+ *
+ * By default the kernel history carries over from one PDU to the next. In reset
+ * per PDU mode every PDU is processed from a clean kernel so the output depends
+ * only on that PDU. With more than one thread, PDUs are resampled concurrently by
+ * a pool of workers that each own their kernels and buffers; this implies reset
+ * per PDU mode, and output order always matches input order.
+ *
  */
 template <class T, class S>
 class PDU_UTILS_API pdu_pfb_resamp : virtual public gr::block
@@ -32,11 +46,22 @@ public:
     /*!
      * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_pfb_resamp_cc.
      *
+     * Throws std::runtime_error if resamp_rate is not positive.
+     *
      * @param taps -
      * @param n_filters -
      * @param resamp_rate -
+     * @param output_rate - target output sample rate, if > 0 overrides resamp_rate
+     *                      for PDUs with a sample_rate metadata key
+     * @param reset_per_pdu - reset the kernel history before every PDU
+     * @param n_threads - number of worker threads
      */
-    static sptr make(const std::vector<S> taps, int n_filters, float resamp_rate);
+    static sptr make(const std::vector<S> taps,
+                     int n_filters,
+                     float resamp_rate,
+                     double output_rate = 0,
+                     bool reset_per_pdu = false,
+                     int n_threads = 1);
 
     /**
      * Set taps
@@ -44,6 +69,29 @@ public:
      * @param taps -
      */
     virtual void set_taps(std::vector<S> taps) = 0;
+
+    /**
+     * Set target output sample rate, zero disables per-PDU rates
+     *
+     * @param output_rate -
+     */
+    virtual void set_output_rate(double output_rate) = 0;
+
+    /**
+     * Set relative tolerance used to detect rational rates, zero disables the
+     * rational filterbank
+     *
+     * @param tolerance -
+     */
+    virtual void set_rational_tolerance(double tolerance) = 0;
+
+    /**
+     * Set whether kernel history is reset before every PDU, always enabled when
+     * more than one thread is used
+     *
+     * @param reset -
+     */
+    virtual void set_reset_per_pdu(bool reset) = 0;
 };
 
 typedef pdu_pfb_resamp<float, float> pdu_pfb_resamp_fff;
@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_H
+#define INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Routes PDUs by boolean expressions over metadata values and length
+ * \ingroup pdu_utils
+ *
+ * Replaces chains of pdu_range_filter, pdu_length_filter and similar blocks. Each
+ * expression, such as 'snr > 10 && 100 <= len < 2000', is compiled once when it is
+ * set. Every PDU is tested against the expressions in order and sent on pdu_out_N
+ * for the first one that is true, or on the unmatched port if none is. PDUs
+ * without a metadata dictionary are dropped.
+ *
+ * Expressions support the || && ! operators (or, and, not), chained comparisons
+ * with == != < <= > >=, arithmetic with + - * /, numbers, quoted strings, true and
+ * false, parentheses, has(key) and 'len', the number of items in the PDU data. Any
+ * other identifier is the value of that metadata key; integers, reals and booleans
+ * are numbers and symbols are strings. A comparison involving a missing key, a
+ * value of another type or a number and a string is false. The values of all keys
+ * referenced by any expression are found in a single pass over the metadata.
+ */
+class PDU_UTILS_API pdu_predicate_filter : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_predicate_filter> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_predicate_filter.
+     *
+     * Throws std::runtime_error if an expression is invalid.
+     *
+     * @param expressions - one expression per output port, tested in order
+     */
+    static sptr make(std::vector<std::string> expressions);
+
+    /**
+     * Replace the expression for one output. Throws std::runtime_error, leaving the
+     * previous expression in place, if the index or the expression is invalid.
+     *
+     * @param index - output port number
+     * @param expression - new expression
+     */
+    virtual void set_expression(int index, std::string expression) = 0;
+    virtual std::vector<std::string> get_expressions() = 0;
+
+    /**
+     * Number of PDUs sent on each output, followed by the number sent on the
+     * unmatched port
+     */
+    virtual std::vector<uint64_t> get_counts() = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_H */
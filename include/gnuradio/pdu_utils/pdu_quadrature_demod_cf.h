@@ -21,6 +21,10 @@ namespace pdu_utils {
  * \ingroup pdu_utils
  *
  * c32vector input, f32vector output
+ *
+ * Output is sensitivity * arg(x[n] * conj(x[n-1])), one sample shorter than the
+ * input. Optionally the mean of the output is removed, which corrects for any
+ * carrier frequency offset over the burst.
  */
 class PDU_UTILS_API pdu_quadrature_demod_cf : virtual public gr::block
 {
@@ -31,8 +35,23 @@ public:
      * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_quadrature_demod_cf.
      *
      * @param sensitivity -
+     * @param remove_dc - subtract the mean of each output PDU
+     */
+    static sptr make(float sensitivity, bool remove_dc = false);
+
+    /**
+     * Set sensitivity
+     *
+     * @param sensitivity -
+     */
+    virtual void set_sensitivity(float sensitivity) = 0;
+
+    /**
+     * Set DC removal
+     *
+     * @param remove_dc -
      */
-    static sptr make(float sensitivity);
+    virtual void set_remove_dc(bool remove_dc) = 0;
 };
 
 } // namespace pdu_utils
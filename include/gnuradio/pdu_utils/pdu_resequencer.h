@@ -0,0 +1,99 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_RESEQUENCER_H
+#define INCLUDED_PDU_UTILS_PDU_RESEQUENCER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/pdu_utils/api.h>
+
+namespace gr {
+namespace pdu_utils {
+
+/*!
+ * \brief Merges PDUs from several inputs back into sequence number order
+ * \ingroup pdu_utils
+ *
+ * Intended to follow a stage that was parallelized with pdu_round_robin. PDUs
+ * arriving on any of the pdu_in_N ports are ordered by a non-negative integer
+ * metadata value, pdu_num by default, and emitted on pdu_out with consecutive
+ * sequence numbers.
+ *
+ * Out of order PDUs are buffered until the missing ones arrive. A missing sequence
+ * number is skipped when the buffer holds more than window PDUs, or when nothing has
+ * been released for timeout seconds. The first sequence number is taken as the
+ * smallest one buffered once either happens, so the stream may start anywhere.
+ * PDUs that arrive after their sequence number was released or skipped, duplicates,
+ * and PDUs without the key are dropped. PDUs still buffered when the flowgraph stops
+ * are discarded, and a restarted flowgraph begins a new stream with fresh statistics.
+ */
+class PDU_UTILS_API pdu_resequencer : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<pdu_resequencer> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_resequencer.
+     *
+     * @param num_inputs - number of input ports
+     * @param key - metadata key holding the sequence number
+     * @param window - most PDUs buffered before a missing one is skipped
+     * @param timeout - seconds without progress before a missing PDU is skipped, zero
+     * to skip only when the window is full
+     */
+    static sptr make(int num_inputs,
+                     std::string key = "pdu_num",
+                     int window = 64,
+                     double timeout = 0.1);
+
+    /**
+     * Set the number of PDUs buffered before a missing one is skipped
+     *
+     * @param window - buffer size
+     */
+    virtual void set_window(int window) = 0;
+
+    /**
+     * Set the time without progress before a missing PDU is skipped
+     *
+     * @param timeout - seconds, zero to disable
+     */
+    virtual void set_timeout(double timeout) = 0;
+
+    /**
+     * Number of PDUs currently buffered
+     */
+    virtual size_t get_depth() = 0;
+
+    /**
+     * Largest number of PDUs buffered at once
+     */
+    virtual size_t get_max_depth() = 0;
+
+    /**
+     * Number of sequence numbers skipped
+     */
+    virtual uint64_t get_skipped() = 0;
+
+    /**
+     * Number of PDUs dropped as late, duplicate or missing the key
+     */
+    virtual uint64_t get_dropped() = 0;
+
+    /**
+     * Dictionary with the released, skipped and dropped counts and a log-linear
+     * histogram of the buffer depth seen by each arriving PDU
+     */
+    virtual pmt::pmt_t get_stats() = 0;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_RESEQUENCER_H */
@@ -12,6 +12,7 @@
 
 #include <gnuradio/block.h>
 #include <gnuradio/pdu_utils/api.h>
+#include <gnuradio/pdu_utils/constants.h>
 
 namespace gr {
 namespace pdu_utils {
@@ -22,6 +23,18 @@ namespace pdu_utils {
  *
  * Round Robin delivers messages to a number of output paths.
  * In other Words Load shares messages across a number of outputs
+ *
+ * In DISPATCH_ROUND_ROBIN mode the outputs are used strictly in turn. The other
+ * modes look at the input queues of the blocks connected to each output and are
+ * meant for spreading an expensive stage over several parallel instances:
+ * DISPATCH_LEAST_LOADED sends each PDU to the output with the fewest messages
+ * waiting, and DISPATCH_SIZE_WEIGHTED to the output with the fewest items waiting,
+ * counted from the lengths of the PDUs this block sent that are still queued plus
+ * the one most recently taken off the queue, as it may still be being processed.
+ * That PDU stops counting once the queue has been found empty on two dispatches in
+ * a row, so an idle output is not held back by the size of its last PDU. This
+ * assumes this block is the only producer for the connected ports. Ties go to
+ * the next output in turn, and unconnected outputs are skipped in both modes.
  */
 class PDU_UTILS_API pdu_round_robin : virtual public gr::block
 {
@@ -32,8 +45,22 @@ public:
      * \brief Return a shared_ptr to a new instance of pdu_utils::pdu_round_robin.
      *
      * @param num_outputs - number of output ports
+     * @param mode - how the output for each PDU is chosen
+     */
+    static sptr make(int num_outputs, dispatch_mode mode = DISPATCH_ROUND_ROBIN);
+
+    /**
+     * Set how the output for each PDU is chosen
+     *
+     * @param mode - dispatch mode
+     */
+    virtual void set_mode(dispatch_mode mode) = 0;
+    virtual dispatch_mode get_mode() = 0;
+
+    /**
+     * Number of PDUs sent on each output
      */
-    static sptr make(int num_outputs);
+    virtual std::vector<uint64_t> get_counts() = 0;
 };
 
 } // namespace pdu_utils
@@ -31,9 +31,22 @@ namespace pdu_utils {
  * key/value pair of 'serialnumber: 123', the output PDU will have two key/value
  * pairs: 'serialnumber: 123' and 'serial: SN-123'.
  *
+ * The value template is compiled into literal text and key references when it is
+ * set, so each PDU only costs the dictionary lookups and one pass building the
+ * result. References are always resolved against the incoming metadata; a key that
+ * is not found is replaced by its own name.
+ *
  * If the v_overwrite boolean is set to false, then the PDU will not update the
  * key/value pair if the key is already present in the PDU.
  *
+ * Additional key/value pairs can be given as a dictionary and are handled the same
+ * way as the primary pair.
+ *
+ * Merged values are symbols by default, and every distinct symbol stays in the
+ * global PMT symbol table for the life of the process. Templates that make a new
+ * value for every PDU, such as '{name}-{pdu_num}', should set merge_bytes so the
+ * merged values are added as u8vectors holding the string instead.
+ *
  */
 class PDU_UTILS_API pdu_set_m : virtual public gr::block
 {
@@ -49,8 +62,16 @@ public:
      *          corresponding values in the incoming metadata
      * @param v_overwrite - If true, if k is already found in the metadata,
      *          overwrite the value with desired value; otherwise skip
+     * @param pairs - Dictionary of additional key/value pairs to add
+     * @param merge_bytes - If true, values with key references are added as u8vectors
+     *          instead of interned symbols
      */
-    static sptr make(pmt::pmt_t k, pmt::pmt_t v, bool kv_merge=false, bool v_overwrite=false);
+    static sptr make(pmt::pmt_t k,
+                     pmt::pmt_t v,
+                     bool kv_merge = false,
+                     bool v_overwrite = false,
+                     pmt::pmt_t pairs = pmt::PMT_NIL,
+                     bool merge_bytes = false);
 
     /**
      * Get key value
@@ -108,6 +129,28 @@ public:
      * @param v - val
      */
     virtual void set_kv(pmt::pmt_t k, pmt::pmt_t v) = 0;
+
+    /**
+     * Get the additional K-V pairs
+     *
+     * @return pmt::pmt_t
+     */
+    virtual pmt::pmt_t pairs(void) = 0;
+
+    /**
+     * Set the additional K-V pairs
+     *
+     * @param pairs - dictionary of keys and values, PMT_NIL for none
+     */
+    virtual void set_pairs(pmt::pmt_t pairs) = 0;
+
+    /**
+     * Set whether merged values are added as u8vectors instead of symbols
+     *
+     * @param merge_bytes - u8vector boolean
+     */
+    virtual void set_merge_bytes(bool merge_bytes) = 0;
+    virtual bool merge_bytes(void) = 0;
 };
 
 } // namespace pdu_utils
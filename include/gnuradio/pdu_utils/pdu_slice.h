@@ -24,6 +24,10 @@ namespace pdu_utils {
  * a start and stop index, and a stride size. The input notation and function
  * is identical to the Python slice notation. See Python documentation
  * on numpy slice notation for more information.
+ *
+ * The slice is parsed when it is set, invalid notation throws. If the PDU has a
+ * sample_rate metadata key, start_time is moved to the earliest sample kept and
+ * duration is set to the span of the output when those keys are present.
  */
 class PDU_UTILS_API pdu_slice : virtual public gr::block
 {
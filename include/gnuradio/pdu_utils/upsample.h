@@ -22,6 +22,12 @@ namespace pdu_utils {
  *
  * This block will upsample via zero insertion or repetition.
  *
+ * If taps are provided the block instead acts as a polyphase interpolator, the
+ * output is identical to upsampling and then applying the taps with the PDU FIR
+ * Filter block but each output is computed from the input samples only. Float
+ * and complex PDUs are supported as well as byte PDUs which produce float output.
+ * In repeat mode the taps are applied to the repeated samples.
+ *
  */
 class PDU_UTILS_API upsample : virtual public gr::block
 {
@@ -33,8 +39,10 @@ public:
      *
      * @param n - upsample by factor n
      * @param repeat - true to repeat values, false to zero fill
+     * @param taps - optional interpolation filter taps at the output rate
      */
-    static sptr make(uint32_t n, bool repeat);
+    static sptr
+    make(uint32_t n, bool repeat, const std::vector<float> taps = std::vector<float>());
 
     /**
      * Set upsample factor
@@ -49,6 +57,13 @@ public:
      * @param repeat = true to report values, false to zero fill
      */
     virtual void set_repeat(bool repeat) = 0;
+
+    /**
+     * Set interpolation filter taps, empty to disable filtering
+     *
+     * @param taps -
+     */
+    virtual void set_taps(std::vector<float> taps) = 0;
 };
 
 } // namespace pdu_utils
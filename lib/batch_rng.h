@@ -0,0 +1,162 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_BATCH_RNG_H
+#define INCLUDED_PDU_UTILS_BATCH_RNG_H
+
+#include <volk/volk.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * Block random number generator for noise generation.
+ *
+ * BATCH_RNG_LANES independent xoshiro128+ generators are stepped together with the
+ * state stored lane-major, so the inner loop has no dependencies between lanes and is
+ * vectorized by the compiler. Lanes are seeded from a single 64 bit seed with
+ * splitmix64, so output is reproducible for a given seed and sequence of requests.
+ *
+ * Gaussian samples use the Box-Muller transform on whole buffers with the volk log,
+ * sqrt, sin and cos kernels.
+ */
+class batch_rng
+{
+public:
+    static const int BATCH_RNG_LANES = 8;
+
+    batch_rng(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed)
+    {
+        for (int i = 0; i < 4; i++) {
+            for (int l = 0; l < BATCH_RNG_LANES; l++) {
+                uint64_t z = splitmix64(seed);
+                d_s[i][l] = (uint32_t)(z >> 32);
+            }
+        }
+        // an all zero lane state would only ever produce zeros
+        for (int l = 0; l < BATCH_RNG_LANES; l++) {
+            if ((d_s[0][l] | d_s[1][l] | d_s[2][l] | d_s[3][l]) == 0) {
+                d_s[0][l] = 1;
+            }
+        }
+    }
+
+    /**
+     * Fill out with n uniform samples in (-1, 1)
+     */
+    void fill_uniform(float* out, size_t n)
+    {
+        d_bits.resize(n);
+        fill_bits(d_bits.data(), n);
+        for (size_t i = 0; i < n; i++) {
+            out[i] = to_unit(d_bits[i]) * 2.0f - 1.0f;
+        }
+    }
+
+    /**
+     * Fill out with n standard normal samples
+     */
+    void fill_gaussian(float* out, size_t n)
+    {
+        size_t pairs = (n + 1) / 2;
+        d_bits.resize(2 * pairs);
+        d_radius.resize(pairs);
+        d_angle.resize(pairs);
+        d_sin.resize(pairs);
+        d_cos.resize(pairs);
+        fill_bits(d_bits.data(), 2 * pairs);
+
+        // u1 in (0, 1) so the log is finite, angle in (-pi, pi)
+        for (size_t i = 0; i < pairs; i++) {
+            d_radius[i] = to_unit(d_bits[i]);
+            d_angle[i] = (to_unit(d_bits[pairs + i]) * 2.0f - 1.0f) * (float)M_PI;
+        }
+        volk_32f_log2_32f(d_radius.data(), d_radius.data(), pairs);
+        volk_32f_s32f_multiply_32f(
+            d_radius.data(), d_radius.data(), (float)(-2.0 * M_LN2), pairs);
+        volk_32f_sqrt_32f(d_radius.data(), d_radius.data(), pairs);
+        volk_32f_sin_32f(d_sin.data(), d_angle.data(), pairs);
+        volk_32f_cos_32f(d_cos.data(), d_angle.data(), pairs);
+
+        for (size_t i = 0; i < n / 2; i++) {
+            out[2 * i] = d_radius[i] * d_cos[i];
+            out[2 * i + 1] = d_radius[i] * d_sin[i];
+        }
+        if (n % 2) {
+            out[n - 1] = d_radius[pairs - 1] * d_cos[pairs - 1];
+        }
+    }
+
+private:
+    uint32_t d_s[4][BATCH_RNG_LANES];
+
+    // scratch space reused between calls
+    std::vector<uint32_t> d_bits;
+    std::vector<float> d_radius;
+    std::vector<float> d_angle;
+    std::vector<float> d_sin;
+    std::vector<float> d_cos;
+
+    static uint64_t splitmix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    static inline uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    // upper 24 bits mapped to the center of their interval in (0, 1)
+    static inline float to_unit(uint32_t x)
+    {
+        return ((x >> 8) + 0.5f) * (1.0f / 16777216.0f);
+    }
+
+    // one xoshiro128+ step of every lane
+    inline void step(uint32_t* out)
+    {
+        for (int l = 0; l < BATCH_RNG_LANES; l++) {
+            out[l] = d_s[0][l] + d_s[3][l];
+            const uint32_t t = d_s[1][l] << 9;
+            d_s[2][l] ^= d_s[0][l];
+            d_s[3][l] ^= d_s[1][l];
+            d_s[1][l] ^= d_s[2][l];
+            d_s[0][l] ^= d_s[3][l];
+            d_s[2][l] ^= t;
+            d_s[3][l] = rotl(d_s[3][l], 11);
+        }
+    }
+
+    void fill_bits(uint32_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + BATCH_RNG_LANES <= n; i += BATCH_RNG_LANES) {
+            step(&out[i]);
+        }
+        if (i < n) {
+            uint32_t tail[BATCH_RNG_LANES];
+            step(tail);
+            for (size_t j = 0; i < n; i++, j++) {
+                out[i] = tail[j];
+            }
+        }
+    }
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_BATCH_RNG_H */
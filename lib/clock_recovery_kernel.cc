@@ -0,0 +1,799 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2018-2021 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "clock_recovery_kernel.h"
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * Constructor
+ *
+ * @param logger - logger of the owning block
+ * @param debug - true to enable debug output and logging
+ * @param type - window type to use.
+ */
+clock_recovery_kernel::clock_recovery_kernel(gr::logger_ptr logger,
+                                             bool debug,
+                                             window_type type)
+    : d_logger(logger),
+      d_lanczos_a(1), // logic for adding pulses currently relies on this being 1
+      d_gauss_sigma(2.0f / 8.0f),
+      d_dc_reject(0.05),
+      d_mags(nullptr),
+      d_debug(debug),
+      d_burst_id(0),
+      d_window_type(type)
+{
+    init_fast_sinc();
+    fft_setup(15);
+} // end constructor
+
+clock_recovery_kernel::~clock_recovery_kernel() { fft_cleanup(); }
+
+/**
+ * Specify what window type to use.
+ *
+ * @param type - Window type to use
+ */
+void clock_recovery_kernel::set_window_type(window_type type)
+{
+    d_window_type = type;
+
+    // flush all the existing pre-made memory & recreate it.
+    fft_cleanup();
+    fft_setup(15);
+} // end set_window_type
+
+/**
+ * Recovers the symbol clock of a real valued burst and extracts soft symbols at the
+ * recovered symbol times.
+ *
+ * @param data - real waveform
+ * @param length - number of samples in data
+ * @param samp_rate - sample rate of data
+ * @param min_rate - lower bound of symbol rate search band, 0 for a full band search
+ * @param max_rate - upper bound of symbol rate search band
+ * @param symbols - storage for the extracted soft symbols
+ * @param symbol_rate - recovered symbol rate
+ * @return bool - true if a symbol clock was found
+ */
+bool clock_recovery_kernel::recover(const float* data,
+                                    size_t length,
+                                    float samp_rate,
+                                    float min_rate,
+                                    float max_rate,
+                                    std::vector<float>& symbols,
+                                    float& symbol_rate)
+{
+    int offset = 0; // input data offset for where to start processing
+
+    // Setup Memory banks
+    int fftpower = std::floor(log2(length));
+    int fftsize = pow(2, fftpower);
+    fft_setup(fftpower);
+    float* fft_in = d_ffts[fftpower]->get_inbuf();
+    memset(fft_in, 0, sizeof(float) * fftsize);
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("BurstID %u, Input Sz: %d, FFT Power: %d, FFTSz: %d") %
+                         d_burst_id % length % fftpower % fftsize);
+    }
+
+    // calculate sample offset
+    offset = (length - fftsize) / 2;
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("BurstID %u sampLen:%d len:%d offset:%d") %
+                         d_burst_id % length % fftsize % offset);
+    }
+
+    // make a list of zero crossing locations, offset
+    std::vector<float> zero_crossings = findZeroCrossings(&data[offset], fftsize);
+    if (zero_crossings.empty() || zero_crossings.size() < (size_t)(fftsize / (2 * SPS_MAX))) {
+        if (d_debug) {
+            GR_LOG_WARN(
+                d_logger,
+                boost::format("BurstID %u no/low zero crossings found, dropping") %
+                    d_burst_id);
+        }
+        return false;
+    }
+
+    double fmin = min_rate / samp_rate;
+    double fmax = std::min(max_rate / samp_rate, 0.5f);
+    bool use_band = (min_rate > 0) && (fmin < fmax);
+
+    float phase;
+    float symbol_freq;
+
+    if (use_band) {
+        // evaluate the hinted band only, no full band FFT required
+        if (!bandSearch(
+                zero_crossings, d_windows[fftpower], fftsize, fmin, fmax, symbol_freq, phase)) {
+            if (d_debug) {
+                GR_LOG_WARN(d_logger,
+                            boost::format("BurstID %u no peak found in band, dropping") %
+                                d_burst_id);
+            }
+            return false;
+        }
+
+        if (d_debug) {
+            GR_LOG_DEBUG(d_logger,
+                         boost::format("band [%f %f]   symbol_freq %f    symbol_rate %f") %
+                             fmin % fmax % symbol_freq % (symbol_freq * samp_rate));
+        }
+    } else {
+        genSincWaveform(zero_crossings, length, fft_in, fftsize);
+        if (d_debug) {
+            debug_pub(PMTCONSTSTR__zeroX(), pmt::init_f32vector(fftsize, fft_in));
+        }
+
+        // apply gaussian window
+        volk_32f_x2_multiply_32f(fft_in, fft_in, d_windows[fftpower], fftsize);
+        if (d_debug) {
+            debug_pub(PMTCONSTSTR__window(), pmt::init_f32vector(fftsize, fft_in));
+        }
+
+        // run the FFT
+        d_ffts[fftpower]->execute();
+        fftsize /= 2; // real transform only outputs positive frequencies
+        gr_complex* fft_out = d_ffts[fftpower]->get_outbuf();
+        volk_32fc_magnitude_squared_32f(d_mags, fft_out, fftsize);
+        if (d_debug) {
+            debug_pub(PMTCONSTSTR__debug(), pmt::init_f32vector(fftsize, d_mags));
+        }
+
+
+        // Find fundamental max & associated info
+        int max_bin = findMaxFundamental(d_mags, fftsize);
+        float peak_bin = calcPeakBin(d_mags, fftsize, max_bin);
+        phase = calcPeakPhase(fft_out, fftsize, max_bin, peak_bin);
+
+        symbol_freq = peak_bin / fftsize / 2.0f;
+
+        if (d_debug) {
+            GR_LOG_DEBUG(
+                d_logger,
+                boost::format(
+                    "peak_bin %f   fftsize %d   symbol_freq %f    symbol_rate %f") %
+                    peak_bin % fftsize % symbol_freq % (symbol_freq * samp_rate));
+        }
+    }
+
+    // now extract soft symbols
+    extractSymbols(data, length, symbol_freq, phase, offset, symbols);
+    symbol_rate = symbol_freq * samp_rate;
+
+    return true;
+} // end recover
+
+/**
+ * Forwards an intermediate result to the owning block if a debug handler is set
+ *
+ * @param port - debug port the result belongs to
+ * @param msg - intermediate result
+ */
+void clock_recovery_kernel::debug_pub(pmt::pmt_t port, pmt::pmt_t msg)
+{
+    if (d_debug_handler) {
+        d_debug_handler(port, msg);
+    }
+}
+
+/**
+ * sets up FFT memory space for a given power if needed
+ *
+ * @param power - power of FFT
+ */
+void clock_recovery_kernel::fft_setup(int power)
+{
+    for (int i = d_ffts.size(); i <= power; i++) {
+
+        // init fft
+        int fftsize = pow(2, i);
+        d_ffts.push_back(new gr::fft::fft_real_fwd(fftsize, 1));
+
+        // init window
+        d_windows.push_back(
+            (float*)volk_malloc(sizeof(float) * fftsize, volk_get_alignment()));
+        for (int j = 0; j < fftsize; j++) {
+            switch (d_window_type) {
+            case (GAUSSIAN_WIN): {
+                d_windows[i][j] = gaussianWindow(fftsize, d_gauss_sigma, j);
+                break;
+            }
+            case (TUKEY_WIN):
+            default: {
+                d_windows[i][j] = tukeyWindow(fftsize, d_gauss_sigma, j);
+                break;
+            }
+            } // end switch( d_window_type
+
+            // printf("%f ", d_windows[i][j] );
+        } // end for(j
+        // printf("\n");
+
+        // init d_mags
+        if (d_mags != nullptr) {
+            volk_free(d_mags);
+        }
+        d_mags = (float*)volk_malloc(sizeof(float) * fftsize, volk_get_alignment());
+
+    } // end for(i
+} // end fft_setup
+
+/**
+ * Calculates the gaussian window value at a specific position
+ *
+ * @param n - total number of samples to calculate over
+ * @param sigma - sigma value
+ * @param x - index/sample to calculate for
+ * @return float - gaussianWindows at x
+ */
+float clock_recovery_kernel::gaussianWindow(int n, float sigma, int x)
+{
+    float ans;
+
+    float two_sigma_squared = n * d_gauss_sigma;
+    two_sigma_squared *= 2 * two_sigma_squared;
+    float t = (-n + 1) / 2.0f + x;
+    ans = std::exp((-t * t) / two_sigma_squared);
+
+    return ans;
+} // end gaussianWindow
+
+/**
+ * Calculates the Tukey window value at a specific position
+ *
+ * @param n - total number of samples to calculate over
+ * @param alpha - alpha value
+ * @param x - index/sample to calculate for
+ * @return float - Tukey at x
+ */
+float clock_recovery_kernel::tukeyWindow(int n, float alpha, int x)
+{
+    float ans = 0; // default
+
+    // https://en.wikipedia.org/wiki/Window_function
+    // printf("tukeyWindow( %d %f %d )\n", n, alpha, x );
+
+    // which part of the waveform are we in?
+    if (x == 0) {
+        ans = 0;
+    } else if (0 < x && x < (alpha * n / 2)) {
+        // cosine slope
+        ans = 0.5 * (1.0 - std::cos((2 * M_PI * x) / (alpha * n)));
+    } else if ((alpha * n / 2) <= x && x <= (n / 2)) {
+        // constant pass
+        ans = 1.0;
+    } else {
+        // upper half, return answer from lower half
+        ans = tukeyWindow(n, alpha, n - x);
+    }
+
+
+    return ans;
+} // end tukeyWindow
+
+/**
+ * cleans up all memory associated with FFTs, windows, & mags
+ */
+void clock_recovery_kernel::fft_cleanup()
+{
+    for (gr::fft::fft_real_fwd* fft : d_ffts) {
+        delete fft;
+    }
+    d_ffts.clear();
+
+    for (float* win : d_windows) {
+        volk_free(win);
+    }
+    d_windows.clear();
+
+    if (d_mags != nullptr) {
+        volk_free(d_mags);
+    }
+    d_mags = nullptr;
+} // end fft_cleanup
+
+/**
+ * initialize LUT for a lanczos windowed sinc function
+ * note: LUT is one-sided to take advantage of symmetryS
+ */
+void clock_recovery_kernel::init_fast_sinc()
+{
+    const float pi_squared = M_PI * M_PI;
+    d_sinc_table[0] = 1.0;
+    for (int i = 1; i < LUT_SIZE; i++) {
+        float x = i * d_lanczos_a / (float)(LUT_SIZE - 1);
+        d_sinc_table[i] = d_lanczos_a * std::sin(M_PI * x) *
+                          std::sin(M_PI * x / d_lanczos_a) / (pi_squared * x * x);
+    } // end for(i
+}
+
+/**
+ * fast sinc table lookup( lanczos windows sinc )
+ *
+ * @param x -
+ * @return float -
+ */
+float clock_recovery_kernel::fast_sinc(float x)
+{
+    x = fabs(x);
+    if (x >= d_lanczos_a) {
+        return 0.0f;
+    }
+    x *= (LUT_SIZE - 1) / (float)d_lanczos_a;
+    int x_upper = std::ceil(x);
+    int x_lower = std::floor(x);
+    float mu = x - x_lower;
+    // linearly interpolate between table entries
+    return d_sinc_table[x_lower] + mu * (d_sinc_table[x_upper] - d_sinc_table[x_lower]);
+}
+
+/**
+ * finds zero crossings in the data. Returns a vector of indexes
+ * where zero crossings happen
+ *
+ * @param data - pointer to real waveform
+ * @param len - length of data
+ * @return std::vector<float> - list of zero crossing points
+ */
+std::vector<float> clock_recovery_kernel::findZeroCrossings(const float* data,
+                                                            const int len)
+{
+    std::vector<float> ans;
+    float mid = 0; //= midpoint( data, len );
+
+    ans.reserve(len / 2); // make a generous estimate of how many zero crossings there are
+    for (int i = 1; i < len; i++) {
+        if ((data[i] > mid) != (data[i - 1] > mid)) {
+            // quick linear interpolation of zero crossing point, unit = indexs
+            ans.push_back(i - 1 + (data[i - 1] - mid) / (data[i - 1] - data[i]));
+        }
+    } // end for(i
+
+    return ans;
+} // end findZeroCrossings
+
+/**
+ * Generates a sync pulse waveform based on zero crossing positions.
+ * This function also selects a portion of the original sample set's
+ * zero crossings to use for the waveform. This resolves the fact
+ * that the FFT size will always be smaller than the sample size
+ *
+ * @param crossings - locations of zero crossings
+ * @param sampLen - original length of sample set
+ * @param out - storage for sync waveform
+ * @param len - max size of storage
+ */
+void clock_recovery_kernel::genSincWaveform(std::vector<float> crossings,
+                                            const int sampLen,
+                                            float* out,
+                                            const int len)
+{
+
+    // drop sinc pulses at every zero crossing location
+    for (const float& crossing : crossings) {
+        int idx = round(crossing);
+
+        if (0 < idx && idx < len) {
+            if (idx == crossing) {
+                out[idx] = 1.0f;
+            } else if (idx < (len - 1)) {
+                // this assumes d_lanczos_a == 1
+                out[idx - 1] += fast_sinc(idx - 1 - crossing);
+                out[idx] += fast_sinc(idx - crossing);
+                out[idx + 1] += fast_sinc(idx + 1 - crossing);
+            }
+
+        } // end if( inbounds
+
+    } // end for(i
+
+    return;
+} // end genSyncWaveform
+
+/**
+ * Finds the max fundamental freq present in the FFT magnitude array.
+ *
+ * @param mags - FFT magnitude
+ * @param len - length of mags
+ * @return int - index of mags representing the max fundamental freq
+ */
+int clock_recovery_kernel::findMaxFundamental(const float* mags, const int len)
+{
+    float max_val = -1;
+    int max_bin = 0;
+
+    // first, calc DC reject
+    int first_bin = std::ceil(d_dc_reject * len);
+
+
+    // find max value across whole array
+    for (int i = first_bin; i < len; i++) {
+        if (d_mags[i] > max_val) {
+            max_val = d_mags[i];
+            max_bin = i;
+        }
+    }
+
+
+    // make sure the largest magnitude wasn't a harmonic of the frequency we want
+    float thresh = 0.5 * d_mags[max_bin];
+
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("first pass max_bin %d(%f)   first_bin %d") % max_bin %
+                         d_mags[max_bin] % first_bin);
+        GR_LOG_DEBUG(d_logger, boost::format("harmonic thresh %f") % thresh);
+    }
+
+
+    // 'denom' is the harmonic we are checking (if denom is 5, we're checking if max_bin
+    // is a 5th harmonic)
+    // TODO WHY does this only process up to the 5th harmonic
+    // TODO WHY does this start processing at 5th and go down.
+    for (int denom = (SPS_MAX / 2); denom >= 2; denom--) {
+        // calculate the index of the fundamental
+        int funIdx = round(1.0f / (float)denom * max_bin);
+
+        if (first_bin <= funIdx && funIdx < len) // avoid DC reject & inbounds
+        {
+            if (d_debug) {
+                GR_LOG_DEBUG(d_logger,
+                             boost::format("harmonic check %d(%f) thresh %f  denom %d") %
+                                 funIdx % d_mags[funIdx] % thresh % denom);
+            }
+
+            if (d_mags[funIdx] >= thresh || d_mags[funIdx - 1] >= thresh ||
+                d_mags[funIdx + 1] >= thresh) {
+                // max search across [-1 .. +1] region
+                max_bin = funIdx - 1;
+                max_val = d_mags[max_bin];
+                for (int i = max_bin + 1; i <= max_bin + 2; i++) {
+                    if (d_mags[i] > max_val) {
+                        max_val = d_mags[i];
+                        max_bin = i;
+                    }
+                }
+
+                if (d_debug) {
+                    GR_LOG_DEBUG(d_logger,
+                                 boost::format("harmonic found, denom %d, bin %d(%f)") %
+                                     denom % max_bin % d_mags[max_bin]);
+                }
+
+                break;
+
+            } // end if( fundamental threshold
+
+        } // end if( avoid DC reject
+
+    } // end for(denom
+
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("second pass max_bin %d(%f)") % max_bin %
+                         d_mags[max_bin]);
+    }
+
+    return max_bin;
+    ;
+} // end findMaxFundamental
+
+/**
+ * Interpolates peak bin position
+ *
+ * @param mags - FFT magnitude
+ * @param len - length of mags
+ * @param max_bin - index into mags with max value
+ * @return float - calculated peak bin
+ */
+float clock_recovery_kernel::calcPeakBin(const float* mags,
+                                         const int len,
+                                         const int max_bin)
+{
+    float ans = max_bin;
+
+    if ((max_bin > 0) and (max_bin < len - 1)) {
+        // https://ccrma.stanford.edu/~jos/sasp/Quadratic_Interpolation_Spectral_Peaks.html
+        float alpha = log(d_mags[max_bin - 1]);
+        float beta = log(d_mags[max_bin]);
+        float gamma = log(d_mags[max_bin + 1]);
+
+        float bin_offset = 0.5f * (alpha - gamma) / (alpha - 2 * beta + gamma);
+        ans = max_bin + bin_offset;
+
+        if (std::isnan(ans) || std::isinf(ans) || (ans < 0)) {
+            if (d_debug) {
+                GR_LOG_DEBUG(
+                    d_logger,
+                    boost::format("busrtID:%u peak_bin is inf or nan, reverting") %
+                        d_burst_id);
+                GR_LOG_DEBUG(
+                    d_logger,
+                    boost::format("burstID:%u max_bin:%d alpha:%f beta:%f gamma:%f") %
+                        d_burst_id % max_bin % alpha % beta % gamma);
+            }
+            ans = max_bin;
+        }
+
+        if ((bin_offset > .5f) || (bin_offset < -.5f)) {
+            // sanity check - an answer out of range\can occur if the max_bin is
+            // not a local maxima, i.e. a linear increasing/decreasing set of points
+
+            if (d_debug) {
+                GR_LOG_DEBUG(
+                    d_logger,
+                    boost::format(
+                        "burstID:%u bin_offset outside sanity check %f, reverting") %
+                        d_burst_id % bin_offset);
+            }
+
+            ans = max_bin;
+        }
+    }
+
+    return ans;
+} // end calcPeakBin
+
+/**
+ * Calculate Peak phase
+ *
+ * @param fft - complex FFT data
+ * @param fftsize - size of fft
+ * @param max_bin - index of max bin
+ * @param peak_bin - calculated peak bin
+ * @return float - phase
+ */
+float clock_recovery_kernel::calcPeakPhase(gr_complex* fft,
+                                           const int fftsize,
+                                           const int max_bin,
+                                           const float peak_bin)
+{
+    float ans = 0;
+
+
+    // interpolate real and imaginary peaks separately to get accurate phase
+    int n_pts_to_interp = std::min(max_bin, 5);
+    int maxi = std::min(max_bin + n_pts_to_interp, fftsize - 1);
+    float real_peak = 0;
+    float imag_peak = 0;
+
+    for (int i = max_bin - n_pts_to_interp; i <= maxi; i++) {
+        float sinc;
+        if (i - peak_bin == 0) {
+            sinc = 1;
+        } else {
+            sinc = std::sin(M_PI * (i - peak_bin)) / (M_PI * (i - peak_bin));
+        }
+        real_peak += std::real(fft[i]) * sinc;
+        imag_peak += std::imag(fft[i]) * sinc;
+    } // end for(i
+
+    ans = std::arg(gr_complex(real_peak, imag_peak));
+
+    return ans;
+} // end calcPeakPhase
+
+/**
+ * Evaluates the spectrum of the windowed zero crossing waveform at nbins uniformly
+ * spaced frequencies directly from the zero crossing locations.
+ *
+ * @param crossings - locations of zero crossings
+ * @param window - analysis window, len samples
+ * @param len - length of the analysis window
+ * @param f0 - first frequency to evaluate, cycles/sample
+ * @param df - frequency spacing, cycles/sample
+ * @param nbins - number of frequencies to evaluate
+ * @param out - storage for nbins complex spectrum values
+ */
+void clock_recovery_kernel::crossingSpectrum(const std::vector<float>& crossings,
+                                             const float* window,
+                                             const int len,
+                                             const double f0,
+                                             const double df,
+                                             const int nbins,
+                                             gr_complex* out)
+{
+    std::fill(out, out + nbins, gr_complex(0, 0));
+
+    for (const float& crossing : crossings) {
+        // same bounds as genSincWaveform
+        int idx = round(crossing);
+        if (idx <= 0 || idx >= len) {
+            continue;
+        }
+
+        // phase terms are reduced in double precision, crossing * f0 can be large
+        float start = -2.0 * M_PI * std::fmod(f0 * crossing, 1.0);
+        float step = -2.0 * M_PI * std::fmod(df * crossing, 1.0);
+        gr_complex rot = std::polar(window[idx], start);
+        const gr_complex inc = std::polar(1.0f, step);
+
+        for (int k = 0; k < nbins; k++) {
+            out[k] += rot;
+            rot *= inc;
+        }
+    } // end for(crossing
+
+    return;
+} // end crossingSpectrum
+
+/**
+ * Searches for the symbol frequency within [fmin, fmax] at FFT bin spacing, checks
+ * for a fundamental inside the band, and refines the peak with a zoomed evaluation
+ * around the coarse maximum.
+ *
+ * @param crossings - locations of zero crossings
+ * @param window - analysis window, len samples
+ * @param len - length of the analysis window
+ * @param fmin - lower bound of search band, cycles/sample
+ * @param fmax - upper bound of search band, cycles/sample
+ * @param symbol_freq - calculated symbol frequency
+ * @param phase - calculated phase of symbol frequency
+ * @return bool - true if a peak was found
+ */
+bool clock_recovery_kernel::bandSearch(const std::vector<float>& crossings,
+                                       const float* window,
+                                       const int len,
+                                       const double fmin,
+                                       const double fmax,
+                                       float& symbol_freq,
+                                       float& phase)
+{
+    // coarse pass at the same bin spacing the full band FFT would have
+    const double df = 1.0 / len;
+    int nbins = std::floor((fmax - fmin) / df) + 1;
+    d_band_bins.resize(nbins);
+    d_band_mags.resize(nbins);
+    crossingSpectrum(crossings, window, len, fmin, df, nbins, d_band_bins.data());
+    volk_32fc_magnitude_squared_32f(d_band_mags.data(), d_band_bins.data(), nbins);
+    if (d_debug) {
+        debug_pub(PMTCONSTSTR__debug(), pmt::init_f32vector(nbins, d_band_mags.data()));
+    }
+
+    int max_bin =
+        std::max_element(d_band_mags.begin(), d_band_mags.end()) - d_band_mags.begin();
+    if (!(d_band_mags[max_bin] > 0)) {
+        return false;
+    }
+    double peak_freq = fmin + max_bin * df;
+
+    // the band may span more than one octave, make sure the largest magnitude wasn't a
+    // harmonic of a fundamental that is also inside the band
+    float thresh = 0.5 * d_band_mags[max_bin];
+    gr_complex fun_bins[3];
+    float fun_mags[3];
+    for (int denom = (SPS_MAX / 2); denom >= 2; denom--) {
+        double fun_freq = peak_freq / denom;
+        if (fun_freq < fmin) {
+            continue;
+        }
+
+        crossingSpectrum(crossings, window, len, fun_freq - df, df, 3, fun_bins);
+        volk_32fc_magnitude_squared_32f(fun_mags, fun_bins, 3);
+        int fun_max = std::max_element(fun_mags, fun_mags + 3) - fun_mags;
+        if (fun_mags[fun_max] >= thresh) {
+            if (d_debug) {
+                GR_LOG_DEBUG(d_logger,
+                             boost::format("harmonic found, denom %d, freq %f(%f)") %
+                                 denom % fun_freq % fun_mags[fun_max]);
+            }
+            peak_freq = fun_freq + (fun_max - 1) * df;
+            break;
+        }
+    } // end for(denom
+
+    // zoom pass, +/- one coarse bin around the peak
+    const int nzoom = 2 * ZOOM_FACTOR + 1;
+    const double zf = df / ZOOM_FACTOR;
+    gr_complex zoom_bins[nzoom];
+    float zoom_mags[nzoom];
+    crossingSpectrum(crossings, window, len, peak_freq - df, zf, nzoom, zoom_bins);
+    volk_32fc_magnitude_squared_32f(zoom_mags, zoom_bins, nzoom);
+    int zoom_max = std::max_element(zoom_mags, zoom_mags + nzoom) - zoom_mags;
+
+    // quadratic interpolation of the zoomed peak, same as calcPeakBin
+    double bin_offset = 0;
+    if ((zoom_max > 0) && (zoom_max < nzoom - 1)) {
+        float alpha = log(zoom_mags[zoom_max - 1]);
+        float beta = log(zoom_mags[zoom_max]);
+        float gamma = log(zoom_mags[zoom_max + 1]);
+        bin_offset = 0.5f * (alpha - gamma) / (alpha - 2 * beta + gamma);
+        if (std::isnan(bin_offset) || std::isinf(bin_offset) || (bin_offset > .5) ||
+            (bin_offset < -.5)) {
+            bin_offset = 0;
+        }
+    }
+    double refined_freq = peak_freq - df + (zoom_max + bin_offset) * zf;
+
+    // phase at the refined frequency
+    gr_complex peak;
+    crossingSpectrum(crossings, window, len, refined_freq, 0, 1, &peak);
+
+    symbol_freq = refined_freq;
+    phase = std::arg(peak);
+
+    return true;
+} // end bandSearch
+
+/**
+ * Extracts symbols from the original input data.
+ *
+ * @param data - input data buffer
+ * @param len - length of data
+ * @param symbol_freq - calculated symbol frequency
+ * @param phase - calculated phase of symbol frequency
+ * @param offset - sample offset used by genSincWaveform. Used for phase correction
+ * @param ans - storage for the extracted symbols, cleared first
+ */
+void clock_recovery_kernel::extractSymbols(const float* data,
+                                           const int len,
+                                           const float symbol_freq,
+                                           const float phase,
+                                           const int offset,
+                                           std::vector<float>& ans)
+{
+    ans.clear();
+    ans.reserve((int)len * symbol_freq + 100);
+
+    float clock_phase = phase / (2 * M_PI);
+    clock_phase += 0.5f; // we want sample times, not zero crossing times
+    if (clock_phase <= 0) {
+        clock_phase += 1.0f;
+    }
+    clock_phase += symbol_freq;
+
+    // NOTE: The SincWaveform & FFT were not taken from the start of the file. We need to
+    // offset clock_phase to account for this
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("Pre correction phase %f   clock_phase %f") % phase %
+                         clock_phase);
+    }
+    clock_phase -= offset * symbol_freq;
+    while (clock_phase <= 0) {
+        clock_phase += 1.0f;
+    }
+    while (clock_phase > 1) {
+        clock_phase -= 1.0f;
+    }
+    if (d_debug) {
+        GR_LOG_DEBUG(d_logger,
+                     boost::format("phase %f   clock_phase %f") % phase % clock_phase);
+    }
+
+
+    for (int i = 1; i < len; i++) {
+        if (clock_phase >= 1) {
+            clock_phase -= 1.0f;
+            float mu = clock_phase / symbol_freq;
+            float interp = mu * data[i - 1] + (1 - mu) * data[i];
+            ans.push_back(interp);
+        }
+        clock_phase += symbol_freq;
+    }
+
+    return;
+} // end extractSymbols
+
+} /* namespace pdu_utils */
+} /* namespace gr */
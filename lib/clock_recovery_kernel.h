@@ -0,0 +1,280 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2018-2021 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_CLOCK_RECOVERY_KERNEL_H
+#define INCLUDED_PDU_UTILS_CLOCK_RECOVERY_KERNEL_H
+
+#include <gnuradio/fft/fft.h>
+#include <gnuradio/logger.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <pmt/pmt.h>
+
+#include <functional>
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+const int LUT_SIZE = 256;
+
+/**
+ * Zero crossing spectrum symbol clock recovery shared by pdu_clock_recovery and
+ * pdu_burst_demod. Not a block; FFT plans, windows and scratch space are owned by the
+ * kernel and reused between bursts, so an instance must not be used from more than
+ * one thread at a time.
+ */
+class clock_recovery_kernel
+{
+public:
+    typedef std::function<void(pmt::pmt_t, pmt::pmt_t)> debug_handler_t;
+
+private:
+    gr::logger_ptr d_logger;
+    const int d_lanczos_a;
+    float d_gauss_sigma;
+    float d_dc_reject;
+    float* d_mags;
+    bool d_debug;
+    uint64_t d_burst_id;
+    window_type d_window_type;
+    debug_handler_t d_debug_handler;
+
+    const static int SPS_MAX = 20;
+    const static int ZOOM_FACTOR = 8;
+    float d_sinc_table[LUT_SIZE];
+
+    std::vector<gr::fft::fft_real_fwd*> d_ffts;
+    std::vector<float*> d_windows;
+
+    // scratch space for band limited spectrum evaluation
+    std::vector<gr_complex> d_band_bins;
+    std::vector<float> d_band_mags;
+
+public:
+    clock_recovery_kernel(gr::logger_ptr logger, bool debug, window_type type);
+
+    ~clock_recovery_kernel();
+
+    clock_recovery_kernel(const clock_recovery_kernel&) = delete;
+    clock_recovery_kernel& operator=(const clock_recovery_kernel&) = delete;
+
+    void set_window_type(window_type type);
+    window_type get_window_type() const { return d_window_type; }
+
+    void set_gauss_sigma(float gauss_sigma) { d_gauss_sigma = gauss_sigma; }
+
+    void set_dc_reject(float dc_reject) { d_dc_reject = dc_reject; }
+
+    /**
+     * Burst identifier used in debug log messages
+     */
+    void set_burst_id(uint64_t burst_id) { d_burst_id = burst_id; }
+
+    /**
+     * Sets the handler intermediate results (zeroX, window, debug) are passed to when
+     * debug is enabled
+     */
+    void set_debug_handler(debug_handler_t handler) { d_debug_handler = handler; }
+
+    /**
+     * Recovers the symbol clock of a real valued burst and extracts soft symbols at the
+     * recovered symbol times.
+     *
+     * @param data - real waveform
+     * @param length - number of samples in data
+     * @param samp_rate - sample rate of data
+     * @param min_rate - lower bound of symbol rate search band, 0 for a full band search
+     * @param max_rate - upper bound of symbol rate search band
+     * @param symbols - storage for the extracted soft symbols
+     * @param symbol_rate - recovered symbol rate
+     * @return bool - true if a symbol clock was found
+     */
+    bool recover(const float* data,
+                 size_t length,
+                 float samp_rate,
+                 float min_rate,
+                 float max_rate,
+                 std::vector<float>& symbols,
+                 float& symbol_rate);
+
+private:
+    void debug_pub(pmt::pmt_t port, pmt::pmt_t msg);
+
+    /**
+     * fast sinc table lookup( lanczos windows sinc )
+     *
+     * @param x -
+     * @return float -
+     */
+    float fast_sinc(float x);
+
+    /**
+     * initialize LUT for a lanczos windowed sinc function
+     * note: LUT is one-sided to take advantage of symmetryS
+     */
+    void init_fast_sinc();
+
+    /**
+     * sets up FFT memory space for a given power if needed
+     *
+     * @param power - power of FFT
+     */
+    void fft_setup(int power);
+
+    /**
+     * cleans up all memory associated with FFTs, windows, & mags
+     */
+    void fft_cleanup();
+
+    /**
+     * Calculates the gaussian window value at a specific position
+     *
+     * @param n - total number of samples to calculate over
+     * @param sigma - sigma value
+     * @param x - index/sample to calculate for
+     * @return float - gaussianWindows at x
+     */
+    float gaussianWindow(int n, float sigma, int x);
+
+    /**
+     * Calculates the Tukey window value at a specific position
+     *
+     * @param n - total number of samples to calculate over
+     * @param alpha - alpha value
+     * @param x - index/sample to calculate for
+     * @return float - Tukey at x
+     */
+    float tukeyWindow(int n, float alpha, int x);
+
+    /**
+     * finds zero crossings in the data. Returns a vector of indexes
+     * where zero crossings happen
+     *
+     * @param data - pointer to real waveform
+     * @param len - length of data
+     * @return std::vector<float> - list of zero crossing points
+     */
+    std::vector<float> findZeroCrossings(const float* data, const int len);
+
+    /**
+     * Generates a sync pulse waveform based on zero crossing positions.
+     * This function also selects a portion of the original sample set's
+     * zero crossings to use for the waveform. This resolves the fact
+     * that the FFT size will always be smaller than the sample size
+     *
+     * @param crossings - locations of zero crossings
+     * @param sampLen - original length of sample set
+     * @param out - storage for sync waveform
+     * @param len - max size of storage
+     */
+    void genSincWaveform(std::vector<float> crossings,
+                         const int sampLen,
+                         float* out,
+                         const int len);
+
+    /**
+     * Finds the max fundamental freq present in the FFT magnitude array.
+     *
+     * @param mags - FFT magnitude
+     * @param len - length of mags
+     * @return int - index of mags representing the max fundamental freq
+     */
+    int findMaxFundamental(const float* mags, const int len);
+
+    /**
+     * Interpolates peak bin position
+     *
+     * @param mags - FFT magnitude
+     * @param len - length of mags
+     * @param max_bin - index into mags with max value
+     * @return float - calculated peak bin
+     */
+    float calcPeakBin(const float* mags, const int len, const int max_bin);
+
+    /**
+     * Calculate Peak phase
+     *
+     * @param fft - complex FFT data
+     * @param fftsize - size of fft
+     * @param max_bin - index of max bin
+     * @param peak_bin - calculated peak bin
+     * @return float - phase
+     */
+    float calcPeakPhase(gr_complex* fft,
+                        const int fftsize,
+                        const int max_bin,
+                        const float peak_bin);
+
+    /**
+     * Evaluates the spectrum of the windowed zero crossing waveform at nbins uniformly
+     * spaced frequencies directly from the zero crossing locations. Each crossing is
+     * treated as a unit pulse weighted by the analysis window, so the cost scales
+     * with the number of crossings times the number of bins rather than the FFT size.
+     *
+     * @param crossings - locations of zero crossings
+     * @param window - analysis window, len samples
+     * @param len - length of the analysis window
+     * @param f0 - first frequency to evaluate, cycles/sample
+     * @param df - frequency spacing, cycles/sample
+     * @param nbins - number of frequencies to evaluate
+     * @param out - storage for nbins complex spectrum values
+     */
+    void crossingSpectrum(const std::vector<float>& crossings,
+                          const float* window,
+                          const int len,
+                          const double f0,
+                          const double df,
+                          const int nbins,
+                          gr_complex* out);
+
+    /**
+     * Searches for the symbol frequency within [fmin, fmax] at FFT bin spacing, checks
+     * for a fundamental inside the band, and refines the peak with a zoomed
+     * evaluation around the coarse maximum.
+     *
+     * @param crossings - locations of zero crossings
+     * @param window - analysis window, len samples
+     * @param len - length of the analysis window
+     * @param fmin - lower bound of search band, cycles/sample
+     * @param fmax - upper bound of search band, cycles/sample
+     * @param symbol_freq - calculated symbol frequency
+     * @param phase - calculated phase of symbol frequency
+     * @return bool - true if a peak was found
+     */
+    bool bandSearch(const std::vector<float>& crossings,
+                    const float* window,
+                    const int len,
+                    const double fmin,
+                    const double fmax,
+                    float& symbol_freq,
+                    float& phase);
+
+    /**
+     * Extracts symbols from the original input data.
+     *
+     * @param data - input data buffer
+     * @param len - length of data
+     * @param symbol_freq - calculated symbol frequency
+     * @param phase - calculated phase of symbol frequency
+     * @param offset - sample offset used by genSincWaveform. Used for phase correction
+     * @param ans - storage for the extracted symbols, cleared first
+     */
+    void extractSymbols(const float* data,
+                        const int len,
+                        const float symbol_freq,
+                        const float phase,
+                        const int offset,
+                        std::vector<float>& ans);
+
+}; // end class clock_recovery_kernel
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_CLOCK_RECOVERY_KERNEL_H */
@@ -284,6 +284,56 @@ const pmt::pmt_t PMTCONSTSTR__bit_index()
     static const pmt::pmt_t val = pmt::mp("bit_index");
     return val;
 }
+const pmt::pmt_t PMTCONSTSTR__symbol_rate_min()
+{
+    static const pmt::pmt_t val = pmt::mp("symbol_rate_min");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__symbol_rate_max()
+{
+    static const pmt::pmt_t val = pmt::mp("symbol_rate_max");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__demod()
+{
+    static const pmt::pmt_t val = pmt::mp("demod");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__filtered()
+{
+    static const pmt::pmt_t val = pmt::mp("filtered");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__realization()
+{
+    static const pmt::pmt_t val = pmt::mp("realization");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__center_frequency()
+{
+    static const pmt::pmt_t val = pmt::mp("center_frequency");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__channel()
+{
+    static const pmt::pmt_t val = pmt::mp("channel");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__delay()
+{
+    static const pmt::pmt_t val = pmt::mp("delay");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__time_in()
+{
+    static const pmt::pmt_t val = pmt::mp("time_in");
+    return val;
+}
+const pmt::pmt_t PMTCONSTSTR__time_out()
+{
+    static const pmt::pmt_t val = pmt::mp("time_out");
+    return val;
+}
 
 
 } /* namespace pdu_utils */
@@ -12,31 +12,47 @@
 #endif
 
 #include "pdu_add_noise_impl.h"
+#include "pdu_view.h"
 #include <gnuradio/io_signature.h>
 
+#include <algorithm>
+
 namespace gr {
 namespace pdu_utils {
 
-pdu_add_noise::sptr
-pdu_add_noise::make(float noise_level, float offset, float scale, long seed, int dist)
+pdu_add_noise::sptr pdu_add_noise::make(float noise_level,
+                                        float offset,
+                                        float scale,
+                                        long seed,
+                                        int dist,
+                                        int realizations,
+                                        bool fast_rng)
 {
     return gnuradio::make_block_sptr<pdu_add_noise_impl>(
-        noise_level, offset, scale, seed, dist);
+        noise_level, offset, scale, seed, dist, realizations, fast_rng);
 }
 
 /*
  * The private constructor
  */
-pdu_add_noise_impl::pdu_add_noise_impl(
-    float noise_level, float offset, float scale, long seed, int dist)
+pdu_add_noise_impl::pdu_add_noise_impl(float noise_level,
+                                       float offset,
+                                       float scale,
+                                       long seed,
+                                       int dist,
+                                       int realizations,
+                                       bool fast_rng)
     : gr::block(
           "pdu_add_noise", io_signature::make(0, 0, 0), io_signature::make(0, 0, 0)),
       d_offset(offset),
       d_scale(scale),
-      d_rng(seed)
+      d_rng(seed),
+      d_fast_rng(seed),
+      d_fast(fast_rng)
 {
     set_noise_dist(dist);
     set_noise_level(noise_level);
+    set_realizations(realizations);
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_msg(msg); });
@@ -59,69 +75,87 @@ void pdu_add_noise_impl::handle_msg(pmt::pmt_t pdu)
 
     gr::thread::scoped_lock l(d_setlock);
 
-    /* code */
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    if (pmt::is_u8vector(v_data)) {
-        const std::vector<uint8_t> input = pmt::u8vector_elements(v_data);
-        uint32_t v_len = input.size();
-        std::vector<uint8_t> out;
-        out.resize(v_len);
-
-        for (size_t ii = 0; ii < v_len; ii++) {
-            // u8 noise is [0-1]
-            out[ii] = uint8_t(
-                (input[ii] + (((get_rand_samp() + 1) / 2) * d_noise_level)) * d_scale +
-                d_offset);
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         (pmt::cons(meta, pmt::init_u8vector(v_len, out))));
-
-    } else if (pmt::is_f32vector(v_data)) {
-        const std::vector<float> input = pmt::f32vector_elements(v_data);
-        uint32_t v_len = input.size();
-        std::vector<float> out;
-        out.resize(v_len);
-
-        for (size_t ii = 0; ii < v_len; ii++) {
-            out[ii] =
-                (input[ii] + (get_rand_samp() * d_noise_level)) * d_scale + d_offset;
+    for (int k = 0; k < d_realizations; k++) {
+        pmt::pmt_t out_meta = meta;
+        if (d_realizations > 1 && pmt::is_dict(meta)) {
+            out_meta = pmt::dict_add(meta, PMTCONSTSTR__realization(), pmt::from_long(k));
         }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         (pmt::cons(meta, pmt::init_f32vector(v_len, out))));
-
-    } else if (pmt::is_c32vector(v_data)) {
-        const std::vector<gr_complex> input = pmt::c32vector_elements(v_data);
-        uint32_t v_len = input.size();
-        std::vector<gr_complex> out;
-        out.resize(v_len);
-
-        for (size_t ii = 0; ii < v_len; ii++) {
-            out[ii].real((input[ii].real() + (get_rand_samp() * d_complex_nl)) * d_scale +
-                         d_offset);
-            out[ii].imag((input[ii].imag() + (get_rand_samp() * d_complex_nl)) * d_scale +
-                         d_offset);
+
+        bool handled =
+            pdu_dispatch<uint8_t, float, gr_complex>(v_data, [&](auto input) {
+                typedef typename decltype(input)::value_type T;
+                pdu_builder<T> out(input.size());
+                add_noise(out.data(), input.data(), input.size());
+                message_port_pub(PMTCONSTSTR__pdu_out(),
+                                 pmt::cons(out_meta, out.release()));
+            });
+
+        if (!handled) {
+            GR_LOG_WARN(d_logger, "unsupported PDU type received");
+            return;
         }
+    }
+}
 
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         (pmt::cons(meta, pmt::init_c32vector(v_len, out))));
+void pdu_add_noise_impl::add_noise(uint8_t* out, const uint8_t* in, size_t n)
+{
+    d_noise.resize(n);
+    fill_noise(d_noise.data(), n);
+    for (size_t ii = 0; ii < n; ii++) {
+        // u8 noise is [0-1]
+        out[ii] = uint8_t(
+            (in[ii] + (((d_noise[ii] + 1) / 2) * d_noise_level)) * d_scale + d_offset);
+    }
+}
 
-    } else {
-        GR_LOG_WARN(d_logger, "unsupported PDU type received");
+void pdu_add_noise_impl::add_noise(float* out, const float* in, size_t n)
+{
+    d_noise.resize(n);
+    fill_noise(d_noise.data(), n);
+    for (size_t ii = 0; ii < n; ii++) {
+        out[ii] = (in[ii] + (d_noise[ii] * d_noise_level)) * d_scale + d_offset;
     }
 }
 
-float pdu_add_noise_impl::get_rand_samp()
+void pdu_add_noise_impl::add_noise(gr_complex* out, const gr_complex* in, size_t n)
 {
-    float r_samp = 0;
-    if (d_noise_dist == UNIFORM) {
-        r_samp = d_rng.ran1() * 2 - 1;
-    } else if (d_noise_dist == GAUSSIAN) {
-        r_samp = d_rng.gasdev();
+    // real and imaginary parts are interleaved, noise is drawn in the same order
+    const float* in_f = (const float*)in;
+    float* out_f = (float*)out;
+    n *= 2;
+    d_noise.resize(n);
+    fill_noise(d_noise.data(), n);
+    for (size_t ii = 0; ii < n; ii++) {
+        out_f[ii] = (in_f[ii] + (d_noise[ii] * d_complex_nl)) * d_scale + d_offset;
     }
+}
 
-    return r_samp;
+/*
+ * Generates n noise samples for the selected distribution, uniform noise is in
+ * [-1, 1) and gaussian noise has unit variance
+ */
+void pdu_add_noise_impl::fill_noise(float* out, size_t n)
+{
+    if (d_noise_dist != UNIFORM && d_noise_dist != GAUSSIAN) {
+        std::fill(out, out + n, 0.0f);
+    } else if (d_fast) {
+        if (d_noise_dist == UNIFORM) {
+            d_fast_rng.fill_uniform(out, n);
+        } else {
+            d_fast_rng.fill_gaussian(out, n);
+        }
+    } else if (d_noise_dist == UNIFORM) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = d_rng.ran1() * 2 - 1;
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = d_rng.gasdev();
+        }
+    }
 }
 
 void pdu_add_noise_impl::set_noise_level(float nl)
@@ -156,6 +190,23 @@ void pdu_add_noise_impl::set_seed(int x)
 {
     gr::thread::scoped_lock l(d_setlock);
     d_rng.reseed(x);
+    d_fast_rng.reseed(x);
+}
+
+void pdu_add_noise_impl::set_realizations(int n)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    if (n < 1) {
+        GR_LOG_WARN(d_logger, "realizations must be at least 1, using 1");
+        n = 1;
+    }
+    d_realizations = n;
+}
+
+void pdu_add_noise_impl::set_fast_rng(bool fast)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_fast = fast;
 }
 
 } /* namespace pdu_utils */
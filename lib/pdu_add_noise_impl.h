@@ -10,6 +10,7 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_ADD_NOISE_IMPL_H
 #define INCLUDED_PDU_UTILS_PDU_ADD_NOISE_IMPL_H
 
+#include "batch_rng.h"
 #include <gnuradio/random.h>
 #include <gnuradio/pdu_utils/constants.h>
 #include <gnuradio/pdu_utils/pdu_add_noise.h>
@@ -25,13 +26,26 @@ private:
     float d_offset;
     float d_scale;
     gr::random d_rng;
+    batch_rng d_fast_rng;
     noise_dist d_noise_dist;
+    int d_realizations;
+    bool d_fast;
+    std::vector<float> d_noise;
 
-    float get_rand_samp();
+    void fill_noise(float* out, size_t n);
+    void add_noise(uint8_t* out, const uint8_t* in, size_t n);
+    void add_noise(float* out, const float* in, size_t n);
+    void add_noise(gr_complex* out, const gr_complex* in, size_t n);
     void handle_msg(pmt::pmt_t pdu);
 
 public:
-    pdu_add_noise_impl(float noise_level, float offset, float scale, long seed, int dist);
+    pdu_add_noise_impl(float noise_level,
+                       float offset,
+                       float scale,
+                       long seed,
+                       int dist,
+                       int realizations,
+                       bool fast_rng);
 
     ~pdu_add_noise_impl();
 
@@ -40,6 +54,8 @@ public:
     void set_scale(float s) override;
     void set_noise_dist(int d) override;
     void set_seed(int x) override;
+    void set_realizations(int n) override;
+    void set_fast_rng(bool fast) override;
 };
 
 } // namespace pdu_utils
@@ -12,8 +12,11 @@
 #endif
 
 #include "pdu_binary_tools_impl.h"
+#include "pdu_view.h"
 #include "gnuradio/pdu_utils/constants.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <type_traits>
 
 namespace gr {
 namespace pdu_utils {
@@ -121,17 +124,18 @@ void pdu_binary_tools_impl::handle_msg_bit_flip(pmt::pmt_t pdu)
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     // extract uint8 data
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> data = pmt::u8vector_elements(v_data);
+    if (pdu_vector_traits<uint8_t>::is(v_data)) {
+        pdu_view<uint8_t> in_data(v_data);
+        pdu_builder<uint8_t> out_data(in_data.size());
 
         // flip every bit (xor)
-        std::transform(data.begin(), data.end(), data.begin(), [](uint8_t x) -> uint8_t {
-            return x ^ 1;
-        });
+        std::transform(in_data.begin(),
+                       in_data.end(),
+                       out_data.begin(),
+                       [](uint8_t x) -> uint8_t { return x ^ 1; });
 
         // publish the new pdu
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         (pmt::cons(meta, pmt::init_u8vector(data.size(), data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
     } else {
         GR_LOG_WARN(d_logger, "Failed to bit flip the data because it is not a u8vector");
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
@@ -154,9 +158,9 @@ void pdu_binary_tools_impl::handle_msg_to_nrz(pmt::pmt_t pdu)
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     // extract data
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<float> out_data(in_data.size());
+    if (pdu_vector_traits<uint8_t>::is(v_data)) {
+        pdu_view<uint8_t> in_data(v_data);
+        pdu_builder<float> out_data(in_data.size());
 
         // 1*2-1 = 1 and 0*2-1 = -1
         std::transform(in_data.begin(),
@@ -165,9 +169,7 @@ void pdu_binary_tools_impl::handle_msg_to_nrz(pmt::pmt_t pdu)
                        [](uint8_t x) -> float { return (x * 2) - 1; });
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_f32vector(out_data.size(), out_data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
     } else {
         GR_LOG_WARN(d_logger, "Failed to 'to nrz' the data because it is not a u8vector");
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
@@ -190,9 +192,9 @@ void pdu_binary_tools_impl::handle_msg_from_nrz(pmt::pmt_t pdu)
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     // extract data
-    if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<uint8_t> out_data(in_data.size());
+    if (pdu_vector_traits<float>::is(v_data)) {
+        pdu_view<float> in_data(v_data);
+        pdu_builder<uint8_t> out_data(in_data.size());
 
         // (1+1)/2=1 and (-1+1)/2=0
         std::transform(in_data.begin(),
@@ -201,9 +203,7 @@ void pdu_binary_tools_impl::handle_msg_from_nrz(pmt::pmt_t pdu)
                        [](float x) -> uint8_t { return (x + 1) / 2; });
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
     } else {
         GR_LOG_WARN(d_logger,
                     "Failed to 'from nrz' the data because it is not a f32 vector");
@@ -227,20 +227,18 @@ void pdu_binary_tools_impl::handle_msg_slice(pmt::pmt_t pdu)
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     // extract data
-    if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<uint8_t> out_data(in_data.size());
+    if (pdu_vector_traits<float>::is(v_data)) {
+        pdu_view<float> in_data(v_data);
+        pdu_builder<uint8_t> out_data(in_data.size());
 
-        // flip every bit (xor)
+        // threshold at zero
         std::transform(in_data.begin(),
                        in_data.end(),
                        out_data.begin(),
                        [](float x) -> uint8_t { return x > 0; });
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
     } else {
         GR_LOG_WARN(d_logger, "Failed to 'slice' the data because it is not a f32vector");
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
@@ -262,9 +260,9 @@ void pdu_binary_tools_impl::handle_msg_endian8(pmt::pmt_t pdu)
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     // extract uint8 data
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> out_data(in_data.size());
+    if (pdu_vector_traits<uint8_t>::is(v_data)) {
+        pdu_view<uint8_t> in_data(v_data);
+        pdu_builder<uint8_t> out_data(in_data.size());
 
         size_t div8 = in_data.size() / 8;
         // read 8 bits, write them in reverse order
@@ -275,9 +273,7 @@ void pdu_binary_tools_impl::handle_msg_endian8(pmt::pmt_t pdu)
         }
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
     } else {
         GR_LOG_WARN(d_logger,
                     "Failed to endian-swap the data because it is not a u8vector");
@@ -302,10 +298,11 @@ void pdu_binary_tools_impl::handle_msg_manchester_decode(pmt::pmt_t pdu)
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    // extract uint8 data
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> out_data(in_data.size() >> 1, 0);
+    // u8 outputs are 0/1, float outputs are -1/1
+    bool handled = pdu_dispatch<uint8_t, float>(v_data, [&](auto in_data) {
+        typedef typename decltype(in_data)::value_type T;
+        const T zero = std::is_same<T, float>::value ? -1 : 0;
+        pdu_builder<T> out_data(in_data.size() >> 1, zero);
 
         for (size_t i = 0; i < out_data.size(); ++i) {
             if (in_data[2 * i + 1] < in_data[2 * i]) {
@@ -315,26 +312,10 @@ void pdu_binary_tools_impl::handle_msg_manchester_decode(pmt::pmt_t pdu)
         }
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
-    } else if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<float> out_data(in_data.size() >> 1, -1);
-
-        for (size_t i = 0; i < out_data.size(); ++i) {
-            if (in_data[2 * i + 1] < in_data[2 * i]) {
-                // 1->0 transition
-                out_data[i] = 1;
-            }
-        }
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
+    });
 
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_f32vector(out_data.size(), out_data))));
-
-    } else {
+    if (!handled) {
         GR_LOG_WARN(
             d_logger,
             "Failed to manchester decode the data because it is not a u8vector or float");
@@ -358,45 +339,27 @@ void pdu_binary_tools_impl::handle_msg_manchester_encode(pmt::pmt_t pdu)
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    // extract uint8 data
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> out_data(2 * in_data.size(), 0);
-
-        for (size_t i = 0; i < in_data.size(); ++i) {
-            if (in_data[i]) {
-                out_data[2 * i] = 1;
-                out_data[2 * i + 1] = 0;
-            } else {
-                out_data[2 * i] = 0;
-                out_data[2 * i + 1] = 1;
-            }
-        }
-
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
-    } else if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<float> out_data(2 * in_data.size(), 0);
+    // u8 inputs are 0/1, float inputs are sliced at zero and encoded as -1/1
+    bool handled = pdu_dispatch<uint8_t, float>(v_data, [&](auto in_data) {
+        typedef typename decltype(in_data)::value_type T;
+        const T zero = std::is_same<T, float>::value ? -1 : 0;
+        pdu_builder<T> out_data(2 * in_data.size());
 
         for (size_t i = 0; i < in_data.size(); ++i) {
             if (in_data[i] > 0) {
                 out_data[2 * i] = 1;
-                out_data[2 * i + 1] = -1;
+                out_data[2 * i + 1] = zero;
             } else {
-                out_data[2 * i] = -1;
+                out_data[2 * i] = zero;
                 out_data[2 * i + 1] = 1;
             }
         }
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_f32vector(out_data.size(), out_data))));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
+    });
 
-    } else {
+    if (!handled) {
         GR_LOG_WARN(d_logger,
                     "Failed to endian-swap the data because it is not a u8vector");
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
@@ -15,28 +15,35 @@
 #include "gnuradio/pdu_utils/constants.h"
 #include <gnuradio/io_signature.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 
 namespace gr {
 namespace pdu_utils {
 
-pdu_burst_combiner::sptr pdu_burst_combiner::make()
+// longest single wait, so a new timeout is picked up and stop() is never delayed
+static const int64_t MAX_WAIT_US = 100000;
+
+pdu_burst_combiner::sptr pdu_burst_combiner::make(double timeout, uint64_t max_samples)
 {
-    return gnuradio::make_block_sptr<pdu_burst_combiner_impl>();
+    return gnuradio::make_block_sptr<pdu_burst_combiner_impl>(timeout, max_samples);
 }
 
 /*
  * The private constructor
  */
-pdu_burst_combiner_impl::pdu_burst_combiner_impl()
+pdu_burst_combiner_impl::pdu_burst_combiner_impl(double timeout, uint64_t max_samples)
     : gr::block("pdu_burst_combiner",
                 gr::io_signature::make(0, 0, 0),
-                gr::io_signature::make(0, 0, 0))
+                gr::io_signature::make(0, 0, 0)),
+      d_buffered_samples(0),
+      d_timeout(timeout),
+      d_max_samples(max_samples),
+      d_n_dropped(0),
+      d_finished(true)
 {
-
-    reset_state();
-
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
@@ -46,7 +53,62 @@ pdu_burst_combiner_impl::pdu_burst_combiner_impl()
 /*
  * Our virtual destructor.
  */
-pdu_burst_combiner_impl::~pdu_burst_combiner_impl() {}
+pdu_burst_combiner_impl::~pdu_burst_combiner_impl() { stop_thread(); }
+
+bool pdu_burst_combiner_impl::start()
+{
+    gr::thread::scoped_lock l(d_setlock);
+    if (!d_thread) {
+        d_finished = false;
+        d_thread = std::make_shared<gr::thread::thread>([this]() { this->run(); });
+    }
+    return block::start();
+}
+
+bool pdu_burst_combiner_impl::stop()
+{
+    stop_thread();
+
+    // no further fragments will arrive, so partial bursts can never complete
+    gr::thread::scoped_lock l(d_setlock);
+    while (!d_bursts.empty()) {
+        drop_burst(d_bursts.begin(), "flowgraph stopped");
+    }
+    return block::stop();
+}
+
+void pdu_burst_combiner_impl::stop_thread()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_setlock);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void pdu_burst_combiner_impl::set_timeout(double timeout)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_timeout = timeout;
+    d_cond.notify_all();
+}
+
+void pdu_burst_combiner_impl::set_max_samples(uint64_t max_samples)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_max_samples = max_samples;
+}
+
+uint64_t pdu_burst_combiner_impl::get_n_dropped()
+{
+    gr::thread::scoped_lock l(d_setlock);
+    return d_n_dropped;
+}
 
 
 /*
@@ -60,24 +122,21 @@ void pdu_burst_combiner_impl::handle_pdu(pmt::pmt_t pdu)
         return;
     }
 
-    /* code */
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-
     if (!(is_dict(meta) && pmt::is_c32vector(v_data))) {
         GR_LOG_WARN(d_logger, "PMT is not a complex PDU, dropping");
         return;
     }
 
-    uint32_t v_len = pmt::length(v_data);
+    uint64_t v_len = pmt::length(v_data);
 
     if (v_len == 0) {
         GR_LOG_WARN(d_logger, "Zero length PDU, ignoring");
         return;
     }
 
-
     // get the burst index, or a (0, 0) tuple if not present (regular burst)
     pmt::pmt_t burst_index =
         pmt::dict_ref(meta,
@@ -86,77 +145,171 @@ void pdu_burst_combiner_impl::handle_pdu(pmt::pmt_t pdu)
     uint64_t x = pmt::to_uint64(pmt::car(burst_index));
     uint64_t y = pmt::to_uint64(pmt::cdr(burst_index));
 
-    if (d_burst_count != 0) {
-        // we are in the middle of processing bursts...
-        if (x > y) {
-            // error...bad
-            GR_LOG_ALERT(
-                d_logger,
-                boost::format("Error processing PDU, burst_index metadata invalid (%)") %
-                    burst_index);
-            GR_LOG_ERROR(d_logger, "resetting state and dropping PDU");
-            reset_state();
-        } else if (x < y) {
-            // not the last burst in the string
-            const std::vector<gr_complex> d_in = pmt::c32vector_elements(v_data);
-            d_data.insert(d_data.end(), d_in.begin(), d_in.end());
-            GR_LOG_DEBUG(d_logger,
-                         boost::format("saving PDU %d / %d! size is %d") % x % y %
-                             d_data.size());
-
-        } else {
-            // done with the burst, add new stuff and send it
-            const std::vector<gr_complex> d_in = pmt::c32vector_elements(v_data);
-            d_data.insert(d_data.end(), d_in.begin(), d_in.end());
-            GR_LOG_DEBUG(d_logger,
-                         boost::format("saving PDU %d / %d! size is %d") % x % y %
-                             d_data.size());
-
-            message_port_pub(
-                PMTCONSTSTR__pdu_out(),
-                pmt::cons(
-                    d_burst0_metadata,
-                    pmt::init_c32vector(d_data.size(), (const gr_complex*)&d_data[0])));
-            reset_state();
+    if (y <= 1 && x <= 1) {
+        // this is the first and only burst, send it as is
+        message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
+        return;
+    }
+
+    gr::thread::scoped_lock l(d_setlock);
+
+    clock::time_point now = clock::now();
+    expire_bursts(now);
+
+    // fragments are grouped by burst id, without one all fragments share a group
+    pmt::pmt_t id = pmt::dict_ref(meta, PMTCONSTSTR__burst_id(), pmt::PMT_NIL);
+    burst_key key(false, 0);
+    if (pmt::is_uint64(id) || (pmt::is_integer(id) && pmt::to_long(id) >= 0)) {
+        key = burst_key(true, pmt::to_uint64(id));
+    }
+    auto it = d_bursts.find(key);
+
+    if (x == 0 || x > y) {
+        GR_LOG_ALERT(
+            d_logger,
+            boost::format("Error processing PDU, burst_index metadata invalid (%s)") %
+                burst_index);
+        GR_LOG_ERROR(d_logger, "resetting state and dropping PDU");
+        if (it != d_bursts.end()) {
+            drop_burst(it, "invalid burst_index");
         }
-    } else {
-        // this is the first burst
-        if (y > 1) {
-            // and there are multiple bursts
-            if (x == 1) {
-                reset_state();
-                const std::vector<gr_complex> d_in = pmt::c32vector_elements(v_data);
-                d_data.insert(d_data.end(), d_in.begin(), d_in.end());
-                GR_LOG_DEBUG(d_logger,
-                             boost::format("saving PDU %d / %d! size is %d") % x % y %
-                                 d_data.size());
-
-                d_burst_count = y;
-                d_burst0_metadata = meta;
-
-            } else {
-                GR_LOG_ERROR(d_logger,
-                             "Error processing PDU, first burst does not have index = 1");
-                GR_LOG_ERROR(d_logger, "resetting state and dropping PDU");
-                reset_state();
+        return;
+    }
+
+    // a fragment that does not fit the partial burst starts a new one
+    if (it != d_bursts.end() && (it->second.fragments.size() != y ||
+                                 !pmt::is_null(it->second.fragments[x - 1]))) {
+        drop_burst(it, "restarted");
+        it = d_bursts.end();
+    }
+    if (it == d_bursts.end()) {
+        partial_burst burst;
+        burst.fragments.assign(y, pmt::PMT_NIL);
+        burst.n_received = 0;
+        burst.n_samples = 0;
+        burst.first_update = now;
+        it = d_bursts.emplace(key, std::move(burst)).first;
+        d_cond.notify_all();
+    }
+
+    partial_burst& burst = it->second;
+    burst.fragments[x - 1] = pdu;
+    burst.n_received++;
+    burst.n_samples += v_len;
+    burst.last_update = now;
+    d_buffered_samples += v_len;
+    GR_LOG_DEBUG(d_logger,
+                 boost::format("saving PDU %d / %d! size is %d") % x % y %
+                     burst.n_samples);
+
+    if (burst.n_received == y) {
+        publish_burst(burst);
+        d_buffered_samples -= burst.n_samples;
+        d_bursts.erase(it);
+        return;
+    }
+
+    // enforce the memory limit by dropping the oldest partial bursts
+    while (d_max_samples && d_buffered_samples > d_max_samples && !d_bursts.empty()) {
+        auto oldest = d_bursts.begin();
+        for (auto b = d_bursts.begin(); b != d_bursts.end(); b++) {
+            if (b->second.first_update < oldest->second.first_update) {
+                oldest = b;
             }
-        } else {
-            // this is the first and only burst, send it as is
-            message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
-            reset_state();
         }
+        drop_burst(oldest, "buffer limit reached");
+    }
+}
+
+
+/*
+ * copy all fragments of a complete burst into a single output PDU
+ */
+void pdu_burst_combiner_impl::publish_burst(const partial_burst& burst)
+{
+    pmt::pmt_t out_vector = pmt::make_c32vector(burst.n_samples, 0);
+    size_t out_len;
+    gr_complex* out = pmt::c32vector_writable_elements(out_vector, out_len);
+
+    for (const pmt::pmt_t& fragment : burst.fragments) {
+        size_t len;
+        const gr_complex* in = pmt::c32vector_elements(pmt::cdr(fragment), len);
+        memcpy(out, in, len * sizeof(gr_complex));
+        out += len;
+    }
+
+    message_port_pub(PMTCONSTSTR__pdu_out(),
+                     pmt::cons(pmt::car(burst.fragments[0]), out_vector));
+}
+
+
+/*
+ * drop partial bursts that have not been updated within the timeout
+ */
+void pdu_burst_combiner_impl::expire_bursts(clock::time_point now)
+{
+    if (d_timeout <= 0) {
+        return;
+    }
+    auto it = d_bursts.begin();
+    while (it != d_bursts.end()) {
+        auto next = std::next(it);
+        if (std::chrono::duration<double>(now - it->second.last_update).count() >=
+            d_timeout) {
+            drop_burst(it, "timed out");
+        }
+        it = next;
     }
 }
 
 
 /*
- * reset the state of the block
+ * discard a partial burst
  */
-void pdu_burst_combiner_impl::reset_state(void)
+void pdu_burst_combiner_impl::drop_burst(std::map<burst_key, partial_burst>::iterator it,
+                                         const char* reason)
 {
-    d_burst_count = 0;
-    d_burst0_metadata = pmt::PMT_NIL;
-    d_data.clear();
+    d_n_dropped++;
+    GR_LOG_WARN(d_logger,
+                boost::format("dropping partial burst with %d of %d fragments, %s "
+                              "(%d dropped)") %
+                    it->second.n_received % it->second.fragments.size() % reason %
+                    d_n_dropped);
+    d_buffered_samples -= it->second.n_samples;
+    d_bursts.erase(it);
+}
+
+
+/*
+ * drops timed out partial bursts while no fragments are arriving
+ */
+void pdu_burst_combiner_impl::run()
+{
+    gr::thread::scoped_lock l(d_setlock);
+    while (!d_finished) {
+        if (d_bursts.empty() || d_timeout <= 0) {
+            d_cond.timed_wait(l, boost::posix_time::microseconds(MAX_WAIT_US));
+            continue;
+        }
+
+        clock::time_point oldest = d_bursts.begin()->second.last_update;
+        for (const auto& b : d_bursts) {
+            oldest = std::min(oldest, b.second.last_update);
+        }
+        clock::time_point deadline =
+            oldest + std::chrono::duration_cast<clock::duration>(
+                         std::chrono::duration<double>(d_timeout));
+        int64_t remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                                deadline - clock::now())
+                                .count();
+        if (remaining > 0) {
+            d_cond.timed_wait(
+                l, boost::posix_time::microseconds(std::min(remaining, MAX_WAIT_US)));
+            continue;
+        }
+
+        expire_bursts(clock::now());
+    }
 }
 
 } /* namespace pdu_utils */
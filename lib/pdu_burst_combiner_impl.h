@@ -13,23 +13,58 @@
 #include <gnuradio/pdu_utils/constants.h>
 #include <gnuradio/pdu_utils/pdu_burst_combiner.h>
 
+#include <chrono>
+#include <map>
+#include <memory>
+
 namespace gr {
 namespace pdu_utils {
 
 class pdu_burst_combiner_impl : public pdu_burst_combiner
 {
 private:
-    std::vector<gr_complex> d_data;
-    pmt::pmt_t d_burst0_metadata;
-    uint32_t d_burst_count;
+    typedef std::chrono::steady_clock clock;
+
+    // fragments of one burst, held by reference until the burst is complete
+    struct partial_burst {
+        std::vector<pmt::pmt_t> fragments;
+        uint64_t n_received;
+        uint64_t n_samples;
+        clock::time_point first_update;
+        clock::time_point last_update;
+    };
+
+    // (has burst_id, burst_id), fragments without an integer id share one group
+    typedef std::pair<bool, uint64_t> burst_key;
+
+    std::map<burst_key, partial_burst> d_bursts;
+    uint64_t d_buffered_samples;
+    double d_timeout;
+    uint64_t d_max_samples;
+    uint64_t d_n_dropped;
 
-    void reset_state(void);
+    gr::thread::condition_variable d_cond;
+    bool d_finished;
+    std::shared_ptr<gr::thread::thread> d_thread;
+
+    void drop_burst(std::map<burst_key, partial_burst>::iterator it, const char* reason);
+    void expire_bursts(clock::time_point now);
+    void publish_burst(const partial_burst& burst);
     void handle_pdu(pmt::pmt_t pdu);
+    void run();
+    void stop_thread();
 
 public:
-    pdu_burst_combiner_impl();
+    pdu_burst_combiner_impl(double timeout, uint64_t max_samples);
 
     ~pdu_burst_combiner_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    void set_timeout(double timeout) override;
+    void set_max_samples(uint64_t max_samples) override;
+    uint64_t get_n_dropped() override;
 };
 
 } // namespace pdu_utils
@@ -0,0 +1,306 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_burst_demod_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <volk/volk.h>
+
+#include <algorithm>
+
+// conjugate products are computed in blocks of this many samples
+#define BURST_DEMOD_CHUNK 1024
+
+namespace gr {
+namespace pdu_utils {
+
+pdu_burst_demod::sptr pdu_burst_demod::make(float sensitivity,
+                                            const std::vector<float> taps,
+                                            int decimation,
+                                            bool remove_dc,
+                                            bool binary_slice,
+                                            bool debug,
+                                            window_type type,
+                                            float min_symbol_rate,
+                                            float max_symbol_rate)
+{
+    return gnuradio::make_block_sptr<pdu_burst_demod_impl>(sensitivity,
+                                                           taps,
+                                                           decimation,
+                                                           remove_dc,
+                                                           binary_slice,
+                                                           debug,
+                                                           type,
+                                                           min_symbol_rate,
+                                                           max_symbol_rate);
+}
+
+/*
+ * The private constructor
+ */
+pdu_burst_demod_impl::pdu_burst_demod_impl(float sensitivity,
+                                           const std::vector<float> taps,
+                                           int decimation,
+                                           bool remove_dc,
+                                           bool binary_slice,
+                                           bool debug,
+                                           window_type type,
+                                           float min_symbol_rate,
+                                           float max_symbol_rate)
+    : gr::block("pdu_burst_demod",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_sensitivity(sensitivity),
+      d_remove_dc(remove_dc),
+      d_fir(std::vector<float>(1, 1.0f)),
+      d_decimation(1),
+      d_binary_slice(binary_slice),
+      d_debug(debug),
+      d_min_symbol_rate(min_symbol_rate),
+      d_max_symbol_rate(max_symbol_rate),
+      d_kernel(d_logger, debug, type)
+{
+    set_taps(taps);
+    set_decimation(decimation);
+
+    // to avoid memory access issues within the filterNdec function of gnuradio
+    // pad the input at the front and back based on the volk alignment
+    d_pad = volk_get_alignment() / sizeof(float);
+
+    d_prod = (gr_complex*)volk_malloc(sizeof(gr_complex) * BURST_DEMOD_CHUNK,
+                                      volk_get_alignment());
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+    if (d_debug) {
+        message_port_register_out(PMTCONSTSTR__demod());
+        message_port_register_out(PMTCONSTSTR__filtered());
+        message_port_register_out(PMTCONSTSTR__debug());
+        message_port_register_out(PMTCONSTSTR__zeroX());
+        message_port_register_out(PMTCONSTSTR__window());
+        d_kernel.set_debug_handler([this](pmt::pmt_t port, pmt::pmt_t msg) {
+            this->message_port_pub(port, msg);
+        });
+    }
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_burst_demod_impl::~pdu_burst_demod_impl() { volk_free(d_prod); }
+
+void pdu_burst_demod_impl::set_sensitivity(float sensitivity)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_sensitivity = sensitivity;
+}
+
+void pdu_burst_demod_impl::set_remove_dc(bool remove_dc)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_remove_dc = remove_dc;
+}
+
+void pdu_burst_demod_impl::set_taps(std::vector<float> taps)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    if (taps.empty()) {
+        taps.push_back(1.0f);
+    }
+    d_unity_taps = (taps.size() == 1 && taps[0] == 1.0f);
+    d_fir.set_taps(taps);
+
+    size_t tap_len = taps.size();
+    if (tap_len % 2) {
+        d_group_delay_offset = (tap_len - 1) / 2;
+        d_even_num_taps = false;
+    } else {
+        d_group_delay_offset = (tap_len) / 2;
+        d_even_num_taps = true;
+    }
+}
+
+void pdu_burst_demod_impl::set_decimation(int decimation)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    if (decimation < 1) {
+        GR_LOG_WARN(d_logger, "decimation must be at least 1, using 1");
+        decimation = 1;
+    }
+    d_decimation = decimation;
+}
+
+void pdu_burst_demod_impl::set_symbol_rate_range(float min_symbol_rate,
+                                                 float max_symbol_rate)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_min_symbol_rate = min_symbol_rate;
+    d_max_symbol_rate = max_symbol_rate;
+}
+
+void pdu_burst_demod_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    // make sure PDU data is formed properly
+    if (!(pmt::is_pair(pdu))) {
+        GR_LOG_NOTICE(d_logger, "received unexpected PMT (non-pair)");
+        return;
+    }
+
+    pmt::pmt_t metadata = pmt::car(pdu);
+    pmt::pmt_t samples = pmt::cdr(pdu);
+
+    if (!pmt::is_dict(metadata)) {
+        GR_LOG_WARN(d_logger, "PDU metadata is not a dict, dropping");
+        return;
+    }
+    if (!pmt::is_c32vector(samples)) {
+        GR_LOG_WARN(d_logger, "PDU data is not a c32vector, dropping");
+        return;
+    }
+    pmt::pmt_t pmt_samp_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL);
+    if (!pmt::is_number(pmt_samp_rate)) {
+        GR_LOG_WARN(d_logger, "no sample rate, dropping");
+        return;
+    }
+    double sample_rate = pmt::to_double(pmt_samp_rate);
+
+    size_t burst_size;
+    const gr_complex* burst = pmt::c32vector_elements(samples, burst_size);
+    // one sample is consumed by the conjugate multiply
+    size_t n_demod = (burst_size > 0) ? burst_size - 1 : 0;
+
+    gr::thread::scoped_lock l(d_setlock);
+
+    if (n_demod <= d_fir.ntaps()) {
+        // not enough data to process
+        return;
+    }
+
+    if (d_debug) {
+        uint64_t burst_id = 0;
+        pmt::pmt_t id = pmt::dict_ref(metadata, PMTCONSTSTR__burst_id(), pmt::PMT_NIL);
+        if (pmt::is_uint64(id)) {
+            burst_id = pmt::to_uint64(id);
+        }
+        d_kernel.set_burst_id(burst_id);
+    }
+
+    /*
+     * Quadrature demodulation, written directly into the filter input buffer between
+     * the alignment padding and the group delay zeros so no copy is needed before
+     * filtering.
+     */
+    const size_t lead = d_pad + d_group_delay_offset;
+    d_fir_in.resize(n_demod + 2 * lead);
+    std::fill(d_fir_in.begin(), d_fir_in.begin() + lead, 0.0f);
+    std::fill(d_fir_in.end() - lead, d_fir_in.end(), 0.0f);
+    float* demod = d_fir_in.data() + lead;
+
+    const float normalize = 1.0f / d_sensitivity;
+    for (size_t offset = 0; offset < n_demod; offset += BURST_DEMOD_CHUNK) {
+        unsigned int n = std::min((size_t)BURST_DEMOD_CHUNK, n_demod - offset);
+        volk_32fc_x2_multiply_conjugate_32fc(
+            d_prod, &burst[offset + 1], &burst[offset], n);
+        volk_32fc_s32f_atan2_32f(&demod[offset], d_prod, normalize, n);
+    }
+
+    if (d_remove_dc) {
+        float sum;
+        volk_32f_accumulator_s32f(&sum, demod, n_demod);
+        const float mean = sum / n_demod;
+        for (size_t i = 0; i < n_demod; i++) {
+            demod[i] -= mean;
+        }
+    }
+
+    if (d_debug) {
+        message_port_pub(PMTCONSTSTR__demod(),
+                         pmt::cons(metadata, pmt::init_f32vector(n_demod, demod)));
+    }
+
+    /*
+     * Filtering, with the same group delay compensation and metadata updates as the
+     * PDU FIR Filter block. A single unity tap without decimation is a no-op so the
+     * demodulated samples are used directly.
+     */
+    const float* filtered = demod;
+    size_t n_filtered = n_demod;
+    if (!(d_unity_taps && d_decimation == 1)) {
+        size_t vlen_out(d_even_num_taps ? n_demod + 1 : n_demod);
+        d_filtered.resize(vlen_out / d_decimation);
+        d_fir.filterNdec(
+            d_filtered.data(), d_fir_in.data() + d_pad, d_filtered.size(), d_decimation);
+        filtered = d_filtered.data();
+        n_filtered = d_filtered.size();
+
+        sample_rate /= d_decimation;
+        if (d_even_num_taps && pmt::dict_has_key(metadata, PMTCONSTSTR__start_time())) {
+            double start_time = pmt::to_double(
+                pmt::dict_ref(metadata, PMTCONSTSTR__start_time(), pmt::PMT_NIL));
+            start_time -= 0.5 / sample_rate;
+            metadata = pmt::dict_add(
+                metadata, PMTCONSTSTR__start_time(), pmt::from_double(start_time));
+        }
+    }
+
+    if (d_debug) {
+        pmt::pmt_t fmeta = pmt::dict_add(
+            metadata, PMTCONSTSTR__sample_rate(), pmt::from_double(sample_rate));
+        message_port_pub(PMTCONSTSTR__filtered(),
+                         pmt::cons(fmeta, pmt::init_f32vector(n_filtered, filtered)));
+    }
+
+    // symbol rate hint, metadata takes precedence over the block setting
+    float min_rate = d_min_symbol_rate;
+    float max_rate = d_max_symbol_rate;
+    pmt::pmt_t pmt_min_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__symbol_rate_min(), pmt::PMT_NIL);
+    pmt::pmt_t pmt_max_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__symbol_rate_max(), pmt::PMT_NIL);
+    if (pmt::is_number(pmt_min_rate) && pmt::is_number(pmt_max_rate)) {
+        min_rate = pmt::to_float(pmt_min_rate);
+        max_rate = pmt::to_float(pmt_max_rate);
+    }
+
+    float symbol_rate;
+    if (!d_kernel.recover(
+            filtered, n_filtered, sample_rate, min_rate, max_rate, d_symbols, symbol_rate)) {
+        return;
+    }
+
+    // only the final symbols are allocated as a PMT
+    pmt::pmt_t data_vec;
+    size_t len;
+    if (d_binary_slice) {
+        data_vec = pmt::make_u8vector(d_symbols.size(), 0);
+        uint8_t* out = pmt::u8vector_writable_elements(data_vec, len);
+        std::transform(d_symbols.begin(), d_symbols.end(), out, [](float f) -> uint8_t {
+            return (f > 0);
+        });
+    } else {
+        data_vec = pmt::init_f32vector(d_symbols.size(), d_symbols.data());
+    }
+
+    metadata = pmt::dict_delete(metadata, PMTCONSTSTR__sample_rate());
+    metadata =
+        pmt::dict_add(metadata, PMTCONSTSTR__symbol_rate(), pmt::from_float(symbol_rate));
+
+    message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(metadata, data_vec));
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
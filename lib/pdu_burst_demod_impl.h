@@ -0,0 +1,68 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_IMPL_H
+
+#include "clock_recovery_kernel.h"
+#include <gnuradio/filter/fir_filter.h>
+#include <gnuradio/pdu_utils/pdu_burst_demod.h>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_burst_demod_impl : public pdu_burst_demod
+{
+private:
+    float d_sensitivity;
+    bool d_remove_dc;
+    filter::kernel::fir_filter_fff d_fir;
+    int d_decimation;
+    bool d_unity_taps;
+    size_t d_pad;
+    size_t d_group_delay_offset;
+    bool d_even_num_taps;
+    bool d_binary_slice;
+    bool d_debug;
+    float d_min_symbol_rate;
+    float d_max_symbol_rate;
+    clock_recovery_kernel d_kernel;
+
+    // scratch space reused between bursts
+    gr_complex* d_prod;
+    std::vector<float> d_fir_in;
+    std::vector<float> d_filtered;
+    std::vector<float> d_symbols;
+
+    void handle_pdu(pmt::pmt_t pdu);
+
+public:
+    pdu_burst_demod_impl(float sensitivity,
+                         const std::vector<float> taps,
+                         int decimation,
+                         bool remove_dc,
+                         bool binary_slice,
+                         bool debug,
+                         window_type type,
+                         float min_symbol_rate,
+                         float max_symbol_rate);
+
+    ~pdu_burst_demod_impl() override;
+
+    void set_sensitivity(float sensitivity) override;
+    void set_remove_dc(bool remove_dc) override;
+    void set_taps(std::vector<float> taps) override;
+    void set_decimation(int decimation) override;
+    void set_symbol_rate_range(float min_symbol_rate, float max_symbol_rate) override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_BURST_DEMOD_IMPL_H */
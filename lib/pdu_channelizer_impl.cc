@@ -0,0 +1,180 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_channelizer_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace pdu_utils {
+
+pdu_channelizer::sptr pdu_channelizer::make(int decimation,
+                                            const std::vector<float> taps,
+                                            const std::vector<double> center_freqs)
+{
+    return gnuradio::make_block_sptr<pdu_channelizer_impl>(
+        decimation, taps, center_freqs);
+}
+
+/*
+ * The private constructor
+ */
+pdu_channelizer_impl::pdu_channelizer_impl(int decimation,
+                                           const std::vector<float> taps,
+                                           const std::vector<double> center_freqs)
+    : gr::block("pdu_channelizer",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_proto(taps),
+      d_decimation(decimation)
+{
+    if (decimation < 1) {
+        GR_LOG_ERROR(d_logger, "Decimation must be at least 1");
+        throw std::invalid_argument("pdu_channelizer: decimation must be at least 1");
+    }
+    set_taps(taps);
+    set_center_freqs(center_freqs);
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_channelizer_impl::~pdu_channelizer_impl() {}
+
+void pdu_channelizer_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+
+    // make sure PDU data is formed properly
+    if (!(pmt::is_pair(pdu))) {
+        GR_LOG_NOTICE(d_logger, "received unexpected PMT (non-pair)");
+        return;
+    }
+
+    pmt::pmt_t metadata = pmt::car(pdu);
+    pmt::pmt_t pdu_data = pmt::cdr(pdu);
+
+    if (!pmt::is_dict(metadata)) {
+        GR_LOG_WARN(d_logger, "PDU metadata is not a dict, dropping");
+        return;
+    }
+
+    if (!(pmt::is_c32vector(pdu_data) || pmt::is_f32vector(pdu_data))) {
+        GR_LOG_WARN(d_logger, "PMT is not a float or complex PDU, dropping");
+        return;
+    }
+
+    pmt::pmt_t pmt_sample_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL);
+    if (!pmt::is_number(pmt_sample_rate)) {
+        GR_LOG_WARN(d_logger, "PDU has no sample_rate, dropping");
+        return;
+    }
+    double sample_rate = pmt::to_double(pmt_sample_rate);
+
+    size_t vlen_in = pmt::length(pdu_data);
+    if (vlen_in <= d_proto.ntaps()) {
+        // not enough data to process
+        return;
+    }
+
+    // metadata shared by all channels, updated the same way pdu_fir_filter does
+    double out_rate = sample_rate / d_decimation;
+    metadata =
+        pmt::dict_add(metadata, PMTCONSTSTR__sample_rate(), pmt::from_double(out_rate));
+    if (d_proto.even_num_taps() &&
+        pmt::dict_has_key(metadata, PMTCONSTSTR__start_time())) {
+        double start_time = pmt::to_double(
+            pmt::dict_ref(metadata, PMTCONSTSTR__start_time(), pmt::PMT_NIL));
+        start_time -= 0.5 / out_rate;
+        metadata = pmt::dict_add(
+            metadata, PMTCONSTSTR__start_time(), pmt::from_double(start_time));
+    }
+    double center_freq = 0;
+    pmt::pmt_t pmt_center_freq =
+        pmt::dict_ref(metadata, PMTCONSTSTR__center_frequency(), pmt::PMT_NIL);
+    if (pmt::is_number(pmt_center_freq)) {
+        center_freq = pmt::to_double(pmt_center_freq);
+    }
+
+    // the input is copied into the padded scratch buffer once for all channels
+    size_t n_out = d_proto.output_length(vlen_in, d_decimation);
+    d_input.load(pdu_data, d_proto.group_delay());
+
+    size_t len;
+    for (size_t c = 0; c < d_channels.size(); c++) {
+        channel& ch = d_channels[c];
+
+        // shift the channel offset down to baseband
+        double phase_inc = -2.0 * M_PI * ch.freq / sample_rate;
+        pmt::pmt_t out_vec = pmt::make_c32vector(n_out, gr_complex(0, 0));
+        gr_complex* out = pmt::c32vector_writable_elements(out_vec, len);
+        ch.kernel.filter(out, n_out, d_input, d_decimation, phase_inc);
+
+        pmt::pmt_t ch_meta =
+            pmt::dict_add(metadata, PMTCONSTSTR__channel(), pmt::from_uint64(c));
+        ch_meta = pmt::dict_add(ch_meta,
+                                PMTCONSTSTR__center_frequency(),
+                                pmt::from_double(center_freq + ch.freq));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(ch_meta, out_vec));
+    }
+}
+
+void pdu_channelizer_impl::set_taps(std::vector<float> taps)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+
+    d_proto_taps = taps;
+    d_proto.set_taps(taps);
+    for (channel& ch : d_channels) {
+        ch.kernel.set_taps(taps);
+    }
+
+    if (d_proto.even_num_taps()) {
+        GR_LOG_WARN(d_logger,
+                    "PERFORMANCE IMPACT: Even number of taps requires inefficient manual "
+                    "adjustment of burst time");
+    }
+}
+
+void pdu_channelizer_impl::set_decimation(int decimation)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+    if (decimation < 1) {
+        GR_LOG_ERROR(d_logger,
+                     boost::format("Decimation must be at least 1, keeping %d") %
+                         d_decimation);
+        return;
+    }
+    d_decimation = decimation;
+}
+
+void pdu_channelizer_impl::set_center_freqs(std::vector<double> center_freqs)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+
+    // rotated taps are loaded lazily on the next PDU, since the rotation depends on
+    // the PDU sample rate
+    d_channels.clear();
+    d_channels.reserve(center_freqs.size());
+    for (double f : center_freqs) {
+        d_channels.emplace_back(f, d_proto_taps);
+    }
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
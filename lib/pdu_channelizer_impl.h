@@ -0,0 +1,55 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_CHANNELIZER_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_CHANNELIZER_IMPL_H
+
+#include "xlating_fir_kernel.h"
+#include <gnuradio/pdu_utils/constants.h>
+#include <gnuradio/pdu_utils/pdu_channelizer.h>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_channelizer_impl : public pdu_channelizer
+{
+private:
+    // per channel kernels, taps are rotated for the channel offset
+    struct channel {
+        double freq;
+        xlating_fir_kernel kernel;
+
+        channel(double f, const std::vector<float>& taps) : freq(f), kernel(taps) {}
+    };
+
+    std::vector<channel> d_channels;
+    std::vector<float> d_proto_taps;
+    xlating_fir_kernel d_proto; // group delay and output length of every channel
+    xlating_fir_input d_input;
+    int d_decimation;
+    gr::thread::mutex d_mutex;
+
+    void handle_pdu(pmt::pmt_t pdu);
+
+public:
+    pdu_channelizer_impl(int decimation,
+                         const std::vector<float> taps,
+                         const std::vector<double> center_freqs);
+
+    ~pdu_channelizer_impl() override;
+
+    void set_taps(std::vector<float> taps) override;
+    void set_decimation(int decimation) override;
+    void set_center_freqs(std::vector<double> center_freqs) override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_CHANNELIZER_IMPL_H */
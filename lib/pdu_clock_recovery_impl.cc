@@ -31,11 +31,17 @@ namespace pdu_utils {
  * @param binary_slice - true if binary slicing to produce a u8vector
  * @param debug - true to enable debug ports & logging
  * @param type - window type to use.
+ * @param min_symbol_rate - lower bound of symbol rate search band, 0 to disable
+ * @param max_symbol_rate - upper bound of symbol rate search band, 0 to disable
  */
-pdu_clock_recovery::sptr
-pdu_clock_recovery::make(bool binary_slice, bool debug, window_type type)
+pdu_clock_recovery::sptr pdu_clock_recovery::make(bool binary_slice,
+                                                  bool debug,
+                                                  window_type type,
+                                                  float min_symbol_rate,
+                                                  float max_symbol_rate)
 {
-    return gnuradio::make_block_sptr<pdu_clock_recovery_impl>(binary_slice, debug, type);
+    return gnuradio::make_block_sptr<pdu_clock_recovery_impl>(
+        binary_slice, debug, type, min_symbol_rate, max_symbol_rate);
 }
 
 /**
@@ -44,21 +50,22 @@ pdu_clock_recovery::make(bool binary_slice, bool debug, window_type type)
  * @param binary_slice - true if binary slicing to produce a u8vector
  * @param debug - true to enable debug ports and logging
  * @param type - window type to use.
+ * @param min_symbol_rate - lower bound of symbol rate search band, 0 to disable
+ * @param max_symbol_rate - upper bound of symbol rate search band, 0 to disable
  */
 pdu_clock_recovery_impl::pdu_clock_recovery_impl(bool binary_slice,
                                                  bool debug,
-                                                 window_type type)
+                                                 window_type type,
+                                                 float min_symbol_rate,
+                                                 float max_symbol_rate)
     : gr::block("pdu_clock_recovery",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
       d_binary_slice(binary_slice),
-      d_lanczos_a(1), // logic for adding pulses currently relies on this being 1
-      d_gauss_sigma(2.0f / 8.0f),
-      d_dc_reject(0.05),
-      d_mags(nullptr),
       d_debug(debug),
-      d_burst_id(0),
-      d_window_type(type)
+      d_min_symbol_rate(min_symbol_rate),
+      d_max_symbol_rate(max_symbol_rate),
+      d_kernel(d_logger, debug, type)
 {
 
     // setup ports
@@ -71,15 +78,14 @@ pdu_clock_recovery_impl::pdu_clock_recovery_impl(bool binary_slice,
     }
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->pdu_handler(msg); });
-
-    init_fast_sinc();
-    fft_setup(15);
+    d_kernel.set_debug_handler(
+        [this](pmt::pmt_t port, pmt::pmt_t msg) { this->message_port_pub(port, msg); });
 } // end constructor
 
 /*
  * Our virtual destructor.
  */
-pdu_clock_recovery_impl::~pdu_clock_recovery_impl() { fft_cleanup(); }
+pdu_clock_recovery_impl::~pdu_clock_recovery_impl() {}
 
 /**
  * Specify what window type to use.
@@ -89,13 +95,9 @@ pdu_clock_recovery_impl::~pdu_clock_recovery_impl() { fft_cleanup(); }
  */
 void pdu_clock_recovery_impl::set_window_type(window_type type)
 {
-    d_window_type = type;
-
-    GR_LOG_INFO(d_logger, boost::format("Changing Window type %d") % d_window_type);
+    GR_LOG_INFO(d_logger, boost::format("Changing Window type %d") % type);
 
-    // flush all the existing pre-made memory & recreate it.
-    fft_cleanup();
-    fft_setup(15);
+    d_kernel.set_window_type(type);
 } // end set_window_type
 
 /**
@@ -106,7 +108,7 @@ void pdu_clock_recovery_impl::set_window_type(window_type type)
  */
 void pdu_clock_recovery_impl::set_gauss_sigma(float gauss_sigma)
 {
-    d_gauss_sigma = gauss_sigma;
+    d_kernel.set_gauss_sigma(gauss_sigma);
 }
 
 /**
@@ -117,161 +119,21 @@ void pdu_clock_recovery_impl::set_gauss_sigma(float gauss_sigma)
  */
 void pdu_clock_recovery_impl::set_dc_reject(float dc_reject)
 {
-    d_dc_reject = dc_reject;
+    d_kernel.set_dc_reject(dc_reject);
 }
 
 /**
- * sets up FFT memory space for a given power if needed
- *
- * @param power - power of FFT
- */
-void pdu_clock_recovery_impl::fft_setup(int power)
-{
-    for (int i = d_ffts.size(); i <= power; i++) {
-
-        // init fft
-        int fftsize = pow(2, i);
-        d_ffts.push_back(new gr::fft::fft_real_fwd(fftsize, 1));
-
-        // init window
-        d_windows.push_back(
-            (float*)volk_malloc(sizeof(float) * fftsize, volk_get_alignment()));
-        for (int j = 0; j < fftsize; j++) {
-            switch (d_window_type) {
-            case (GAUSSIAN_WIN): {
-                d_windows[i][j] = gaussianWindow(fftsize, d_gauss_sigma, j);
-                break;
-            }
-            case (TUKEY_WIN):
-            default: {
-                d_windows[i][j] = tukeyWindow(fftsize, d_gauss_sigma, j);
-                break;
-            }
-            } // end switch( d_window_type
-
-            // printf("%f ", d_windows[i][j] );
-        } // end for(j
-        // printf("\n");
-
-        // init d_mags
-        if (d_mags != nullptr) {
-            volk_free(d_mags);
-        }
-        d_mags = (float*)volk_malloc(sizeof(float) * fftsize, volk_get_alignment());
-
-    } // end for(i
-} // end fft_setup
-
-
-/**
- * Calculates the gaussian window value at a specific position
- *
- * @param n - total number of samples to calculate over
- * @param sigma - sigma value
- * @param x - index/sample to calculate for
- * @return float - gaussianWindows at x
- */
-float pdu_clock_recovery_impl::gaussianWindow(int n, float sigma, int x)
-{
-    float ans;
-
-    float two_sigma_squared = n * d_gauss_sigma;
-    two_sigma_squared *= 2 * two_sigma_squared;
-    float t = (-n + 1) / 2.0f + x;
-    ans = std::exp((-t * t) / two_sigma_squared);
-
-    return ans;
-} // end gaussianWindow
-
-/**
- * Calculates the Tukey window value at a specific position
+ * Specify the expected symbol rate range.
  *
- * @param n - total number of samples to calculate over
- * @param alpha - alpha value
- * @param x - index/sample to calculate for
- * @return float - Tukey at x
+ * @param min_symbol_rate - lower bound of symbol rate search band
+ * @param max_symbol_rate - upper bound of symbol rate search band
  */
-float pdu_clock_recovery_impl::tukeyWindow(int n, float alpha, int x)
+void pdu_clock_recovery_impl::set_symbol_rate_range(float min_symbol_rate,
+                                                    float max_symbol_rate)
 {
-    float ans = 0; // default
-
-    // https://en.wikipedia.org/wiki/Window_function
-    // printf("tukeyWindow( %d %f %d )\n", n, alpha, x );
-
-    // which part of the waveform are we in?
-    if (x == 0) {
-        ans = 0;
-    } else if (0 < x && x < (alpha * n / 2)) {
-        // cosine slope
-        ans = 0.5 * (1.0 - std::cos((2 * M_PI * x) / (alpha * n)));
-    } else if ((alpha * n / 2) <= x && x <= (n / 2)) {
-        // constant pass
-        ans = 1.0;
-    } else {
-        // upper half, return answer from lower half
-        ans = tukeyWindow(n, alpha, n - x);
-    }
-
-
-    return ans;
-} // end tukeyWindow
-
-/**
- * cleans up all memory associated with FFTs, windows, & mags
- */
-void pdu_clock_recovery_impl::fft_cleanup()
-{
-    for (gr::fft::fft_real_fwd* fft : d_ffts) {
-        delete fft;
-    }
-    d_ffts.clear();
-
-    for (float* win : d_windows) {
-        volk_free(win);
-    }
-    d_windows.clear();
-
-    if (d_mags != nullptr) {
-        volk_free(d_mags);
-    }
-    d_mags = nullptr;
-} // end fft_cleanup
-
-/**
- * initialize LUT for a lanczos windowed sinc function
- * note: LUT is one-sided to take advantage of symmetryS
- */
-void pdu_clock_recovery_impl::init_fast_sinc()
-{
-    const float pi_squared = M_PI * M_PI;
-    d_sinc_table[0] = 1.0;
-    for (int i = 1; i < LUT_SIZE; i++) {
-        float x = i * d_lanczos_a / (float)(LUT_SIZE - 1);
-        d_sinc_table[i] = d_lanczos_a * std::sin(M_PI * x) *
-                          std::sin(M_PI * x / d_lanczos_a) / (pi_squared * x * x);
-    } // end for(i
+    d_min_symbol_rate = min_symbol_rate;
+    d_max_symbol_rate = max_symbol_rate;
 }
-
-/**
- * fast sinc table lookup( lanczos windows sinc )
- *
- * @param x -
- * @return float -
- */
-float pdu_clock_recovery_impl::fast_sinc(float x)
-{
-    x = fabs(x);
-    if (x >= d_lanczos_a) {
-        return 0.0f;
-    }
-    x *= (LUT_SIZE - 1) / (float)d_lanczos_a;
-    int x_upper = std::ceil(x);
-    int x_lower = std::floor(x);
-    float mu = x - x_lower;
-    // linearly interpolate between table entries
-    return d_sinc_table[x_lower] + mu * (d_sinc_table[x_upper] - d_sinc_table[x_lower]);
-}
-
 /**
  * Handles PDUs from pdu_in port
  * Expects input pdu to meet the following criteria
@@ -284,8 +146,6 @@ float pdu_clock_recovery_impl::fast_sinc(float x)
  */
 void pdu_clock_recovery_impl::pdu_handler(pmt::pmt_t pdu)
 {
-    int offset = 0; // input data offset for where to start processing
-
     // check input conditions
     if (inputCheck(pdu) == false) {
         return;
@@ -299,142 +159,58 @@ void pdu_clock_recovery_impl::pdu_handler(pmt::pmt_t pdu)
     size_t length; // stores length of f32vector
     const float* data = pmt::f32vector_elements(pdu_data, length);
 
-    // Setup Memory banks
-    int fftpower = std::floor(log2(length));
-    int fftsize = pow(2, fftpower);
-    fft_setup(fftpower);
-    float* fft_in = d_ffts[fftpower]->get_inbuf();
-    memset(fft_in, 0, sizeof(float) * fftsize);
     if (d_debug) {
-        d_burst_id = 0;
-        if (pmt::dict_has_key(metadata, PMTCONSTSTR__burst_id())) {
-            pmt::pmt_t id =
-                pmt::dict_ref(metadata, PMTCONSTSTR__burst_id(), pmt::get_PMT_NIL());
-            if (pmt::is_uint64(id)) {
-                d_burst_id = pmt::to_uint64(id);
-            }
+        uint64_t burst_id = 0;
+        pmt::pmt_t id =
+            pmt::dict_ref(metadata, PMTCONSTSTR__burst_id(), pmt::get_PMT_NIL());
+        if (pmt::is_uint64(id)) {
+            burst_id = pmt::to_uint64(id);
         }
-
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("BurstID %u, Input Sz: %d, FFT Power: %d, FFTSz: %d") %
-                         d_burst_id % length % fftpower % fftsize);
+        d_kernel.set_burst_id(burst_id);
     }
 
-    // calculate sample offset
-    offset = (length - fftsize) / 2;
-    if (d_debug) {
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("BurstID %u sampLen:%d len:%d offset:%d") %
-                         d_burst_id % length % fftsize % offset);
+    // symbol rate hint, metadata takes precedence over the block setting
+    float min_rate = d_min_symbol_rate;
+    float max_rate = d_max_symbol_rate;
+    pmt::pmt_t pmt_min_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__symbol_rate_min(), pmt::get_PMT_NIL());
+    pmt::pmt_t pmt_max_rate =
+        pmt::dict_ref(metadata, PMTCONSTSTR__symbol_rate_max(), pmt::get_PMT_NIL());
+    if (pmt::is_number(pmt_min_rate) && pmt::is_number(pmt_max_rate)) {
+        min_rate = pmt::to_float(pmt_min_rate);
+        max_rate = pmt::to_float(pmt_max_rate);
     }
 
-    // make a list of zero crossing locations, offset
-    std::vector<float> zero_crossings = findZeroCrossings(&data[offset], fftsize);
-    if (zero_crossings.empty() || zero_crossings.size() < (size_t)(fftsize / (2 * SPS_MAX))) {
-        if (d_debug) {
-            GR_LOG_WARN(
-                d_logger,
-                boost::format("BurstID %u no/low zero crossings found, dropping") %
-                    d_burst_id);
-        }
+    float symbol_rate;
+    if (!d_kernel.recover(
+            data, length, samp_rate, min_rate, max_rate, d_symbols, symbol_rate)) {
         return;
     }
 
-    // metadata = pmt::dict_add( metadata, pmt::intern("clk_zerox_sz"), pmt::from_uint64(
-    // zero_crossings.size() ) ); metadata = pmt::dict_add( metadata,
-    // pmt::intern("clk_fft_sz"), pmt::from_uint64( fftsize ) );
-
-
-    genSincWaveform(zero_crossings, length, fft_in, fftsize);
-    if (d_debug) {
-        message_port_pub(PMTCONSTSTR__zeroX(), pmt::init_f32vector(fftsize, fft_in));
-    }
-
-    // apply gaussian window
-    volk_32f_x2_multiply_32f(fft_in, fft_in, d_windows[fftpower], fftsize);
-    if (d_debug) {
-        message_port_pub(PMTCONSTSTR__window(), pmt::init_f32vector(fftsize, fft_in));
-        // message_port_pub( PMTCONSTSTR__window(), pmt::init_f32vector( fftsize,
-        // d_windows[fftpower] ) );
-    }
-
-    // run the FFT
-    d_ffts[fftpower]->execute();
-    fftsize /= 2; // real transform only outputs positive frequencies
-    gr_complex* fft_out = d_ffts[fftpower]->get_outbuf();
-    volk_32fc_magnitude_squared_32f(d_mags, fft_out, fftsize);
-    if (d_debug) {
-        message_port_pub(PMTCONSTSTR__debug(), pmt::init_f32vector(fftsize, d_mags));
-    }
-
-
-    // Find fundamental max & associated info
-    int max_bin = findMaxFundamental(d_mags, fftsize);
-    float peak_bin = calcPeakBin(d_mags, fftsize, max_bin);
-    float phase = calcPeakPhase(fft_out, fftsize, max_bin, peak_bin);
-
-    float symbol_freq = peak_bin / fftsize / 2.0f;
-
-    if (d_debug) {
-        GR_LOG_DEBUG(
-            d_logger,
-            boost::format("peak_bin %f   fftsize %d   symbol_freq %f    symbol_rate %f") %
-                peak_bin % fftsize % symbol_freq % (symbol_freq * samp_rate));
-    }
-
-    // now extract soft symbols
-    std::vector<float> symbols = extractSymbols(data, length, symbol_freq, phase, offset);
-
     // format the output
     pmt::pmt_t data_vec;
 
     if (d_binary_slice) {
-        std::vector<uint8_t> sym(symbols.size());
-        std::transform(symbols.begin(),
-                       symbols.end(),
-                       sym.begin(),
+        data_vec = pmt::make_u8vector(d_symbols.size(), 0);
+        uint8_t* sym = pmt::u8vector_writable_elements(data_vec, length);
+        std::transform(d_symbols.begin(),
+                       d_symbols.end(),
+                       sym,
                        [&](float f) -> uint8_t { return (f > 0); });
-        data_vec = pmt::init_u8vector(sym.size(), sym.data());
     } else {
-        data_vec = pmt::init_f32vector(symbols.size(), symbols.data());
+        data_vec = pmt::init_f32vector(d_symbols.size(), d_symbols.data());
     }
 
     // ship it!
     metadata = pmt::dict_delete(metadata, PMTCONSTSTR__sample_rate());
-    metadata = pmt::dict_add(
-        metadata, PMTCONSTSTR__symbol_rate(), pmt::from_float(symbol_freq * samp_rate));
+    metadata =
+        pmt::dict_add(metadata, PMTCONSTSTR__symbol_rate(), pmt::from_float(symbol_rate));
 
     message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(metadata, data_vec));
 
     return;
 } // end pdu_handler
 
-
-/**
- * finds zero crossings in the data. Returns a vector of indexes
- * where zero crossings happen
- *
- * @param data - pointer to real waveform
- * @param len - length of data
- * @return std::vector<float> - list of zero crossing points
- */
-std::vector<float> pdu_clock_recovery_impl::findZeroCrossings(const float* data,
-                                                              const int len)
-{
-    std::vector<float> ans;
-    float mid = 0; //= midpoint( data, len );
-
-    ans.reserve(len / 2); // make a generous estimate of how many zero crossings there are
-    for (int i = 1; i < len; i++) {
-        if ((data[i] > mid) != (data[i - 1] > mid)) {
-            // quick linear interpolation of zero crossing point, unit = indexs
-            ans.push_back(i - 1 + (data[i - 1] - mid) / (data[i - 1] - data[i]));
-        }
-    } // end for(i
-
-    return ans;
-} // end findZeroCrossings
-
 /**
  * Does a bunch  of pre-condition checks on the input PDU
  *
@@ -472,288 +248,5 @@ bool pdu_clock_recovery_impl::inputCheck(pmt::pmt_t pdu)
     return true;
 } // end inputCheck
 
-/**
- * Generates a sync pulse waveform based on zero crossing positions.
- * This function also selects a portion of the original sample set's
- * zero crossings to use for the waveform. This resolves the fact
- * that the FFT size will always be smaller than the sample size
- *
- * @param crossings - locations of zero crossings
- * @param sampLen - original length of sample set
- * @param out - storage for sync waveform
- * @param len - max size of storage
- */
-void pdu_clock_recovery_impl::genSincWaveform(std::vector<float> crossings,
-                                              const int sampLen,
-                                              float* out,
-                                              const int len)
-{
-
-    // drop sinc pulses at every zero crossing location
-    for (const float& crossing : crossings) {
-        int idx = round(crossing);
-
-        if (0 < idx && idx < len) {
-            if (idx == crossing) {
-                out[idx] = 1.0f;
-            } else if (idx < (len - 1)) {
-                // this assumes d_lanczos_a == 1
-                out[idx - 1] += fast_sinc(idx - 1 - crossing);
-                out[idx] += fast_sinc(idx - crossing);
-                out[idx + 1] += fast_sinc(idx + 1 - crossing);
-            }
-
-        } // end if( inbounds
-
-    } // end for(i
-
-    return;
-} // end genSyncWaveform
-
-
-/**
- * Finds the max fundamental freq present in the FFT magnitude array.
- *
- * @param mags - FFT magnitude
- * @param len - length of mags
- * @return int - index of mags representing the max fundamental freq
- */
-int pdu_clock_recovery_impl::findMaxFundamental(const float* mags, const int len)
-{
-    float max_val = -1;
-    int max_bin = 0;
-
-    // first, calc DC reject
-    int first_bin = std::ceil(d_dc_reject * len);
-
-
-    // find max value across whole array
-    for (int i = first_bin; i < len; i++) {
-        if (d_mags[i] > max_val) {
-            max_val = d_mags[i];
-            max_bin = i;
-        }
-    }
-
-
-    // make sure the largest magnitude wasn't a harmonic of the frequency we want
-    float thresh = 0.5 * d_mags[max_bin];
-
-    if (d_debug) {
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("first pass max_bin %d(%f)   first_bin %d") % max_bin %
-                         d_mags[max_bin] % first_bin);
-        GR_LOG_DEBUG(d_logger, boost::format("harmonic thresh %f") % thresh);
-    }
-
-
-    // 'denom' is the harmonic we are checking (if denom is 5, we're checking if max_bin
-    // is a 5th harmonic)
-    // TODO WHY does this only process up to the 5th harmonic
-    // TODO WHY does this start processing at 5th and go down.
-    for (int denom = (SPS_MAX / 2); denom >= 2; denom--) {
-        // calculate the index of the fundamental
-        int funIdx = round(1.0f / (float)denom * max_bin);
-
-        if (first_bin <= funIdx && funIdx < len) // avoid DC reject & inbounds
-        {
-            if (d_debug) {
-                GR_LOG_DEBUG(d_logger,
-                             boost::format("harmonic check %d(%f) thresh %f  denom %d") %
-                                 funIdx % d_mags[funIdx] % thresh % denom);
-            }
-
-            if (d_mags[funIdx] >= thresh || d_mags[funIdx - 1] >= thresh ||
-                d_mags[funIdx + 1] >= thresh) {
-                // max search across [-1 .. +1] region
-                max_bin = funIdx - 1;
-                max_val = d_mags[max_bin];
-                for (int i = max_bin + 1; i <= max_bin + 2; i++) {
-                    if (d_mags[i] > max_val) {
-                        max_val = d_mags[i];
-                        max_bin = i;
-                    }
-                }
-
-                if (d_debug) {
-                    GR_LOG_DEBUG(d_logger,
-                                 boost::format("harmonic found, denom %d, bin %d(%f)") %
-                                     denom % max_bin % d_mags[max_bin]);
-                }
-
-                break;
-
-            } // end if( fundamental threshold
-
-        } // end if( avoid DC reject
-
-    } // end for(denom
-
-    if (d_debug) {
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("second pass max_bin %d(%f)") % max_bin %
-                         d_mags[max_bin]);
-    }
-
-    return max_bin;
-    ;
-} // end findMaxFundamental
-
-/**
- * Interpolates peak bin position
- *
- * @param mags - FFT magnitude
- * @param len - length of mags
- * @param max_bin - index into mags with max value
- * @return float - calculated peak bin
- */
-float pdu_clock_recovery_impl::calcPeakBin(const float* mags,
-                                           const int len,
-                                           const int max_bin)
-{
-    float ans = max_bin;
-
-    if ((max_bin > 0) and (max_bin < len - 1)) {
-        // https://ccrma.stanford.edu/~jos/sasp/Quadratic_Interpolation_Spectral_Peaks.html
-        float alpha = log(d_mags[max_bin - 1]);
-        float beta = log(d_mags[max_bin]);
-        float gamma = log(d_mags[max_bin + 1]);
-
-        float bin_offset = 0.5f * (alpha - gamma) / (alpha - 2 * beta + gamma);
-        ans = max_bin + bin_offset;
-
-        if (std::isnan(ans) || std::isinf(ans) || (ans < 0)) {
-            if (d_debug) {
-                GR_LOG_DEBUG(
-                    d_logger,
-                    boost::format("busrtID:%u peak_bin is inf or nan, reverting") %
-                        d_burst_id);
-                GR_LOG_DEBUG(
-                    d_logger,
-                    boost::format("burstID:%u max_bin:%d alpha:%f beta:%f gamma:%f") %
-                        d_burst_id % max_bin % alpha % beta % gamma);
-            }
-            ans = max_bin;
-        }
-
-        if ((bin_offset > .5f) || (bin_offset < -.5f)) {
-            // sanity check - an answer out of range\can occur if the max_bin is
-            // not a local maxima, i.e. a linear increasing/decreasing set of points
-
-            if (d_debug) {
-                GR_LOG_DEBUG(
-                    d_logger,
-                    boost::format(
-                        "burstID:%u bin_offset outside sanity check %f, reverting") %
-                        d_burst_id % bin_offset);
-            }
-
-            ans = max_bin;
-        }
-    }
-
-    return ans;
-} // end calcPeakBin
-
-/**
- * Calculate Peak phase
- *
- * @param fft - complex FFT data
- * @param fftsize - size of fft
- * @param max_bin - index of max bin
- * @param peak_bin - calculated peak bin
- * @return float - phase
- */
-float pdu_clock_recovery_impl::calcPeakPhase(gr_complex* fft,
-                                             const int fftsize,
-                                             const int max_bin,
-                                             const float peak_bin)
-{
-    float ans = 0;
-
-
-    // interpolate real and imaginary peaks separately to get accurate phase
-    int n_pts_to_interp = std::min(max_bin, 5);
-    int maxi = std::min(max_bin + n_pts_to_interp, fftsize - 1);
-    float real_peak = 0;
-    float imag_peak = 0;
-
-    for (int i = max_bin - n_pts_to_interp; i <= maxi; i++) {
-        float sinc;
-        if (i - peak_bin == 0) {
-            sinc = 1;
-        } else {
-            sinc = std::sin(M_PI * (i - peak_bin)) / (M_PI * (i - peak_bin));
-        }
-        real_peak += std::real(fft[i]) * sinc;
-        imag_peak += std::imag(fft[i]) * sinc;
-    } // end for(i
-
-    ans = std::arg(gr_complex(real_peak, imag_peak));
-
-    return ans;
-} // end calcPeakPhase
-
-
-/**
- * Extracts symbols from the original input data.
- *
- * @param data - input data buffer
- * @param len - length of data
- * @param symbol_freq - calculated symbol frequency
- * @param phase - calculated phase of symbol frequency
- * @param offset - sample offset used by genSincWaveform. Used for phase correction
- * @return std::vector<float> - vector of symbols
- */
-std::vector<float> pdu_clock_recovery_impl::extractSymbols(const float* data,
-                                                           const int len,
-                                                           const float symbol_freq,
-                                                           const float phase,
-                                                           const int offset)
-{
-    std::vector<float> ans;
-
-    ans.reserve((int)len * symbol_freq + 100);
-
-    float clock_phase = phase / (2 * M_PI);
-    clock_phase += 0.5f; // we want sample times, not zero crossing times
-    if (clock_phase <= 0) {
-        clock_phase += 1.0f;
-    }
-    clock_phase += symbol_freq;
-
-    // NOTE: The SincWaveform & FFT were not taken from the start of the file. We need to
-    // offset clock_phase to account for this
-    if (d_debug) {
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("Pre correction phase %f   clock_phase %f") % phase %
-                         clock_phase);
-    }
-    clock_phase -= offset * symbol_freq;
-    while (clock_phase <= 0) {
-        clock_phase += 1.0f;
-    }
-    while (clock_phase > 1) {
-        clock_phase -= 1.0f;
-    }
-    if (d_debug) {
-        GR_LOG_DEBUG(d_logger,
-                     boost::format("phase %f   clock_phase %f") % phase % clock_phase);
-    }
-
-
-    for (int i = 1; i < len; i++) {
-        if (clock_phase >= 1) {
-            clock_phase -= 1.0f;
-            float mu = clock_phase / symbol_freq;
-            float interp = mu * data[i - 1] + (1 - mu) * data[i];
-            ans.push_back(interp);
-        }
-        clock_phase += symbol_freq;
-    }
-
-    return ans;
-} // end extractSymbols
-
 } /* namespace pdu_utils */
 } /* namespace gr */
@@ -0,0 +1,208 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_delay_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace gr {
+namespace pdu_utils {
+
+// longest single wait, so a new delay is picked up and stop() is never delayed
+static const int64_t MAX_WAIT_US = 100000;
+
+static pmt::pmt_t wall_clock_time()
+{
+    return pmt::from_double(std::chrono::duration<double>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count());
+}
+
+pdu_delay::sptr pdu_delay::make(double delay, bool debug)
+{
+    return gnuradio::make_block_sptr<pdu_delay_impl>(delay, debug);
+}
+
+/*
+ * The private constructor
+ */
+pdu_delay_impl::pdu_delay_impl(double delay, bool debug)
+    : gr::block("pdu_delay",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_delay(0),
+      d_debug(debug),
+      d_finished(true),
+      d_seq(0)
+{
+    set_delay(delay);
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_delay_impl::~pdu_delay_impl() { stop_thread(); }
+
+bool pdu_delay_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_thread) {
+        d_finished = false;
+        d_thread = std::make_shared<gr::thread::thread>([this]() { this->run(); });
+    }
+    return block::start();
+}
+
+bool pdu_delay_impl::stop()
+{
+    stop_thread();
+
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_pending.empty()) {
+        GR_LOG_WARN(d_logger,
+                    boost::format("discarding %d delayed PDUs") % d_pending.size());
+        d_pending = decltype(d_pending)();
+    }
+    return block::stop();
+}
+
+void pdu_delay_impl::stop_thread()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void pdu_delay_impl::set_delay(double delay)
+{
+    if (delay < 0) {
+        GR_LOG_ERROR(d_logger, "Delay must be non-negative");
+        throw std::runtime_error("pdu_delay: delay must be non-negative");
+    }
+    gr::thread::scoped_lock l(d_mutex);
+    d_delay = delay;
+}
+
+double pdu_delay_impl::get_delay()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_delay;
+}
+
+void pdu_delay_impl::set_debug(bool debug)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_debug = debug;
+}
+
+bool pdu_delay_impl::get_debug()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_debug;
+}
+
+size_t pdu_delay_impl::get_pending()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_pending.size();
+}
+
+void pdu_delay_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    clock::time_point now = clock::now();
+
+    if (!pmt::is_pair(pdu)) {
+        GR_LOG_WARN(d_logger, "PDU is not a pair, dropping");
+        return;
+    }
+    pmt::pmt_t meta = pmt::car(pdu);
+
+    gr::thread::scoped_lock l(d_mutex);
+    double delay = d_delay;
+    if (pmt::is_dict(meta) && pmt::dict_has_key(meta, PMTCONSTSTR__delay())) {
+        pmt::pmt_t value = pmt::dict_ref(meta, PMTCONSTSTR__delay(), pmt::PMT_NIL);
+        if (!(pmt::is_real(value) || pmt::is_integer(value))) {
+            GR_LOG_WARN(d_logger, "Invalid delay from PDU metadata, using default delay");
+        } else if (pmt::to_double(value) < 0) {
+            GR_LOG_WARN(d_logger, "PDU delay is negative, using default delay");
+        } else {
+            delay = pmt::to_double(value);
+        }
+    }
+
+    if (d_debug && pmt::is_dict(meta)) {
+        meta = pmt::dict_add(meta, PMTCONSTSTR__time_in(), wall_clock_time());
+        pdu = pmt::cons(meta, pmt::cdr(pdu));
+    }
+
+    pending_pdu p;
+    p.release = now + std::chrono::duration_cast<clock::duration>(
+                          std::chrono::duration<double>(delay));
+    p.seq = d_seq++;
+    p.pdu = pdu;
+    d_pending.push(p);
+    d_cond.notify_all();
+}
+
+/*
+ * Releases pending PDUs in order as their release times pass
+ */
+void pdu_delay_impl::run()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    while (!d_finished) {
+        if (d_pending.empty()) {
+            d_cond.timed_wait(l, boost::posix_time::microseconds(MAX_WAIT_US));
+            continue;
+        }
+
+        int64_t remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                                d_pending.top().release - clock::now())
+                                .count();
+        if (remaining > 0) {
+            d_cond.timed_wait(
+                l, boost::posix_time::microseconds(std::min(remaining, MAX_WAIT_US)));
+            continue;
+        }
+
+        pmt::pmt_t pdu = d_pending.top().pdu;
+        d_pending.pop();
+        bool debug = d_debug;
+
+        l.unlock();
+        pmt::pmt_t meta = pmt::car(pdu);
+        if (debug && pmt::is_dict(meta)) {
+            meta = pmt::dict_add(meta, PMTCONSTSTR__time_out(), wall_clock_time());
+            pdu = pmt::cons(meta, pmt::cdr(pdu));
+        }
+        message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
+        l.lock();
+    }
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_DELAY_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_DELAY_IMPL_H
+
+#include <gnuradio/pdu_utils/pdu_delay.h>
+
+#include <chrono>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_delay_impl : public pdu_delay
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    struct pending_pdu {
+        clock::time_point release;
+        uint64_t seq; // arrival order, breaks ties between equal release times
+        pmt::pmt_t pdu;
+    };
+
+    // orders the priority queue so the earliest release is on top
+    struct later {
+        bool operator()(const pending_pdu& a, const pending_pdu& b) const
+        {
+            return a.release > b.release || (a.release == b.release && a.seq > b.seq);
+        }
+    };
+
+    double d_delay;
+    bool d_debug;
+
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_cond;
+    bool d_finished;
+    std::shared_ptr<gr::thread::thread> d_thread;
+    std::priority_queue<pending_pdu, std::vector<pending_pdu>, later> d_pending;
+    uint64_t d_seq;
+
+    void handle_pdu(pmt::pmt_t pdu);
+    void run();
+    void stop_thread();
+
+public:
+    pdu_delay_impl(double delay, bool debug);
+    ~pdu_delay_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    void set_delay(double delay) override;
+    double get_delay() override;
+    void set_debug(bool debug) override;
+    bool get_debug() override;
+    size_t get_pending() override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_DELAY_IMPL_H */
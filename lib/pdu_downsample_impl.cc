@@ -12,6 +12,7 @@
 #endif
 
 #include "pdu_downsample_impl.h"
+#include "pdu_view.h"
 #include "gnuradio/pdu_utils/constants.h"
 #include <gnuradio/io_signature.h>
 
@@ -57,41 +58,29 @@ void pdu_downsample_impl::handle_msg(pmt::pmt_t pdu)
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    // is it float type?
-    if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<float> out_data;
-
-        for (size_t i = d_phase; i < in_data.size(); i += d_decimation) {
-            out_data.push_back(in_data[i]);
+    bool handled = pdu_dispatch<float, uint8_t>(v_data, [&](auto in_data) {
+        typedef typename decltype(in_data)::value_type T;
+        size_t phase = d_phase;
+        size_t decimation = d_decimation;
+        size_t out_len = 0;
+        if (in_data.size() > phase) {
+            out_len = (in_data.size() - phase + decimation - 1) / decimation;
         }
 
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_f32vector(out_data.size(), out_data))));
-    }
-
-    // is it u8 type?
-    else if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> out_data;
-
-        for (size_t i = d_phase; i < in_data.size(); i += d_decimation) {
-            out_data.push_back(in_data[i]);
+        pdu_builder<T> out_data(out_len);
+        for (size_t i = 0, j = phase; i < out_len; i++, j += decimation) {
+            out_data[i] = in_data[j];
         }
 
         // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
-    }
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data.release()));
+    });
+
     // give up
-    else {
+    if (!handled) {
         GR_LOG_NOTICE(d_logger, "pdu downsample block can't handle this datatype");
     }
 }
 
-
 } /* namespace pdu_utils */
 } /* namespace gr */
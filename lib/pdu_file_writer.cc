@@ -0,0 +1,231 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_file_writer.h"
+#include <volk/volk.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace gr {
+namespace pdu_utils {
+
+namespace {
+
+int sync_fd(int fd)
+{
+#ifdef __APPLE__
+    return fsync(fd);
+#else
+    return fdatasync(fd);
+#endif
+}
+
+} // namespace
+
+pdu_file_writer::pdu_file_writer(gr::logger_ptr logger,
+                                 size_t buffer_size,
+                                 bool direct_io)
+    : d_logger(logger),
+      d_fd(-1),
+      d_direct_io(direct_io),
+      d_direct(false),
+      d_fill(0),
+      d_offset(0)
+{
+    // whole blocks so a full buffer can always be written with O_DIRECT
+    d_buffer_size = ((buffer_size + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+    if (d_buffer_size == 0) {
+        d_buffer_size = ALIGNMENT;
+    }
+    d_buffer = (uint8_t*)volk_malloc(d_buffer_size, ALIGNMENT);
+}
+
+pdu_file_writer::~pdu_file_writer()
+{
+    close(false);
+    volk_free(d_buffer);
+}
+
+bool pdu_file_writer::open(const std::string& path, bool append)
+{
+    close(false);
+
+    int flags = O_WRONLY | O_CREAT | (append ? 0 : O_TRUNC);
+    d_direct = false;
+#ifdef O_DIRECT
+    if (d_direct_io) {
+        d_fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        if (d_fd >= 0) {
+            d_direct = true;
+        } else if (errno == EINVAL) {
+            GR_LOG_WARN(d_logger,
+                        boost::format("O_DIRECT not supported for %s, using buffered "
+                                      "writes") %
+                            path);
+        }
+    }
+#endif
+    if (d_fd < 0) {
+        d_fd = ::open(path.c_str(), flags, 0644);
+    }
+    if (d_fd < 0) {
+        GR_LOG_ERROR(d_logger,
+                     boost::format("Error opening %s: %s") % path % strerror(errno));
+        return false;
+    }
+
+    d_path = path;
+    d_fill = 0;
+    d_offset = 0;
+    if (append) {
+        struct stat st;
+        if (fstat(d_fd, &st) == 0) {
+            d_offset = st.st_size;
+        }
+    }
+
+#ifdef O_DIRECT
+    // direct writes must start on a block boundary
+    if (d_direct && (d_offset % ALIGNMENT) != 0) {
+        fcntl(d_fd, F_SETFL, fcntl(d_fd, F_GETFL) & ~O_DIRECT);
+        d_direct = false;
+    }
+#endif
+
+    return true;
+}
+
+bool pdu_file_writer::pwrite_all(const void* data, size_t len, uint64_t offset)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    while (len > 0) {
+        ssize_t n = ::pwrite(d_fd, p, len, offset);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            GR_LOG_ERROR(d_logger,
+                         boost::format("Error writing %s: %s") % d_path %
+                             strerror(errno));
+            return false;
+        }
+        p += n;
+        len -= n;
+        offset += n;
+    }
+    return true;
+}
+
+/*
+ * Writes out the buffer, leaving any partial block buffered in direct mode
+ */
+bool pdu_file_writer::flush_blocks()
+{
+    size_t n = d_direct ? (d_fill / ALIGNMENT) * ALIGNMENT : d_fill;
+    if (n == 0) {
+        return true;
+    }
+    bool ok = pwrite_all(d_buffer, n, d_offset);
+    d_offset += n;
+    d_fill -= n;
+    if (d_fill) {
+        memmove(d_buffer, d_buffer + n, d_fill);
+    }
+    return ok;
+}
+
+/*
+ * Writes out the whole buffer. In direct mode the partial block is written zero
+ * padded but stays buffered, so it is rewritten in place by the next flush.
+ */
+bool pdu_file_writer::flush_tail()
+{
+    bool ok = flush_blocks();
+    if (d_fill > 0) {
+        memset(d_buffer + d_fill, 0, ALIGNMENT - d_fill);
+        ok = pwrite_all(d_buffer, ALIGNMENT, d_offset) && ok;
+    }
+    return ok;
+}
+
+bool pdu_file_writer::write(const void* data, size_t len)
+{
+    if (d_fd < 0) {
+        return false;
+    }
+
+    const uint8_t* p = (const uint8_t*)data;
+    bool ok = true;
+
+    // large writes go straight from the PDU to the file
+    if (!d_direct && len >= d_buffer_size) {
+        ok = flush_blocks();
+        ok = pwrite_all(p, len, d_offset) && ok;
+        d_offset += len;
+        return ok;
+    }
+
+    while (len > 0) {
+        size_t n = std::min(len, d_buffer_size - d_fill);
+        memcpy(d_buffer + d_fill, p, n);
+        d_fill += n;
+        p += n;
+        len -= n;
+        if (d_fill == d_buffer_size) {
+            ok = flush_blocks() && ok;
+        }
+    }
+    return ok;
+}
+
+bool pdu_file_writer::sync()
+{
+    if (d_fd < 0) {
+        return false;
+    }
+    bool ok = flush_tail();
+    return (sync_fd(d_fd) == 0) && ok;
+}
+
+bool pdu_file_writer::close(bool sync)
+{
+    if (d_fd < 0) {
+        return true;
+    }
+
+    bool ok = flush_tail();
+    if (d_direct) {
+        // drop the padding of the last block
+        ok = (ftruncate(d_fd, size()) == 0) && ok;
+    }
+    if (sync) {
+        ok = (sync_fd(d_fd) == 0) && ok;
+    }
+    ok = (::close(d_fd) == 0) && ok;
+    if (!ok) {
+        GR_LOG_ERROR(d_logger, boost::format("Error closing %s") % d_path);
+    }
+
+    d_fd = -1;
+    d_fill = 0;
+    d_offset = 0;
+    return ok;
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,93 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_FILE_WRITER_H
+#define INCLUDED_PDU_UTILS_PDU_FILE_WRITER_H
+
+#include <gnuradio/logger.h>
+
+#include <cstdint>
+#include <string>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * Buffered writer for a single output file, used by pdu_logger. Not a block.
+ *
+ * Data is collected in an aligned buffer and written with pwrite() in large blocks;
+ * writes larger than the buffer bypass it when direct I/O is off. With direct I/O the
+ * file is opened with O_DIRECT where supported and only whole aligned blocks are
+ * written at aligned offsets. A partial final block is written zero padded and the
+ * file is truncated to its real length on close.
+ *
+ * Not thread safe, each instance is owned by a single writer thread.
+ */
+class pdu_file_writer
+{
+public:
+    // O_DIRECT block alignment for buffer addresses, file offsets and lengths
+    static const size_t ALIGNMENT = 4096;
+
+    pdu_file_writer(gr::logger_ptr logger, size_t buffer_size, bool direct_io);
+    ~pdu_file_writer();
+
+    pdu_file_writer(const pdu_file_writer&) = delete;
+    pdu_file_writer& operator=(const pdu_file_writer&) = delete;
+
+    /**
+     * Open path for writing, truncating it unless append is set. Any open file is
+     * closed first. Returns false and logs an error if the file cannot be opened.
+     */
+    bool open(const std::string& path, bool append);
+
+    bool is_open() const { return d_fd >= 0; }
+    const std::string& path() const { return d_path; }
+
+    /**
+     * Logical length of the file including buffered data, i.e. the offset the next
+     * write will land at
+     */
+    uint64_t size() const { return d_offset + d_fill; }
+
+    bool write(const void* data, size_t len);
+
+    /**
+     * Write out buffered data and flush it to the device with fdatasync()
+     */
+    bool sync();
+
+    /**
+     * Write out buffered data and close the file, optionally syncing it first
+     */
+    bool close(bool sync);
+
+private:
+    gr::logger_ptr d_logger;
+    std::string d_path;
+    int d_fd;
+    bool d_direct_io;
+    bool d_direct;
+
+    uint8_t* d_buffer;
+    size_t d_buffer_size;
+    size_t d_fill;
+
+    // file offset of the first buffered byte, aligned in direct mode
+    uint64_t d_offset;
+
+    bool pwrite_all(const void* data, size_t len, uint64_t offset);
+    bool flush_blocks();
+    bool flush_tail();
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_FILE_WRITER_H */
@@ -16,16 +16,19 @@
 #include <gnuradio/pdu_utils/constants.h>
 #include <volk/volk.h>
 
+#include <algorithm>
+
 namespace gr {
 namespace pdu_utils {
 
 pdu_fine_time_measure::sptr pdu_fine_time_measure::make(float pre_burst_time,
                                                         float post_burst_time,
                                                         size_t average_width,
-                                                        float buffer_percent)
+                                                        float buffer_percent,
+                                                        bool trim_end)
 {
     return gnuradio::make_block_sptr<pdu_fine_time_measure_impl>(
-        pre_burst_time, post_burst_time, average_width, buffer_percent);
+        pre_burst_time, post_burst_time, average_width, buffer_percent, trim_end);
 }
 
 /*
@@ -34,14 +37,16 @@ pdu_fine_time_measure::sptr pdu_fine_time_measure::make(float pre_burst_time,
 pdu_fine_time_measure_impl::pdu_fine_time_measure_impl(float pre_burst_time,
                                                        float post_burst_time,
                                                        size_t average_width,
-                                                       float buffer_percent)
+                                                       float buffer_percent,
+                                                       bool trim_end)
     : gr::block("pdu_fine_time_measure",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
       d_pre_burst_time(pre_burst_time),
       d_post_burst_time(post_burst_time),
       d_average_size(average_width),
-      d_buffer_percent(buffer_percent / 100.0)
+      d_buffer_percent(buffer_percent / 100.0),
+      d_trim_end(trim_end)
 {
     message_port_register_in(PMTCONSTSTR__pdu_in());
     message_port_register_out(PMTCONSTSTR__pdu_out());
@@ -86,7 +91,6 @@ void pdu_fine_time_measure_impl::pdu_handler(pmt::pmt_t pdu)
 
     // Divide the burst into pre-noise/burst/post_noise
     // This is, in a way, an SNR calculation
-    float noiseSum = 0, burstSum = 0;
     size_t burst_size;
     const gr_complex* burst =
         (const gr_complex*)pmt::c32vector_elements(data, burst_size);
@@ -94,6 +98,19 @@ void pdu_fine_time_measure_impl::pdu_handler(pmt::pmt_t pdu)
     d_magnitude_squared_f.resize(burst_size);
     volk_32fc_magnitude_squared_32f(&d_magnitude_squared_f[0], burst, burst_size);
 
+    // every power sum below is a difference of two prefix sum entries, the sums are
+    // kept in double so long bursts do not lose precision in the differences
+    d_prefix_sum.resize(burst_size + 1);
+    d_prefix_sum[0] = 0;
+    for (size_t i = 0; i < burst_size; i++) {
+        d_prefix_sum[i + 1] = d_prefix_sum[i] + d_magnitude_squared_f[i];
+    }
+    const double* prefix = d_prefix_sum.data();
+    auto range_sum = [&](size_t first, size_t last) -> double {
+        last = std::min(last, burst_size);
+        return (first < last) ? prefix[last] - prefix[first] : 0.0;
+    };
+
     // Convert pre/post burst time to samples and subtract off buffer percent
     size_t pre_burst_stop =
         (d_pre_burst_time * sample_rate) * (1. - d_buffer_percent / 2.0);
@@ -109,12 +126,14 @@ void pdu_fine_time_measure_impl::pdu_handler(pmt::pmt_t pdu)
     size_t burst_start = (burst_size - burst_len) / 2 + burst_center_offset;
     size_t burst_stop = (burst_size - burst_len) / 2 - burst_center_offset;
 
-    for (size_t i = 0; i < pre_burst_stop; i++)
-        noiseSum += d_magnitude_squared_f[i];
-    for (size_t i = burst_size - post_burst_start; i < burst_size; i++)
-        noiseSum += d_magnitude_squared_f[i];
-    for (size_t i = burst_start; i < burst_size - burst_stop; i++)
-        burstSum += d_magnitude_squared_f[i];
+    float noiseSum = range_sum(0, pre_burst_stop);
+    if (post_burst_start <= burst_size) {
+        noiseSum += range_sum(burst_size - post_burst_start, burst_size);
+    }
+    float burstSum = 0;
+    if (burst_stop < burst_size) {
+        burstSum = range_sum(burst_start, burst_size - burst_stop);
+    }
 
     if (pre_burst_stop + post_burst_start > 0)
         noiseSum /= float(pre_burst_stop + post_burst_start);
@@ -124,49 +143,51 @@ void pdu_fine_time_measure_impl::pdu_handler(pmt::pmt_t pdu)
     float thresh = (noiseSum + burstSum) / 2.0;
     float thresh2 = thresh * d_average_size;
 
-    // Search for points above thresh
+    // Search for points above thresh, then slide a moving average window until it is
+    // above thresh as well. Window sums come straight from the prefix sum.
     size_t start = 0;
+    size_t stop = burst_size;
     // If noise_sum > burstSum, we aren't going to get a better estimate
     if (burstSum > noiseSum) {
+        start = burst_size;
+        for (size_t i = 0; i < burst_size; i++) {
+            if (d_magnitude_squared_f[i] > thresh) {
+                start = i;
+                break;
+            }
+        }
+        if (start < burst_size) {
+            while (range_sum(start, start + d_average_size) < thresh2 &&
+                   start + d_average_size < burst_size) {
+                start++;
+            }
+        }
 
-        for (; start < burst_size; start++) {
-            if (d_magnitude_squared_f[start] > thresh) {
-                // We have a candidate.
-                // Compute Moving average until we are above thresh
-                float movAvg = 0;
-                for (size_t j = 0; j < d_average_size; j++)
-                    movAvg += d_magnitude_squared_f[start + j];
-                // printf("start = %zu, movAvg = %f\n", start, movAvg);
-                while (movAvg < thresh2 && start < burst_size - d_average_size) {
-                    movAvg += d_magnitude_squared_f[start + d_average_size] -
-                              d_magnitude_squared_f[start];
-                    start++;
+        // same search from the back for the end of the burst, stop is exclusive
+        if (d_trim_end) {
+            stop = start;
+            for (size_t i = burst_size; i > start; i--) {
+                if (d_magnitude_squared_f[i - 1] > thresh) {
+                    stop = i;
+                    break;
                 }
-                break;
+            }
+            while (stop > start + d_average_size &&
+                   range_sum(stop - d_average_size, stop) < thresh2) {
+                stop--;
             }
         }
     }
-    // printf("start = %zu, %f, %f %zu\n", start, noiseSum, burstSum, pre_burst_stop);
-    // if (start > 10) start -= 10;
-    // else start = 0;
-    // start = std::min(burst_size, start+150);
-    /*frac_seconds += start / sample_rate;
-    if (frac_seconds > 1) {
-      seconds += int(frac_seconds);
-      frac_seconds -= int(frac_seconds);
-    }*/
-    // start = 0;
-
-    // Offset our burst time and remove samples from the beginning.
+
+    // Offset our burst time and remove samples from the beginning and end.
     metadata = pmt::dict_add(metadata,
                              PMTCONSTSTR__start_time(),
                              pmt::from_double(start_time + double(start) / sample_rate));
-    metadata = pmt::dict_add(metadata,
-                             PMTCONSTSTR__duration(),
-                             pmt::from_float(duration - float(start) / sample_rate));
-    // metadata = pmt::dict_add(metadata, PMTCONSTSTR__burst_time(),
-    // pmt::make_tuple(pmt::from_uint64(seconds), pmt::from_double(frac_seconds)));
-    pmt::pmt_t pdu_vector = pmt::init_c32vector(burst_size - start, burst + start);
+    metadata = pmt::dict_add(
+        metadata,
+        PMTCONSTSTR__duration(),
+        pmt::from_float(duration - float(start + (burst_size - stop)) / sample_rate));
+    pmt::pmt_t pdu_vector = pmt::init_c32vector(stop - start, burst + start);
     message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(metadata, pdu_vector));
 }
 
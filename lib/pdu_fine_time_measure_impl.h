@@ -19,10 +19,12 @@ class pdu_fine_time_measure_impl : public pdu_fine_time_measure
 {
 private:
     std::vector<float> d_magnitude_squared_f;
+    std::vector<double> d_prefix_sum;
     float d_pre_burst_time;
     float d_post_burst_time;
     size_t d_average_size;
     float d_buffer_percent;
+    bool d_trim_end;
 
     void pdu_handler(pmt::pmt_t pdu);
 
@@ -30,7 +32,8 @@ public:
     pdu_fine_time_measure_impl(float pre_burst_time,
                                float post_burst_time,
                                size_t average_width,
-                               float buffer_percent);
+                               float buffer_percent,
+                               bool trim_end);
 
     ~pdu_fine_time_measure_impl() override;
 };
@@ -23,12 +23,14 @@ pdu_flow_ctrl_helper::pdu_flow_ctrl_helper(std::vector<gr::basic_block_sptr> blo
     for (const gr::basic_block_sptr& block : blocks) {
         block_port bp;
         bp.block = basic_block_wptr(block);
+        bp.alias = block->alias();
         pmt::pmt_t ports = block->message_ports_in();
         int len = pmt::length(ports);
         for (int i = 0; i < len; i++) {
             pmt::pmt_t port = pmt::vector_ref(ports, i);
             if (!pmt::eq(port, PMTCONSTSTR__system())) {
-                bp.ports.push_back(port);
+                bp.ports.emplace_back();
+                bp.ports.back().port = port;
             }
         }
         if (bp.ports.empty()) {
@@ -42,32 +44,118 @@ pdu_flow_ctrl_helper::pdu_flow_ctrl_helper(std::vector<gr::basic_block_sptr> blo
 
 pdu_flow_ctrl_helper::~pdu_flow_ctrl_helper() {}
 
+void pdu_flow_ctrl_helper::add_port(gr::basic_block_sptr block, pmt::pmt_t port)
+{
+    for (block_port& bp : d_blocks) {
+        if (bp.block.lock() == block) {
+            bp.ports.emplace_back();
+            bp.ports.back().port = port;
+            return;
+        }
+    }
+    block_port bp;
+    bp.block = basic_block_wptr(block);
+    bp.alias = block->alias();
+    bp.ports.emplace_back();
+    bp.ports.back().port = port;
+    d_blocks.push_back(bp);
+}
+
+void pdu_flow_ctrl_helper::resolve()
+{
+    for (block_port& bp : d_blocks) {
+        bp.resolved = bp.block.lock();
+    }
+}
+
+void pdu_flow_ctrl_helper::release()
+{
+    for (block_port& bp : d_blocks) {
+        bp.resolved.reset();
+    }
+}
+
+int pdu_flow_ctrl_helper::read_port(basic_block* block, port_stats& ps)
+{
+    ps.depth = block->nmsgs(ps.port);
+    ps.high_water = std::max(ps.high_water, ps.depth);
+    ps.depths.record(ps.depth);
+    return ps.depth;
+}
+
 int pdu_flow_ctrl_helper::max_nmsgs()
 {
     int max_nmsgs = 0;
-    for (const block_port& bp : d_blocks) {
-        basic_block_sptr block = bp.block.lock();
+    for (block_port& bp : d_blocks) {
+        basic_block_sptr locked;
+        basic_block* block = bp.resolved.get();
+        if (!block) {
+            locked = bp.block.lock();
+            block = locked.get();
+        }
         if (block) {
-            for (const pmt::pmt_t& port : bp.ports) {
-                max_nmsgs = std::max(max_nmsgs, (int)block->nmsgs(port));
+            for (port_stats& ps : bp.ports) {
+                max_nmsgs = std::max(max_nmsgs, read_port(block, ps));
             }
         }
     }
     return max_nmsgs;
 }
 
+void pdu_flow_ctrl_helper::sample() { max_nmsgs(); }
+
+int pdu_flow_ctrl_helper::max_high_water()
+{
+    int high_water = 0;
+    for (const block_port& bp : d_blocks) {
+        for (const port_stats& ps : bp.ports) {
+            high_water = std::max(high_water, ps.high_water);
+        }
+    }
+    return high_water;
+}
+
+pmt::pmt_t pdu_flow_ctrl_helper::stats()
+{
+    pmt::pmt_t stats = pmt::PMT_NIL;
+    for (const block_port& bp : d_blocks) {
+        for (const port_stats& ps : bp.ports) {
+            pmt::pmt_t dict = pmt::make_dict();
+            dict = pmt::dict_add(dict, pmt::mp("block"), pmt::mp(bp.alias));
+            dict = pmt::dict_add(dict, pmt::mp("port"), ps.port);
+            dict = pmt::dict_add(dict, pmt::mp("depth"), pmt::from_long(ps.depth));
+            dict =
+                pmt::dict_add(dict, pmt::mp("high_water"), pmt::from_long(ps.high_water));
+            dict = pmt::dict_add(dict, pmt::mp("depth_histogram"), ps.depths.to_pmt());
+            stats = pmt::list_add(stats, dict);
+        }
+    }
+    return stats;
+}
+
+void pdu_flow_ctrl_helper::reset_stats()
+{
+    for (block_port& bp : d_blocks) {
+        for (port_stats& ps : bp.ports) {
+            ps.high_water = ps.depth;
+            ps.depths.reset();
+        }
+    }
+}
+
 void pdu_flow_ctrl_helper::print_nmsgs()
 {
     printf("\n====================== PDU Flow Controller ========================\n");
     for (const block_port& bp : d_blocks) {
         basic_block_sptr block = bp.block.lock();
         if (block) {
-            for (const pmt::pmt_t& port : bp.ports) {
-                int nmsgs = block->nmsgs(port);
-                printf("'%s' has %d messages waiting at '%s'\n",
+            for (const port_stats& ps : bp.ports) {
+                int nmsgs = block->nmsgs(ps.port);
+                printf("'%s' has %d messages waiting at '%s' (high-water %d)\n",
                        block->name().c_str(),
                        nmsgs,
-                       pmt::symbol_to_string(port).c_str());
+                       pmt::symbol_to_string(ps.port).c_str(),
+                       ps.high_water);
             }
         }
     }
@@ -0,0 +1,385 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_flow_ctrl_impl.h"
+#include <gnuradio/block_registry.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <algorithm>
+
+namespace gr {
+namespace pdu_utils {
+
+// poll interval while a PDU is held for backpressure
+static const int64_t BACKPRESSURE_POLL_US = 100;
+// longest single wait of the statistics thread, so stop() is never delayed
+static const int64_t MAX_WAIT_US = 100000;
+
+static const pmt::pmt_t PMTCONSTSTR__stats()
+{
+    static const pmt::pmt_t val = pmt::mp("stats");
+    return val;
+}
+
+pdu_flow_ctrl::sptr pdu_flow_ctrl::make(std::vector<gr::basic_block_sptr> blocks,
+                                        int max_nmsgs,
+                                        bool backpressure,
+                                        int low_watermark,
+                                        double stats_interval)
+{
+    return gnuradio::make_block_sptr<pdu_flow_ctrl_impl>(
+        blocks, max_nmsgs, backpressure, low_watermark, stats_interval);
+}
+
+/*
+ * The private constructor
+ */
+pdu_flow_ctrl_impl::pdu_flow_ctrl_impl(std::vector<gr::basic_block_sptr> blocks,
+                                       int max_nmsgs,
+                                       bool backpressure,
+                                       int low_watermark,
+                                       double stats_interval)
+    : gr::block("pdu_flow_ctrl",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_max_nmsgs(std::max(max_nmsgs, 1)),
+      d_low_watermark(low_watermark),
+      d_backpressure(backpressure),
+      d_finished(true),
+      d_stats_interval(stats_interval),
+      d_dropped(0),
+      d_held(0)
+{
+    // weak references so the watched blocks are only held while running
+    for (const gr::basic_block_sptr& block : blocks) {
+        d_blocks.push_back(basic_block_wptr(block));
+    }
+    update_release_nmsgs();
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+    message_port_register_out(PMTCONSTSTR__stats());
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_flow_ctrl_impl::~pdu_flow_ctrl_impl() { stop_thread(); }
+
+void pdu_flow_ctrl_impl::setup_rpc()
+{
+#ifdef GR_CTRLPORT
+
+    add_rpc_variable(rpcbasic_sptr(new rpcbasic_register_get<pdu_flow_ctrl, uint64_t>(
+        alias(),
+        "cp_get_dropped",
+        &pdu_flow_ctrl::get_dropped,
+        pmt::mp(0),
+        pmt::mp(10000),
+        pmt::mp(100),
+        "",
+        "Get number of PDUs dropped",
+        RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    add_rpc_variable(rpcbasic_sptr(new rpcbasic_register_get<pdu_flow_ctrl, uint64_t>(
+        alias(),
+        "cp_get_held",
+        &pdu_flow_ctrl::get_held,
+        pmt::mp(0),
+        pmt::mp(10000),
+        pmt::mp(100),
+        "",
+        "Get number of PDUs held",
+        RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    add_rpc_variable(rpcbasic_sptr(
+        new rpcbasic_register_get<pdu_flow_ctrl, int>(alias(),
+                                                      "cp_get_high_water",
+                                                      &pdu_flow_ctrl::get_high_water,
+                                                      pmt::mp(0),
+                                                      pmt::mp(10000),
+                                                      pmt::mp(100),
+                                                      "msgs",
+                                                      "Get queue high-water mark",
+                                                      RPC_PRIVLVL_MIN,
+                                                      DISPTIME | DISPOPTSTRIP)));
+
+    add_rpc_variable(rpcbasic_sptr(new rpcbasic_register_get<pdu_flow_ctrl, uint64_t>(
+        alias(),
+        "cp_get_latency_p50",
+        &pdu_flow_ctrl::get_latency_p50,
+        pmt::mp(0),
+        pmt::mp(100000),
+        pmt::mp(100),
+        "us",
+        "Get median PDU handling time",
+        RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    add_rpc_variable(rpcbasic_sptr(new rpcbasic_register_get<pdu_flow_ctrl, uint64_t>(
+        alias(),
+        "cp_get_latency_p99",
+        &pdu_flow_ctrl::get_latency_p99,
+        pmt::mp(0),
+        pmt::mp(100000),
+        pmt::mp(100),
+        "us",
+        "Get 99th percentile PDU handling time",
+        RPC_PRIVLVL_MIN,
+        DISPTIME | DISPOPTSTRIP)));
+
+    add_rpc_variable(rpcbasic_sptr(
+        new rpcbasic_register_set<pdu_flow_ctrl, int>(alias(),
+                                                      "cp_set_max_nmsgs",
+                                                      &pdu_flow_ctrl::set_max_nmsgs,
+                                                      pmt::mp(1),
+                                                      pmt::mp(10000),
+                                                      pmt::mp(100),
+                                                      "msgs",
+                                                      "Set maximum queue depth",
+                                                      RPC_PRIVLVL_MIN,
+                                                      DISPNULL)));
+
+#endif /* GR_CTRLPORT */
+}
+
+bool pdu_flow_ctrl_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+
+    std::vector<gr::basic_block_sptr> blocks;
+    for (const basic_block_wptr& wp : d_blocks) {
+        gr::basic_block_sptr block = wp.lock();
+        if (block) {
+            blocks.push_back(block);
+        }
+    }
+    d_helper.reset(new pdu_flow_ctrl_helper(blocks));
+
+    // with no blocks given, watch the ports subscribed to pdu_out
+    if (d_blocks.empty()) {
+        pmt::pmt_t subscribers = message_subscribers(PMTCONSTSTR__pdu_out());
+        while (pmt::is_pair(subscribers)) {
+            pmt::pmt_t target = pmt::car(subscribers);
+            gr::basic_block_sptr block =
+                global_block_registry.block_lookup(pmt::car(target));
+            if (block) {
+                d_helper->add_port(block, pmt::cdr(target));
+            }
+            subscribers = pmt::cdr(subscribers);
+        }
+    }
+
+    d_helper->resolve();
+    d_latency.reset();
+    d_finished = false;
+    if (!d_thread) {
+        d_thread = std::make_shared<gr::thread::thread>([this]() { this->run_stats(); });
+    }
+    return block::start();
+}
+
+bool pdu_flow_ctrl_impl::stop()
+{
+    stop_thread();
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        if (d_helper) {
+            d_helper->release();
+        }
+    }
+    GR_LOG_INFO(d_logger,
+                boost::format("dropped %d PDUs, held %d PDUs, high-water %d") %
+                    d_dropped % d_held % get_high_water());
+    return block::stop();
+}
+
+void pdu_flow_ctrl_impl::stop_thread()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+/*
+ * Samples the watched queues and publishes the statistics every stats_interval
+ */
+void pdu_flow_ctrl_impl::run_stats()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    clock::time_point next = clock::now();
+    while (!d_finished) {
+        clock::time_point now = clock::now();
+        if (d_stats_interval <= 0) {
+            next = now;
+            d_cond.timed_wait(l, boost::posix_time::microseconds(MAX_WAIT_US));
+            continue;
+        }
+
+        int64_t remaining =
+            std::chrono::duration_cast<std::chrono::microseconds>(next - now).count();
+        if (remaining > 0) {
+            d_cond.timed_wait(
+                l, boost::posix_time::microseconds(std::min(remaining, MAX_WAIT_US)));
+            continue;
+        }
+
+        d_helper->sample();
+        pmt::pmt_t stats = make_stats();
+        next += std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(d_stats_interval));
+        if (next < now) {
+            next = now;
+        }
+
+        l.unlock();
+        message_port_pub(PMTCONSTSTR__stats(), stats);
+        l.lock();
+    }
+}
+
+/*
+ * Caller must hold d_mutex
+ */
+pmt::pmt_t pdu_flow_ctrl_impl::make_stats()
+{
+    pmt::pmt_t stats = pmt::make_dict();
+    stats = pmt::dict_add(stats, pmt::mp("dropped"), pmt::from_uint64(d_dropped));
+    stats = pmt::dict_add(stats, pmt::mp("held"), pmt::from_uint64(d_held));
+    stats = pmt::dict_add(stats, pmt::mp("latency_us"), d_latency.to_pmt());
+    stats = pmt::dict_add(
+        stats, pmt::mp("ports"), d_helper ? d_helper->stats() : pmt::PMT_NIL);
+    return stats;
+}
+
+void pdu_flow_ctrl_impl::update_release_nmsgs()
+{
+    if (d_low_watermark < 0) {
+        d_release_nmsgs = d_max_nmsgs / 2;
+    } else {
+        d_release_nmsgs = std::min(d_low_watermark, d_max_nmsgs - 1);
+    }
+}
+
+void pdu_flow_ctrl_impl::set_max_nmsgs(int max_nmsgs)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_max_nmsgs = std::max(max_nmsgs, 1);
+    update_release_nmsgs();
+}
+
+void pdu_flow_ctrl_impl::set_low_watermark(int low_watermark)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_low_watermark = low_watermark;
+    update_release_nmsgs();
+}
+
+void pdu_flow_ctrl_impl::set_backpressure(bool backpressure)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_backpressure = backpressure;
+    d_cond.notify_all();
+}
+
+void pdu_flow_ctrl_impl::set_stats_interval(double stats_interval)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_stats_interval = stats_interval;
+    d_cond.notify_all();
+}
+
+int pdu_flow_ctrl_impl::get_high_water()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_helper ? d_helper->max_high_water() : 0;
+}
+
+uint64_t pdu_flow_ctrl_impl::get_latency_p50()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_latency.percentile(0.5);
+}
+
+uint64_t pdu_flow_ctrl_impl::get_latency_p99()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_latency.percentile(0.99);
+}
+
+pmt::pmt_t pdu_flow_ctrl_impl::get_stats()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return make_stats();
+}
+
+void pdu_flow_ctrl_impl::reset_stats()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_latency.reset();
+    if (d_helper) {
+        d_helper->reset_stats();
+    }
+}
+
+void pdu_flow_ctrl_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    clock::time_point start = clock::now();
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        if (!d_finished && d_helper->max_nmsgs() >= d_max_nmsgs) {
+            if (!d_backpressure) {
+                uint64_t dropped = ++d_dropped;
+                // log the first drop and then at powers of two
+                if ((dropped & (dropped - 1)) == 0) {
+                    GR_LOG_WARN(d_logger,
+                                boost::format("messages backing up, %d PDUs dropped") %
+                                    dropped);
+                }
+                d_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     clock::now() - start)
+                                     .count());
+                return;
+            }
+
+            d_held++;
+            while (!d_finished && d_backpressure &&
+                   d_helper->max_nmsgs() > d_release_nmsgs) {
+                d_cond.timed_wait(l,
+                                  boost::posix_time::microseconds(BACKPRESSURE_POLL_US));
+            }
+        }
+    }
+
+    message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
+
+    int64_t elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start)
+            .count();
+    gr::thread::scoped_lock l(d_mutex);
+    d_latency.record(elapsed);
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,79 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_IMPL_H
+
+#include <gnuradio/pdu_utils/pdu_flow_ctrl.h>
+#include <gnuradio/pdu_utils/pdu_flow_ctrl_helper.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_flow_ctrl_impl : public pdu_flow_ctrl
+{
+private:
+    std::vector<basic_block_wptr> d_blocks;
+    std::unique_ptr<pdu_flow_ctrl_helper> d_helper;
+
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_cond;
+    int d_max_nmsgs;
+    int d_low_watermark;
+    int d_release_nmsgs;
+    bool d_backpressure;
+    bool d_finished;
+    double d_stats_interval;
+    std::shared_ptr<gr::thread::thread> d_thread;
+
+    std::atomic<uint64_t> d_dropped;
+    std::atomic<uint64_t> d_held;
+    log_linear_histogram d_latency;
+
+    typedef std::chrono::steady_clock clock;
+
+    void handle_pdu(pmt::pmt_t pdu);
+    void update_release_nmsgs();
+    void stop_thread();
+    void run_stats();
+    pmt::pmt_t make_stats();
+
+public:
+    pdu_flow_ctrl_impl(std::vector<gr::basic_block_sptr> blocks,
+                       int max_nmsgs,
+                       bool backpressure,
+                       int low_watermark,
+                       double stats_interval);
+    ~pdu_flow_ctrl_impl() override;
+
+    bool start() override;
+    bool stop() override;
+    void setup_rpc() override; // enable controlport
+
+    void set_max_nmsgs(int max_nmsgs) override;
+    void set_low_watermark(int low_watermark) override;
+    void set_backpressure(bool backpressure) override;
+    uint64_t get_dropped() override { return d_dropped; }
+    uint64_t get_held() override { return d_held; }
+    void set_stats_interval(double stats_interval) override;
+    int get_high_water() override;
+    uint64_t get_latency_p50() override;
+    uint64_t get_latency_p99() override;
+    pmt::pmt_t get_stats() override;
+    void reset_stats() override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_FLOW_CTRL_IMPL_H */
@@ -0,0 +1,159 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_freq_xlating_fir_filter_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace pdu_utils {
+
+pdu_freq_xlating_fir_filter::sptr pdu_freq_xlating_fir_filter::make(
+    int decimation, const std::vector<float> taps, double phase_inc)
+{
+    return gnuradio::make_block_sptr<pdu_freq_xlating_fir_filter_impl>(
+        decimation, taps, phase_inc);
+}
+
+/*
+ * The private constructor
+ */
+pdu_freq_xlating_fir_filter_impl::pdu_freq_xlating_fir_filter_impl(
+    int decimation, const std::vector<float> taps, double phase_inc)
+    : gr::block("pdu_freq_xlating_fir_filter",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_kernel(std::vector<float>(1, 1)),
+      d_decimation(decimation),
+      d_phase_inc(phase_inc)
+{
+    if (decimation < 1) {
+        GR_LOG_ERROR(d_logger, "Decimation must be at least 1");
+        throw std::runtime_error(
+            "pdu_freq_xlating_fir_filter: decimation must be at least 1");
+    }
+    set_taps(taps);
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_freq_xlating_fir_filter_impl::~pdu_freq_xlating_fir_filter_impl() {}
+
+void pdu_freq_xlating_fir_filter_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+
+    // make sure PDU data is formed properly
+    if (!(pmt::is_pair(pdu))) {
+        GR_LOG_NOTICE(d_logger, "received unexpected PMT (non-pair)");
+        return;
+    }
+
+    pmt::pmt_t metadata = pmt::car(pdu);
+    pmt::pmt_t pdu_data = pmt::cdr(pdu);
+
+    if (!pmt::is_dict(metadata)) {
+        GR_LOG_WARN(d_logger, "PDU metadata is not a dict, dropping");
+        return;
+    }
+
+    if (!(pmt::is_c32vector(pdu_data) || pmt::is_f32vector(pdu_data))) {
+        GR_LOG_WARN(d_logger, "PMT is not a float or complex PDU, dropping");
+        return;
+    }
+
+    size_t vlen_in = pmt::length(pdu_data);
+    if (vlen_in <= d_kernel.ntaps()) {
+        // not enough data to process
+        return;
+    }
+
+    // if "phase_inc" specified in metadata, use that field for this PDU only
+    double phase_inc = d_phase_inc;
+    pmt::pmt_t pmt_phase_inc =
+        pmt::dict_ref(metadata, PMTCONSTSTR__phase_inc(), pmt::PMT_NIL);
+    if (pmt::is_number(pmt_phase_inc)) {
+        phase_inc = pmt::to_double(pmt_phase_inc);
+    }
+
+    // update sample_rate and start_time the same way pdu_fir_filter does
+    if ((d_decimation != 1) || d_kernel.even_num_taps()) {
+        if (pmt::dict_has_key(metadata, PMTCONSTSTR__sample_rate())) {
+            double sample_rate = pmt::to_double(
+                pmt::dict_ref(metadata, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL));
+            if ((d_decimation != 1)) {
+                sample_rate /= d_decimation;
+                metadata = pmt::dict_add(
+                    metadata, PMTCONSTSTR__sample_rate(), pmt::from_double(sample_rate));
+            }
+            if (d_kernel.even_num_taps() &&
+                pmt::dict_has_key(metadata, PMTCONSTSTR__start_time())) {
+                double start_time = pmt::to_double(
+                    pmt::dict_ref(metadata, PMTCONSTSTR__start_time(), pmt::PMT_NIL));
+                start_time -= 0.5 / sample_rate;
+                metadata = pmt::dict_add(
+                    metadata, PMTCONSTSTR__start_time(), pmt::from_double(start_time));
+            }
+        }
+    }
+
+    // filter into the output PMT directly, the input scratch buffer is reused
+    // between PDUs
+    size_t n_out = d_kernel.output_length(vlen_in, d_decimation);
+    pmt::pmt_t out_vec = pmt::make_c32vector(n_out, gr_complex(0, 0));
+    size_t len;
+    gr_complex* out = pmt::c32vector_writable_elements(out_vec, len);
+
+    d_input.load(pdu_data, d_kernel.group_delay());
+    d_kernel.filter(out, n_out, d_input, d_decimation, phase_inc);
+
+    message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(metadata, out_vec));
+}
+
+void pdu_freq_xlating_fir_filter_impl::set_taps(std::vector<float> taps)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+
+    d_kernel.set_taps(taps);
+    if (d_kernel.even_num_taps()) {
+        GR_LOG_WARN(d_logger,
+                    "PERFORMANCE IMPACT: Even number of taps requires inefficient manual "
+                    "adjustment of burst time");
+    }
+}
+
+void pdu_freq_xlating_fir_filter_impl::set_decimation(int decimation)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+    if (decimation < 1) {
+        GR_LOG_ERROR(d_logger,
+                     boost::format("Decimation must be at least 1, keeping %d") %
+                         d_decimation);
+        return;
+    }
+    d_decimation = decimation;
+}
+
+void pdu_freq_xlating_fir_filter_impl::set_phase_inc(double phase_inc)
+{
+    gr::thread::scoped_lock guard(d_mutex);
+    d_phase_inc = phase_inc;
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,46 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_IMPL_H
+
+#include "xlating_fir_kernel.h"
+#include <gnuradio/pdu_utils/constants.h>
+#include <gnuradio/pdu_utils/pdu_freq_xlating_fir_filter.h>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_freq_xlating_fir_filter_impl : public pdu_freq_xlating_fir_filter
+{
+private:
+    xlating_fir_kernel d_kernel;
+    xlating_fir_input d_input;
+    int d_decimation;
+    double d_phase_inc;
+    gr::thread::mutex d_mutex;
+
+    void handle_pdu(pmt::pmt_t pdu);
+
+public:
+    pdu_freq_xlating_fir_filter_impl(int decimation,
+                                     const std::vector<float> taps,
+                                     double phase_inc);
+
+    ~pdu_freq_xlating_fir_filter_impl() override;
+
+    void set_taps(std::vector<float> taps) override;
+    void set_decimation(int decimation) override;
+    void set_phase_inc(double phase_inc) override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_FREQ_XLATING_FIR_FILTER_IMPL_H */
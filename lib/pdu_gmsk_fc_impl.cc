@@ -18,25 +18,34 @@
 #include <gnuradio/pdu_utils/constants.h>
 #include <cmath>
 
+// largest number of symbols a phase trajectory table may span
+#define GMSK_LUT_MAX_SPAN 12
 
 namespace gr {
 namespace pdu_utils {
 
-pdu_gmsk_fc::sptr pdu_gmsk_fc::make(float sensitivity, const std::vector<float> taps)
+pdu_gmsk_fc::sptr pdu_gmsk_fc::make(float sensitivity,
+                                    const std::vector<float> taps,
+                                    int samples_per_symbol)
 {
-    return gnuradio::make_block_sptr<pdu_gmsk_fc_impl>(sensitivity, taps);
+    return gnuradio::make_block_sptr<pdu_gmsk_fc_impl>(
+        sensitivity, taps, samples_per_symbol);
 }
 
 /*
  * The private constructor
  */
-pdu_gmsk_fc_impl::pdu_gmsk_fc_impl(float sensitivity, const std::vector<float> taps)
+pdu_gmsk_fc_impl::pdu_gmsk_fc_impl(float sensitivity,
+                                   const std::vector<float> taps,
+                                   int samples_per_symbol)
     : gr::block("pdu_gmsk_fc",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
       d_sensitivity(sensitivity),
       d_phase(0),
-      d_taps(taps)
+      d_taps(taps),
+      d_sps(samples_per_symbol),
+      d_lut_span(0)
 {
     d_fir = new filter::kernel::fir_filter_fff(taps);
 
@@ -48,6 +57,8 @@ pdu_gmsk_fc_impl::pdu_gmsk_fc_impl(float sensitivity, const std::vector<float> t
         d_log_ramp.push_back(std::pow(10, ((float)i - 50.0) / 10.0));
     }
 
+    build_lut();
+
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
@@ -57,7 +68,127 @@ pdu_gmsk_fc_impl::pdu_gmsk_fc_impl(float sensitivity, const std::vector<float> t
 /*
  * Our virtual destructor.
  */
-pdu_gmsk_fc_impl::~pdu_gmsk_fc_impl() {}
+pdu_gmsk_fc_impl::~pdu_gmsk_fc_impl() { delete d_fir; }
+
+/*
+ * Build the symbol mode phase trajectory tables
+ *
+ * With NRZ symbols repeated sps times, the filtered frequency is the sum of one
+ * pulse (taps convolved with an sps sample rectangle) per symbol. The phase
+ * increments over the sps samples of symbol m then depend only on the symbols
+ * m..m+span, so the phase trajectory (as a unit phasor relative to the phase at
+ * the start of the symbol) is tabulated for every pattern of those symbols.
+ */
+void pdu_gmsk_fc_impl::build_lut()
+{
+    d_pulse.clear();
+    d_lut_rot.clear();
+    d_lut_end.clear();
+    if (d_sps <= 0) {
+        return;
+    }
+
+    size_t sps = d_sps;
+    size_t ntaps = std::max(d_taps.size(), (size_t)1);
+
+    // the per-sample modulator does not apply a single tap, match that
+    d_pulse.assign(ntaps + sps - 1, 0);
+    for (size_t r = 0; r < sps; r++) {
+        for (size_t t = 0; t < ntaps; t++) {
+            d_pulse[t + r] += d_sensitivity * ((d_taps.size() > 1) ? d_taps[t] : 1.0);
+        }
+    }
+
+    d_lut_span = (sps + ntaps - 2) / sps;
+    if (d_lut_span + 1 > GMSK_LUT_MAX_SPAN) {
+        GR_LOG_WARN(d_logger,
+                    boost::format("taps span %d symbols, too long to tabulate; symbols "
+                                  "will be modulated per sample") %
+                        (d_lut_span + 1));
+        return;
+    }
+
+    size_t n_patterns = 1 << (d_lut_span + 1);
+    d_lut_rot.resize(n_patterns * sps);
+    d_lut_end.resize(n_patterns);
+    for (size_t pattern = 0; pattern < n_patterns; pattern++) {
+        double phase = 0;
+        for (size_t j = 0; j < sps; j++) {
+            // bit i of the pattern is the sign of symbol m+i
+            for (size_t i = 0; i <= d_lut_span; i++) {
+                int64_t idx = (int64_t)(j + ntaps - 1) - (int64_t)(i * sps);
+                if (idx >= 0 && idx < (int64_t)d_pulse.size()) {
+                    phase += ((pattern >> i) & 1) ? d_pulse[idx] : -d_pulse[idx];
+                }
+            }
+            d_lut_rot[pattern * sps + j] = gr_complex(std::cos(phase), std::sin(phase));
+        }
+        d_lut_end[pattern] = d_lut_rot[pattern * sps + sps - 1];
+    }
+}
+
+void pdu_gmsk_fc_impl::modulate_lut(pmt::pmt_t meta, const float* symbols, size_t n_sym)
+{
+    size_t sps = d_sps;
+    size_t ntaps = d_pulse.size() - sps + 1;
+    size_t n_out = n_sym * sps;
+    if (n_out < ntaps) {
+        GR_LOG_WARN(d_logger, "PDU is shorter than the filter, dropping");
+        return;
+    }
+    // samples that the per-sample modulator computes before end-extension
+    size_t n_valid = n_out - ntaps + 1;
+
+    pmt::pmt_t out_data = pmt::make_c32vector(n_out, 0);
+    size_t out_len;
+    gr_complex* out = pmt::c32vector_writable_elements(out_data, out_len);
+
+    // symbols whose full pattern window is available
+    size_t n_blocks = (n_sym > d_lut_span) ? n_sym - d_lut_span : 0;
+    size_t pattern = 0;
+    for (size_t i = 0; i < d_lut_span && i < n_sym; i++) {
+        pattern |= size_t(symbols[i] > 0) << i;
+    }
+
+    gr_complex phasor(1, 0);
+    for (size_t m = 0; m < n_blocks; m++) {
+        pattern |= size_t(symbols[m + d_lut_span] > 0) << d_lut_span;
+        const gr_complex* rot = &d_lut_rot[pattern * sps];
+        for (size_t j = 0; j < sps; j++) {
+            out[m * sps + j] = phasor * rot[j];
+        }
+        phasor *= d_lut_end[pattern];
+        // keep the running phasor on the unit circle
+        if ((m & 0x3f) == 0x3f) {
+            phasor /= std::abs(phasor);
+        }
+        pattern >>= 1;
+    }
+
+    // the final partial window is less than a symbol of samples, compute directly
+    double phase = 0;
+    for (size_t q = n_blocks * sps; q < n_valid; q++) {
+        size_t k_end = std::min((q + ntaps - 1) / sps + 1, n_sym);
+        for (size_t k = q / sps; k < k_end; k++) {
+            size_t idx = q + ntaps - 1 - k * sps;
+            phase += (symbols[k] > 0) ? d_pulse[idx] : -d_pulse[idx];
+        }
+        out[q] = phasor * gr_complex(std::cos(phase), std::sin(phase));
+    }
+
+    // make vectors same size (by dumb end-extension)
+    for (size_t q = n_valid; q < n_out; q++) {
+        out[q] = out[n_valid - 1];
+    }
+
+    // scale the first HARDCODE 50 samples with a simple ramp function
+    size_t end_samp = std::min(d_log_ramp.size(), n_out);
+    for (size_t i = 0; i < end_samp; i++) {
+        out[i] *= d_log_ramp[i];
+    }
+
+    message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data));
+}
 
 void pdu_gmsk_fc_impl::handle_pdu(pmt::pmt_t pdu)
 {
@@ -67,13 +198,30 @@ void pdu_gmsk_fc_impl::handle_pdu(pmt::pmt_t pdu)
         return;
     }
 
-    // gr::thread::scoped_lock l(d_setlock);
+    gr::thread::scoped_lock l(d_setlock);
 
     /* code */
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
     if (pmt::is_f32vector(v_data)) {
+        if (d_sps > 0) {
+            size_t n_sym = 0;
+            const float* symbols = pmt::f32vector_elements(v_data, n_sym);
+            if (!d_lut_end.empty()) {
+                modulate_lut(meta, symbols, n_sym);
+                return;
+            }
+
+            // no table, expand symbols to samples for the per-sample modulator
+            std::vector<float> samples;
+            samples.reserve(n_sym * d_sps);
+            for (size_t ii = 0; ii < n_sym; ii++) {
+                samples.insert(samples.end(), d_sps, (symbols[ii] > 0) ? 1.0f : -1.0f);
+            }
+            v_data = pmt::init_f32vector(samples.size(), samples);
+        }
+
         uint32_t v_len = pmt::length(v_data);
 
         const std::vector<float> d_in = pmt::f32vector_elements(v_data);
@@ -141,17 +289,29 @@ void pdu_gmsk_fc_impl::handle_pdu(pmt::pmt_t pdu)
 
 void pdu_gmsk_fc_impl::set_sensitivity(float sensitivity)
 {
-    // gr::thread::scoped_lock l(d_setlock);
+    gr::thread::scoped_lock l(d_setlock);
 
     d_sensitivity = sensitivity;
+    build_lut();
 }
 
 
 void pdu_gmsk_fc_impl::set_taps(std::vector<float> taps)
 {
-    // gr::thread::scoped_lock l(d_setlock);
+    gr::thread::scoped_lock l(d_setlock);
 
     d_taps = taps;
+    d_fir->set_taps(taps);
+    build_lut();
+}
+
+
+void pdu_gmsk_fc_impl::set_samples_per_symbol(int samples_per_symbol)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_sps = samples_per_symbol;
+    build_lut();
 }
 
 } /* namespace pdu_utils */
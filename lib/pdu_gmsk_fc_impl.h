@@ -25,15 +25,27 @@ private:
     filter::kernel::fir_filter_fff* d_fir;
     std::vector<float> d_log_ramp;
 
+    // symbol mode phase trajectory tables
+    int d_sps;
+    size_t d_lut_span;
+    std::vector<double> d_pulse;
+    std::vector<gr_complex> d_lut_rot;
+    std::vector<gr_complex> d_lut_end;
+
+    void build_lut();
+    void modulate_lut(pmt::pmt_t meta, const float* symbols, size_t n_sym);
     void handle_pdu(pmt::pmt_t pdu);
 
 public:
-    pdu_gmsk_fc_impl(float sensitivity, const std::vector<float> taps);
+    pdu_gmsk_fc_impl(float sensitivity,
+                     const std::vector<float> taps,
+                     int samples_per_symbol);
 
     ~pdu_gmsk_fc_impl() override;
 
     void set_sensitivity(float sensitivity) override;
     void set_taps(std::vector<float> taps) override;
+    void set_samples_per_symbol(int samples_per_symbol) override;
 };
 
 } // namespace pdu_utils
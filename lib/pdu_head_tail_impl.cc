@@ -12,23 +12,49 @@
 #endif
 
 #include "pdu_head_tail_impl.h"
+#include "pdu_view.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
 
 namespace gr {
 namespace pdu_utils {
 
-pdu_head_tail::sptr
-pdu_head_tail::make(uint32_t input_type, uint32_t length, uint32_t histsize)
+pdu_head_tail::sptr pdu_head_tail::make(uint32_t input_type,
+                                        uint32_t length,
+                                        uint32_t histsize,
+                                        uint32_t publish_interval,
+                                        bool delta)
 {
-    return gnuradio::make_block_sptr<pdu_head_tail_impl>(input_type, length, histsize);
+    return gnuradio::make_block_sptr<pdu_head_tail_impl>(
+        input_type, length, histsize, publish_interval, delta);
 }
 
+namespace {
+
+/*
+ * Copies the first and last length items of data into head and tail, converted with
+ * conv. Short PDUs are zero padded after the head and before the tail.
+ */
+template <typename T, typename F>
+void extract_ends(const T* data, size_t n, size_t length, T* head, T* tail, F conv)
+{
+    size_t loop_size = std::min(n, length);
+    std::fill(head + loop_size, head + length, T(0));
+    std::fill(tail, tail + length - loop_size, T(0));
+    std::transform(data, data + loop_size, head, conv);
+    std::transform(data + n - loop_size, data + n, tail + length - loop_size, conv);
+}
+
+} // namespace
+
 /*
  * The private constructor
  */
 pdu_head_tail_impl::pdu_head_tail_impl(uint32_t input_type,
                                        uint32_t length,
-                                       uint32_t histsize)
+                                       uint32_t histsize,
+                                       uint32_t publish_interval,
+                                       bool delta)
     : gr::block(
           "pdu_head_tail", io_signature::make(0, 0, 0), io_signature::make(0, 0, 0)),
       d_input_type(input_type),
@@ -36,15 +62,16 @@ pdu_head_tail_impl::pdu_head_tail_impl(uint32_t input_type,
       d_maxhistsize(histsize),
       d_histsize(0),
       d_space_bytes(false),
-      d_bit_order(BIT_ORDER_LSB_FIRST)
+      d_bit_order(BIT_ORDER_LSB_FIRST),
+      d_publish_interval(std::max(publish_interval, 1u)),
+      d_delta(delta),
+      d_next(0),
+      d_updates(0)
 {
     if (d_input_type == INPUTTYPE_UNPACKED_BYTE) {
         GR_LOG_DEBUG(d_logger, "PDU HEAD/TAIL block operating in Unpacked U8 PDU mode");
     } else if (d_input_type == INPUTTYPE_PACKED_BYTE) {
-        // GR_LOG_DEBUG(d_logger, "PDU HEAD/TAIL block operating in 'Packed U8 PDU'
-        // mode");
-        GR_LOG_FATAL(d_logger, "PACKED BYTE MODE NOT SUPPORTED YET");
-        throw std::invalid_argument("invalid mode PACKED BYTE");
+        GR_LOG_DEBUG(d_logger, "PDU HEAD/TAIL block operating in Packed U8 PDU mode");
     } else if (d_input_type == INPUTTYPE_FLOAT) {
         GR_LOG_DEBUG(d_logger, "PDU HEAD/TAIL block operating in FLOAT PDU mode");
     } else {
@@ -79,183 +106,129 @@ void pdu_head_tail_impl::handle_pdu(pmt::pmt_t pdu)
 
     gr::thread::scoped_lock l(d_setlock);
 
-    /* code */
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    std::vector<uint8_t> head_bits, tail_bits;
-    head_bits.resize(d_length, 0);
-    tail_bits.resize(d_length, 0);
-    std::vector<float> head_bits_f, tail_bits_f;
-    head_bits_f.resize(d_length, 0);
-    tail_bits_f.resize(d_length, 0);
-
-    if (d_input_type == INPUTTYPE_UNPACKED_BYTE) {
-        if (!(pmt::is_dict(meta) && pmt::is_u8vector(v_data))) {
-            GR_LOG_WARN(d_logger, "PMT is not a U8 PDU, dropping");
-            return;
-        }
-
-        const std::vector<uint8_t> data = pmt::u8vector_elements(v_data);
-        uint32_t loop_size = data.size();
-        if (loop_size > d_length)
-            loop_size = d_length;
-
-        // convert head to binary
-        for (size_t ii = 0; ii < loop_size; ii++) {
-            head_bits[ii] = (data[ii] == 0) ? 0 : 1;
-        }
+    if (d_maxhistsize == 0) {
+        return;
+    }
 
-        int tail_idx = data.size() - d_length;
-        if (tail_idx < 0)
-            tail_idx = 0;
-        for (size_t ii = (d_length - loop_size); ii < d_length; ii++) {
-            tail_bits[ii] = (data[tail_idx++] == 0) ? 0 : 1;
-        }
+    // the new row overwrites the oldest row once the history is full
+    size_t row = d_next * d_length;
+    size_t n;
 
-    } else if (d_input_type == INPUTTYPE_FLOAT) {
+    if (d_input_type == INPUTTYPE_FLOAT) {
         if (!(pmt::is_dict(meta) && pmt::is_f32vector(v_data))) {
             GR_LOG_WARN(d_logger, "PMT is not a F32 PDU, dropping");
             return;
         }
+        const float* data = pmt::f32vector_elements(v_data, n);
+        extract_ends(data,
+                     n,
+                     d_length,
+                     d_head_f.data() + row,
+                     d_tail_f.data() + row,
+                     [](float x) -> float { return x; });
 
-        const std::vector<float> data = pmt::f32vector_elements(v_data);
-        uint32_t loop_size = data.size();
-        if (loop_size > d_length)
-            loop_size = d_length;
-
-        // convert head to binary
-        for (size_t ii = 0; ii < loop_size; ii++) {
-            head_bits_f[ii] = (data[ii]); // == 0) ? 0 : 1;
-        }
-
-        int tail_idx = data.size() - d_length;
-        if (tail_idx < 0)
-            tail_idx = 0;
-        for (size_t ii = (d_length - loop_size); ii < d_length; ii++) {
-            tail_bits_f[ii] = (data[tail_idx++]); // == 0) ? 0 : 1;
-        }
-
-    } else if (d_input_type == INPUTTYPE_PACKED_BYTE) {
+    } else {
         if (!(pmt::is_dict(meta) && pmt::is_u8vector(v_data))) {
             GR_LOG_WARN(d_logger, "PMT is not a U8 PDU, dropping");
             return;
         }
-
-        const std::vector<uint8_t> data = pmt::u8vector_elements(v_data);
-        uint32_t loop_size = data.size();
-        if (loop_size > d_length)
-            loop_size = d_length;
-
-        // unpack the input PDU
-        uint8_t head_byte = 0;
-        //uint8_t tail_byte = 0;
-        for (size_t ii = 0; ii < d_length; ii++) {
-            if (d_bit_order == BIT_ORDER_LSB_FIRST) {
-                // START LSB FIRST PROCESSING
-                head_byte >>= 1;
-                if (data[ii])
-                    head_byte |= 0x80;
-                if ((ii % 8) == 7) {
-                    head_bits[ii] = head_byte;
-                    head_byte = 0;
-                }
-                // END LSB FIRST PROCESSING
-            } else {
-                // START MSB FIRST PROCESSING
-                head_byte <<= 1;
-                if (data[ii])
-                    head_byte |= 0x01;
-                if ((ii % 8) == 7) {
-                    head_bits[ii] = head_byte;
-                    head_byte = 0;
-                }
-                // END MSB FIRST PROCESSING
-            }
+        const uint8_t* data = pmt::u8vector_elements(v_data, n);
+        if (d_input_type == INPUTTYPE_PACKED_BYTE) {
+            extract_packed(data, n, d_head.data() + row, d_tail.data() + row);
+        } else {
+            // convert to binary
+            extract_ends(data,
+                         n,
+                         d_length,
+                         d_head.data() + row,
+                         d_tail.data() + row,
+                         [](uint8_t x) -> uint8_t { return (x == 0) ? 0 : 1; });
         }
     }
 
-    /*
-    std::cout << "head: [" << int(head_bits[0]);
-    for (size_t ii=1;ii<d_length;ii++) std::cout << ", " << int(head_bits[ii]);
-    std::cout << "]" << std::endl;
+    if (++d_next == d_maxhistsize) {
+        d_next = 0;
+    }
+    if (d_histsize < d_maxhistsize) {
+        d_histsize++;
+    }
 
-    std::cout << "tail: [" << int(tail_bits[0]);
-    for (size_t ii=1;ii<d_length;ii++) std::cout << ", " << int(tail_bits[ii]);
-    std::cout << "]" << std::endl;
-    */
+    if ((++d_updates % d_publish_interval) != 0) {
+        return;
+    }
 
     if (d_input_type == INPUTTYPE_FLOAT) {
-        if (d_histsize < d_maxhistsize) {
-            uint32_t s = d_histsize * d_length;
-            // append the bit vectors
-            for (size_t ii = 0; ii < d_length; ii++) {
-                d_head_f[s + ii] = head_bits_f[ii];
-                d_tail_f[s + ii] = tail_bits_f[ii];
-            }
-            d_histsize++;
-        } else {
-            uint32_t s = d_maxhistsize * d_length;
-            // shift data forward
-            for (size_t ii = 0; ii < (s - d_length); ii++) {
-                d_head_f[ii] = d_head_f[ii + d_length];
-                d_tail_f[ii] = d_tail_f[ii + d_length];
-            }
-            // append the bit vector
-            s -= d_length;
-            for (size_t ii = 0; ii < d_length; ii++) {
-                d_head_f[s + ii] = head_bits_f[ii];
-                d_tail_f[s + ii] = tail_bits_f[ii];
-            }
-        }
+        publish(meta, d_head_f, d_tail_f);
+    } else {
+        publish(meta, d_head, d_tail);
+    }
+}
 
-        message_port_pub(
-            PMTCONSTSTR__head(),
-            (pmt::cons(meta, pmt::init_f32vector(d_histsize * d_length, d_head_f))));
-        message_port_pub(
-            PMTCONSTSTR__tail(),
-            (pmt::cons(meta, pmt::init_f32vector(d_histsize * d_length, d_tail_f))));
 
-    } else {
-        if (d_histsize < d_maxhistsize) {
-            uint32_t s = d_histsize * d_length;
-            // append the bit vectors
-            for (size_t ii = 0; ii < d_length; ii++) {
-                d_head[s + ii] = head_bits[ii];
-                d_tail[s + ii] = tail_bits[ii];
-            }
-            d_histsize++;
-        } else {
-            uint32_t s = d_maxhistsize * d_length;
-            // shift data forward
-            for (size_t ii = 0; ii < (s - d_length); ii++) {
-                d_head[ii] = d_head[ii + d_length];
-                d_tail[ii] = d_tail[ii + d_length];
-            }
-            // append the bit vector
-            s -= d_length;
-            for (size_t ii = 0; ii < d_length; ii++) {
-                d_head[s + ii] = head_bits[ii];
-                d_tail[s + ii] = tail_bits[ii];
-            }
-        }
+/*
+ * Unpacks only the bytes covering the first and last d_length bits of the PDU
+ */
+void pdu_head_tail_impl::extract_packed(const uint8_t* data,
+                                        size_t n_bytes,
+                                        uint8_t* head,
+                                        uint8_t* tail)
+{
+    size_t n_bits = n_bytes * 8;
+    size_t loop_size = std::min(n_bits, (size_t)d_length);
+    bool lsb = (d_bit_order == BIT_ORDER_LSB_FIRST);
+    auto bit = [data, lsb](size_t ii) -> uint8_t {
+        int shift = lsb ? (ii % 8) : (7 - (ii % 8));
+        return (data[ii / 8] >> shift) & 0x01;
+    };
+
+    std::fill(head + loop_size, head + d_length, 0);
+    std::fill(tail, tail + d_length - loop_size, 0);
+    for (size_t ii = 0; ii < loop_size; ii++) {
+        head[ii] = bit(ii);
+        tail[d_length - loop_size + ii] = bit(n_bits - loop_size + ii);
+    }
+}
 
-        /*
-        std::cout << "D_head: [" << int(d_head[0]);
-        for (size_t ii=1;ii<d_histsize*d_length;ii++) std::cout << ", " << int(d_head[ii]);
-        std::cout << "]" << std::endl;
 
-        std::cout << "D_tail: [" << int(d_tail[0]);
-        for (size_t ii=1;ii<d_histsize*d_length;ii++) std::cout << ", " << int(d_tail[ii]);
-        std::cout << "]" << std::endl;
-        */
+/*
+ * Copies the ring into a new vector oldest row first, as at most two contiguous
+ * segments
+ */
+template <typename T>
+pmt::pmt_t pdu_head_tail_impl::unroll(const std::vector<T>& ring)
+{
+    pdu_builder<T> out(d_histsize * d_length);
+    if (d_histsize < d_maxhistsize) {
+        std::copy(ring.begin(), ring.begin() + out.size(), out.begin());
+    } else {
+        size_t split = d_next * d_length;
+        std::copy(ring.begin() + split, ring.end(), out.begin());
+        std::copy(ring.begin(), ring.begin() + split, out.begin() + (ring.size() - split));
+    }
+    return out.release();
+}
 
+
+template <typename T>
+void pdu_head_tail_impl::publish(pmt::pmt_t meta,
+                                 const std::vector<T>& head,
+                                 const std::vector<T>& tail)
+{
+    if (d_delta) {
+        // the newest row is the one before d_next
+        size_t row = ((d_next + d_maxhistsize - 1) % d_maxhistsize) * d_length;
         message_port_pub(
             PMTCONSTSTR__head(),
-            (pmt::cons(meta, pmt::init_u8vector(d_histsize * d_length, d_head))));
+            pmt::cons(meta, pdu_builder<T>::copy_of(head.data() + row, d_length)));
         message_port_pub(
             PMTCONSTSTR__tail(),
-            (pmt::cons(meta, pmt::init_u8vector(d_histsize * d_length, d_tail))));
+            pmt::cons(meta, pdu_builder<T>::copy_of(tail.data() + row, d_length)));
+    } else {
+        message_port_pub(PMTCONSTSTR__head(), pmt::cons(meta, unroll(head)));
+        message_port_pub(PMTCONSTSTR__tail(), pmt::cons(meta, unroll(tail)));
     }
 }
 
@@ -287,17 +260,49 @@ void pdu_head_tail_impl::set_space_bytes(bool spacebytes)
 }
 
 
+void pdu_head_tail_impl::set_bit_order(bit_order order)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_bit_order = order;
+    reset();
+}
+
+
+void pdu_head_tail_impl::set_publish_interval(uint32_t publish_interval)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_publish_interval = std::max(publish_interval, 1u);
+    d_updates = 0;
+}
+
+
+void pdu_head_tail_impl::set_delta(bool delta)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_delta = delta;
+}
+
+
 void pdu_head_tail_impl::reset(void)
 {
     d_histsize = 0;
+    d_next = 0;
+    d_updates = 0;
     d_head.clear();
     d_tail.clear();
-    d_head.resize(d_length * d_maxhistsize, 0);
-    d_tail.resize(d_length * d_maxhistsize, 0);
     d_head_f.clear();
     d_tail_f.clear();
-    d_head_f.resize(d_length * d_maxhistsize, 0);
-    d_tail_f.resize(d_length * d_maxhistsize, 0);
+    // only the history for the input type is allocated
+    if (d_input_type == INPUTTYPE_FLOAT) {
+        d_head_f.resize(d_length * d_maxhistsize, 0);
+        d_tail_f.resize(d_length * d_maxhistsize, 0);
+    } else {
+        d_head.resize(d_length * d_maxhistsize, 0);
+        d_tail.resize(d_length * d_maxhistsize, 0);
+    }
 }
 
 } /* namespace pdu_utils */
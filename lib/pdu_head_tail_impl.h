@@ -24,7 +24,14 @@ private:
     uint32_t d_maxhistsize;
     uint32_t d_histsize;
     bool d_space_bytes;
-    uint32_t d_bit_order;
+    bit_order d_bit_order;
+    uint32_t d_publish_interval;
+    bool d_delta;
+
+    // history is a ring of d_maxhistsize rows of d_length items, d_next is the row
+    // written by the next update and once full is also the oldest row
+    uint32_t d_next;
+    uint64_t d_updates;
 
     void reset(void);
 
@@ -34,15 +41,27 @@ private:
     std::vector<float> d_tail_f;
 
     void handle_pdu(pmt::pmt_t pdu);
+    void extract_packed(const uint8_t* data, size_t n_bytes, uint8_t* head, uint8_t* tail);
+    template <typename T>
+    void publish(pmt::pmt_t meta, const std::vector<T>& head, const std::vector<T>& tail);
+    template <typename T>
+    pmt::pmt_t unroll(const std::vector<T>& ring);
 
 public:
-    pdu_head_tail_impl(uint32_t input_type, uint32_t length, uint32_t histsize);
+    pdu_head_tail_impl(uint32_t input_type,
+                       uint32_t length,
+                       uint32_t histsize,
+                       uint32_t publish_interval,
+                       bool delta);
 
     ~pdu_head_tail_impl() override;
 
     void set_length(uint32_t length) override;
     void set_histsize(uint32_t histsize) override;
     void set_space_bytes(bool spacebytes) override;
+    void set_bit_order(bit_order order) override;
+    void set_publish_interval(uint32_t publish_interval) override;
+    void set_delta(bool delta) override;
 };
 
 } // namespace pdu_utils
@@ -0,0 +1,229 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gnuradio/gr_complex.h>
+#include <gnuradio/pdu_utils/pdu_log_reader.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace pdu_utils {
+
+static_assert(sizeof(pdu_log_header) == 32, "pdu_log_header layout changed");
+static_assert(sizeof(pdu_log_record) == 56, "pdu_log_record layout changed");
+
+namespace {
+
+bool time_less(const pdu_log_record& r, uint64_t sec, double frac)
+{
+    return r.time_sec < sec || (r.time_sec == sec && r.time_frac < frac);
+}
+
+} // namespace
+
+pdu_log_reader::pdu_log_reader(const std::string& filename)
+    : d_records(nullptr), d_nrecords(0), d_sorted_pdu_num(true), d_sorted_time(true)
+{
+    try {
+        map_file(filename, d_data);
+        map_file(filename + ".idx", d_index);
+        map_file(filename + ".meta", d_meta, true);
+    } catch (...) {
+        unmap_file(d_data);
+        unmap_file(d_index);
+        unmap_file(d_meta);
+        throw;
+    }
+
+    const pdu_log_header* header = (const pdu_log_header*)d_index.addr;
+    if (d_index.size < sizeof(pdu_log_header) ||
+        memcmp(header->magic, PDU_LOG_MAGIC, sizeof(PDU_LOG_MAGIC)) != 0 ||
+        header->version != PDU_LOG_VERSION ||
+        header->record_size != sizeof(pdu_log_record)) {
+        unmap_file(d_data);
+        unmap_file(d_index);
+        unmap_file(d_meta);
+        throw std::runtime_error("pdu_log_reader: " + filename +
+                                 ".idx is not a valid pdu_logger index");
+    }
+
+    // the header is 32 bytes and mmap is page aligned, so records are aligned
+    d_records = (const pdu_log_record*)(d_index.addr + sizeof(pdu_log_header));
+    size_t n = (d_index.size - sizeof(pdu_log_header)) / sizeof(pdu_log_record);
+
+    // records are written in file order, stop at the first one past the end of the
+    // data so a partially written file is still readable
+    for (d_nrecords = 0; d_nrecords < n; d_nrecords++) {
+        const pdu_log_record& r = d_records[d_nrecords];
+        if (r.data_offset + r.data_length > d_data.size ||
+            r.meta_offset + r.meta_length > d_meta.size || item_size(r.dtype) == 0) {
+            break;
+        }
+        if (d_nrecords > 0) {
+            const pdu_log_record& prev = d_records[d_nrecords - 1];
+            d_sorted_pdu_num = d_sorted_pdu_num && prev.pdu_num <= r.pdu_num;
+            d_sorted_time =
+                d_sorted_time && !time_less(r, prev.time_sec, prev.time_frac);
+        }
+    }
+}
+
+pdu_log_reader::~pdu_log_reader()
+{
+    unmap_file(d_data);
+    unmap_file(d_index);
+    unmap_file(d_meta);
+}
+
+void pdu_log_reader::map_file(const std::string& path, mapping& m, bool optional)
+{
+    m.fd = ::open(path.c_str(), O_RDONLY);
+    if (m.fd < 0 && optional && errno == ENOENT) {
+        return;
+    }
+    if (m.fd < 0) {
+        throw std::runtime_error("pdu_log_reader: cannot open " + path + ": " +
+                                 strerror(errno));
+    }
+    struct stat st;
+    if (fstat(m.fd, &st) != 0) {
+        throw std::runtime_error("pdu_log_reader: cannot stat " + path + ": " +
+                                 strerror(errno));
+    }
+    m.size = st.st_size;
+    // empty files cannot be mapped
+    if (m.size > 0) {
+        void* addr = mmap(nullptr, m.size, PROT_READ, MAP_SHARED, m.fd, 0);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("pdu_log_reader: cannot map " + path + ": " +
+                                     strerror(errno));
+        }
+        m.addr = (const uint8_t*)addr;
+    }
+}
+
+void pdu_log_reader::unmap_file(mapping& m)
+{
+    if (m.addr) {
+        munmap((void*)m.addr, m.size);
+    }
+    if (m.fd >= 0) {
+        ::close(m.fd);
+    }
+    m = mapping();
+}
+
+size_t pdu_log_reader::item_size(uint8_t dtype)
+{
+    switch (dtype) {
+    case PDU_LOG_C32:
+        return sizeof(gr_complex);
+    case PDU_LOG_F32:
+        return sizeof(float);
+    case PDU_LOG_U8:
+        return sizeof(uint8_t);
+    default:
+        return 0;
+    }
+}
+
+const pdu_log_record& pdu_log_reader::record(size_t i) const
+{
+    if (i >= d_nrecords) {
+        throw std::out_of_range("pdu_log_reader: PDU index out of range");
+    }
+    return d_records[i];
+}
+
+const void* pdu_log_reader::data(size_t i) const
+{
+    return d_data.addr + record(i).data_offset;
+}
+
+size_t pdu_log_reader::nitems(size_t i) const
+{
+    const pdu_log_record& r = record(i);
+    return r.data_length / item_size(r.dtype);
+}
+
+pmt::pmt_t pdu_log_reader::metadata(size_t i) const
+{
+    const pdu_log_record& r = record(i);
+    if (r.meta_length == 0) {
+        return pmt::make_dict();
+    }
+    return pmt::deserialize_str(
+        std::string((const char*)d_meta.addr + r.meta_offset, r.meta_length));
+}
+
+pmt::pmt_t pdu_log_reader::pdu(size_t i) const
+{
+    const pdu_log_record& r = record(i);
+    size_t n = nitems(i);
+    pmt::pmt_t vec;
+    switch (r.dtype) {
+    case PDU_LOG_C32:
+        vec = pmt::init_c32vector(n, (const gr_complex*)data(i));
+        break;
+    case PDU_LOG_F32:
+        vec = pmt::init_f32vector(n, (const float*)data(i));
+        break;
+    default:
+        vec = pmt::init_u8vector(n, (const uint8_t*)data(i));
+        break;
+    }
+    return pmt::cons(metadata(i), vec);
+}
+
+size_t pdu_log_reader::find_pdu_num(uint64_t pdu_num) const
+{
+    const pdu_log_record* end = d_records + d_nrecords;
+    auto before = [](const pdu_log_record& r, uint64_t v) { return r.pdu_num < v; };
+    if (d_sorted_pdu_num) {
+        return std::lower_bound(d_records, end, pdu_num, before) - d_records;
+    }
+    return std::find_if(d_records,
+                        end,
+                        [&](const pdu_log_record& r) { return !before(r, pdu_num); }) -
+           d_records;
+}
+
+size_t pdu_log_reader::find_time(uint64_t sec, double frac) const
+{
+    const pdu_log_record* end = d_records + d_nrecords;
+    if (d_sorted_time) {
+        return std::lower_bound(d_records,
+                                end,
+                                sec,
+                                [frac](const pdu_log_record& r, uint64_t s) {
+                                    return time_less(r, s, frac);
+                                }) -
+               d_records;
+    }
+    return std::find_if(d_records,
+                        end,
+                        [&](const pdu_log_record& r) {
+                            return !time_less(r, sec, frac);
+                        }) -
+           d_records;
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,249 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_log_source_impl.h"
+#include <gnuradio/block_registry.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+
+namespace gr {
+namespace pdu_utils {
+
+// longest single wait, so stop() is never delayed by a slow rate
+static const int64_t MAX_WAIT_US = 100000;
+// poll interval while downstream queues are full
+static const int64_t DOWNSTREAM_POLL_US = 100;
+
+pdu_log_source::sptr pdu_log_source::make(std::string filename,
+                                          replay_mode mode,
+                                          double rate,
+                                          uint32_t queue_depth,
+                                          bool repeat)
+{
+    return gnuradio::make_block_sptr<pdu_log_source_impl>(
+        filename, mode, rate, queue_depth, repeat);
+}
+
+/*
+ * The private constructor
+ */
+pdu_log_source_impl::pdu_log_source_impl(std::string filename,
+                                         replay_mode mode,
+                                         double rate,
+                                         uint32_t queue_depth,
+                                         bool repeat)
+    : gr::block("pdu_log_source",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_reader(new pdu_log_reader(filename)),
+      d_mode(mode),
+      d_queue_depth(std::max(queue_depth, 1u)),
+      d_repeat(repeat),
+      d_finished(true),
+      d_emitted(0),
+      d_done(false)
+{
+    set_rate(rate);
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_log_source_impl::~pdu_log_source_impl() { stop_thread(); }
+
+bool pdu_log_source_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_thread) {
+        d_finished = false;
+        d_emitted = 0;
+        d_done = false;
+        d_thread = std::make_shared<gr::thread::thread>([this]() { this->run(); });
+    }
+    return block::start();
+}
+
+bool pdu_log_source_impl::stop()
+{
+    stop_thread();
+    return block::stop();
+}
+
+void pdu_log_source_impl::stop_thread()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void pdu_log_source_impl::set_rate(double rate)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (rate <= 0) {
+        GR_LOG_WARN(d_logger, "rate must be positive, using 1");
+        rate = 1;
+    }
+    d_rate = rate;
+}
+
+double pdu_log_source_impl::get_rate()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_rate;
+}
+
+/*
+ * Sleeps until the deadline, returns false if the block was stopped first
+ */
+bool pdu_log_source_impl::wait_until(clock::time_point deadline)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    while (!d_finished) {
+        int64_t remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                                deadline - clock::now())
+                                .count();
+        if (remaining <= 0) {
+            return true;
+        }
+        d_cond.timed_wait(
+            l, boost::posix_time::microseconds(std::min(remaining, MAX_WAIT_US)));
+    }
+    return false;
+}
+
+/*
+ * Largest number of messages waiting at an input port subscribed to pdu_out
+ */
+size_t pdu_log_source_impl::downstream_depth()
+{
+    size_t depth = 0;
+    pmt::pmt_t subscribers = message_subscribers(PMTCONSTSTR__pdu_out());
+    while (pmt::is_pair(subscribers)) {
+        pmt::pmt_t target = pmt::car(subscribers);
+        basic_block_sptr block = global_block_registry.block_lookup(pmt::car(target));
+        if (block) {
+            depth = std::max(depth, block->nmsgs(pmt::cdr(target)));
+        }
+        subscribers = pmt::cdr(subscribers);
+    }
+    return depth;
+}
+
+/*
+ * Waits until every downstream queue has room, returns false if the block was
+ * stopped first
+ */
+bool pdu_log_source_impl::wait_for_downstream()
+{
+    while (downstream_depth() >= d_queue_depth) {
+        gr::thread::scoped_lock l(d_mutex);
+        if (d_finished) {
+            return false;
+        }
+        d_cond.timed_wait(l, boost::posix_time::microseconds(DOWNSTREAM_POLL_US));
+    }
+    gr::thread::scoped_lock l(d_mutex);
+    return !d_finished;
+}
+
+void pdu_log_source_impl::run()
+{
+    const size_t n = d_reader->size();
+    if (n == 0) {
+        GR_LOG_WARN(d_logger, "file contains no PDUs");
+        d_done = true;
+        return;
+    }
+
+    clock::time_point next = clock::now();
+    do {
+        // timestamp pacing is relative to the first timed PDU of each pass, and is
+        // restarted from the current PDU when the rate changes
+        bool anchored = false;
+        const pdu_log_record* anchor = nullptr;
+        clock::time_point anchor_wall;
+        double anchor_rate = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            double rate = get_rate();
+            bool ok = true;
+
+            if (d_mode == REPLAY_RATE) {
+                ok = wait_until(next);
+                next += std::chrono::duration_cast<clock::duration>(
+                    std::chrono::duration<double>(1.0 / rate));
+            } else if (d_mode == REPLAY_ASAP) {
+                ok = wait_for_downstream();
+            } else {
+                const pdu_log_record& r = d_reader->record(i);
+                if (r.flags & pdu_log_record::HAS_TIME) {
+                    if (!anchored || rate != anchor_rate) {
+                        anchored = true;
+                        anchor = &r;
+                        anchor_wall = clock::now();
+                        anchor_rate = rate;
+                    }
+                    double elapsed = ((double)r.time_sec - (double)anchor->time_sec) +
+                                     (r.time_frac - anchor->time_frac);
+                    // PDUs recorded out of order are sent immediately
+                    if (elapsed > 0) {
+                        ok = wait_until(
+                            anchor_wall +
+                            std::chrono::duration_cast<clock::duration>(
+                                std::chrono::duration<double>(elapsed / rate)));
+                    }
+                }
+            }
+
+            if (!ok) {
+                return;
+            }
+
+            // index and metadata files may be hand written or come from elsewhere, a
+            // corrupt record is skipped rather than ending the thread
+            pmt::pmt_t pdu = pmt::PMT_NIL;
+            try {
+                pdu = d_reader->pdu(i);
+            } catch (const std::exception& e) {
+                GR_LOG_WARN(d_logger,
+                            boost::format("skipping PDU %d, bad metadata: %s") % i %
+                                e.what());
+            }
+            if (pmt::is_pdu(pdu)) {
+                message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
+                d_emitted++;
+            } else if (!pmt::is_null(pdu)) {
+                GR_LOG_WARN(d_logger,
+                            boost::format("skipping PDU %d, metadata is not a dict") % i);
+            }
+
+            gr::thread::scoped_lock l(d_mutex);
+            if (d_finished) {
+                return;
+            }
+        }
+    } while (d_repeat);
+
+    d_done = true;
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_IMPL_H
+
+#include <gnuradio/pdu_utils/pdu_log_reader.h>
+#include <gnuradio/pdu_utils/pdu_log_source.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_log_source_impl : public pdu_log_source
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    std::unique_ptr<pdu_log_reader> d_reader;
+    replay_mode d_mode;
+    double d_rate;
+    size_t d_queue_depth;
+    bool d_repeat;
+
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_cond;
+    bool d_finished;
+    std::shared_ptr<gr::thread::thread> d_thread;
+
+    std::atomic<uint64_t> d_emitted;
+    std::atomic<bool> d_done;
+
+    void run();
+    void stop_thread();
+    double get_rate();
+    bool wait_until(clock::time_point deadline);
+    bool wait_for_downstream();
+    size_t downstream_depth();
+
+public:
+    pdu_log_source_impl(std::string filename,
+                        replay_mode mode,
+                        double rate,
+                        uint32_t queue_depth,
+                        bool repeat);
+    ~pdu_log_source_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    void set_rate(double rate) override;
+    uint64_t get_size() override { return d_reader->size(); }
+    uint64_t get_emitted() override { return d_emitted; }
+    bool is_done() override { return d_done; }
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_LOG_SOURCE_IMPL_H */
@@ -13,45 +13,74 @@
 
 #include "pdu_logger_impl.h"
 #include <gnuradio/io_signature.h>
-#include <cerrno>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 
 namespace gr {
 namespace pdu_utils {
 
-pdu_logger::sptr pdu_logger::make(std::string logfile, uint32_t pdus_per_file)
+// output file buffer size, a multiple of the O_DIRECT alignment
+static const size_t WRITE_BUFFER_SIZE = 1 << 20;
+static const size_t INDEX_BUFFER_SIZE = 1 << 16;
+
+// file name and extension of each supported type
+static const char* TYPE_NAMES[] = { "c32", "f32", "u8" };
+static const char* TYPE_EXTENSIONS[] = { "fc32", "f32", "u8" };
+
+pdu_logger::sptr pdu_logger::make(std::string logfile,
+                                  uint32_t pdus_per_file,
+                                  uint32_t queue_depth,
+                                  bool backpressure,
+                                  fsync_policy fsync,
+                                  bool direct_io,
+                                  bool index)
 {
-    return gnuradio::make_block_sptr<pdu_logger_impl>(logfile, pdus_per_file);
+    return gnuradio::make_block_sptr<pdu_logger_impl>(
+        logfile, pdus_per_file, queue_depth, backpressure, fsync, direct_io, index);
 }
 
 pdu_logger::sptr pdu_logger::make(std::string logfile)
 {
-    return gnuradio::make_block_sptr<pdu_logger_impl>(logfile);
+    return gnuradio::make_block_sptr<pdu_logger_impl>(
+        logfile, 1, 1024, false, FSYNC_NEVER, false, false);
 }
 
 /*
  * The private constructor
  */
-pdu_logger_impl::pdu_logger_impl(std::string logfile, uint32_t pdus_per_file)
+pdu_logger_impl::pdu_logger_impl(std::string logfile,
+                                 uint32_t pdus_per_file,
+                                 uint32_t queue_depth,
+                                 bool backpressure,
+                                 fsync_policy fsync,
+                                 bool direct_io,
+                                 bool index)
     : gr::block(
           "pdu_logger", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
       d_logfile(logfile),
       d_pdus_per_file(pdus_per_file),
+      d_fsync(fsync),
+      d_index(index),
       d_burstnum(0),
-      d_filenum(0)
+      d_filenum(0),
+      d_queue_depth(std::max(queue_depth, 1u)),
+      d_backpressure(backpressure),
+      d_finished(true),
+      d_written(0),
+      d_dropped(0),
+      d_backpressure_waits(0)
 {
-    message_port_register_in(PMTCONSTSTR__pdu_in());
-    set_msg_handler(PMTCONSTSTR__pdu_in(),
-                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
-}
+    for (int ii = 0; ii < NUM_TYPES; ii++) {
+        d_files[ii].reset(new pdu_file_writer(d_logger, WRITE_BUFFER_SIZE, direct_io));
+        if (d_index) {
+            d_index_files[ii].reset(
+                new pdu_file_writer(d_logger, INDEX_BUFFER_SIZE, false));
+            d_meta_files[ii].reset(
+                new pdu_file_writer(d_logger, INDEX_BUFFER_SIZE, false));
+        }
+    }
 
-pdu_logger_impl::pdu_logger_impl(std::string logfile)
-    : gr::block(
-          "pdu_logger", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
-      d_logfile(logfile),
-      d_pdus_per_file(1),
-      d_burstnum(0),
-      d_filenum(0)
-{
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
@@ -60,7 +89,54 @@ pdu_logger_impl::pdu_logger_impl(std::string logfile)
 /*
  * Our virtual destructor.
  */
-pdu_logger_impl::~pdu_logger_impl() {}
+pdu_logger_impl::~pdu_logger_impl()
+{
+    stop_writer();
+    for (auto& item : d_queue) {
+        write_pdu(item.first, item.second);
+    }
+    close_files();
+}
+
+bool pdu_logger_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_thread) {
+        d_finished = false;
+        d_thread =
+            std::make_shared<gr::thread::thread>([this]() { this->run_writer(); });
+    }
+    return block::start();
+}
+
+bool pdu_logger_impl::stop()
+{
+    // the writer drains any queued PDUs and closes its files before exiting
+    stop_writer();
+    return block::stop();
+}
+
+void pdu_logger_impl::stop_writer()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_queue_cond.notify_all();
+    d_space_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void pdu_logger_impl::set_backpressure(bool backpressure)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_backpressure = backpressure;
+    d_space_cond.notify_all();
+}
 
 void pdu_logger_impl::handle_pdu(pmt::pmt_t pdu)
 {
@@ -71,90 +147,186 @@ void pdu_logger_impl::handle_pdu(pmt::pmt_t pdu)
     }
 
     pmt::pmt_t samples = pmt::cdr(pdu);
-    size_t N = pmt::length(samples);
-
+    data_type type;
     if (pmt::is_c32vector(samples)) {
-        const gr_complex* burst = (const gr_complex*)pmt::c32vector_elements(samples, N);
-        write_data_c32(burst, N, (char*)"c32", d_filenum);
+        type = TYPE_C32;
     } else if (pmt::is_f32vector(samples)) {
-        const float* burst = (const float*)pmt::f32vector_elements(samples, N);
-        write_data_f32(burst, N, (char*)"f32", d_filenum);
+        type = TYPE_F32;
     } else if (pmt::is_u8vector(samples)) {
-        const char* burst = (const char*)pmt::u8vector_elements(samples, N);
-        write_data_u8(burst, N, (char*)"u8", d_filenum);
+        type = TYPE_U8;
     } else {
         GR_LOG_NOTICE(d_logger, "Received PDU of unhandled data type (C32, F32, U8 supported). Dropping.");
         return;
     }
+
+    // PDUs queued while the writer is not running are written when it is next
+    // started, or when the block is destroyed
+    gr::thread::scoped_lock l(d_mutex);
+    if (d_queue.size() >= d_queue_depth && d_backpressure && !d_finished) {
+        d_backpressure_waits++;
+        while (!d_finished && d_backpressure && d_queue.size() >= d_queue_depth) {
+            d_space_cond.wait(l);
+        }
+    }
+    // still full if not waiting, or if there is no writer running to make space
+    if (d_queue.size() >= d_queue_depth) {
+        uint64_t dropped = ++d_dropped;
+        // log the first drop and then at powers of two
+        if ((dropped & (dropped - 1)) == 0) {
+            GR_LOG_WARN(d_logger,
+                        boost::format("writer queue full, %d PDUs dropped") % dropped);
+        }
+        return;
+    }
+
+    d_queue.emplace_back(type, pdu);
+    d_queue_cond.notify_one();
+}
+
+void pdu_logger_impl::run_writer()
+{
+    std::deque<std::pair<data_type, pmt::pmt_t>> batch;
+
+    while (true) {
+        {
+            gr::thread::scoped_lock l(d_mutex);
+            while (!d_finished && d_queue.empty()) {
+                d_queue_cond.wait(l);
+            }
+            if (d_queue.empty()) {
+                break;
+            }
+            // take everything queued so the handler is only blocked for the swap
+            batch.swap(d_queue);
+            d_space_cond.notify_all();
+        }
+
+        for (auto& item : batch) {
+            write_pdu(item.first, item.second);
+        }
+        batch.clear();
+    }
+
+    close_files();
+}
+
+/*
+ * Appends the PDU to the current file of its type, opening it if this is the first
+ * PDU of the type in the current file group
+ */
+void pdu_logger_impl::write_pdu(data_type type, pmt::pmt_t pdu)
+{
+    pdu_file_writer& file = *d_files[type];
+    if (!file.is_open()) {
+        char filename[512];
+        snprintf(filename,
+                 sizeof(filename),
+                 "%s%s_%04d.%s",
+                 d_logfile.c_str(),
+                 TYPE_NAMES[type],
+                 d_filenum,
+                 TYPE_EXTENSIONS[type]);
+        // the first PDU of a file group truncates, later ones append
+        bool append = d_burstnum != 0;
+        if (file.open(filename, append) && d_index) {
+            d_index_files[type]->open(std::string(filename) + ".idx", append);
+            d_meta_files[type]->open(std::string(filename) + ".meta", append);
+        }
+    }
+
+    size_t len;
+    const void* data = pmt::uniform_vector_elements(pmt::cdr(pdu), len);
+    if (file.is_open()) {
+        uint64_t offset = file.size();
+        file.write(data, len);
+        if (d_index) {
+            write_index(type, pmt::car(pdu), offset, len);
+        }
+        if (d_fsync == FSYNC_EVERY_PDU) {
+            file.sync();
+            if (d_index) {
+                d_meta_files[type]->sync();
+                d_index_files[type]->sync();
+            }
+        }
+        d_written++;
+    }
+
     if (++d_burstnum == d_pdus_per_file) {
         d_burstnum = 0;
         d_filenum++;
+        close_files();
     }
 }
 
-void pdu_logger_impl::write_data_c32(const gr_complex* data,
-                                   size_t len,
-                                   char* name,
-                                   int num)
+void pdu_logger_impl::write_index(data_type type,
+                                  pmt::pmt_t meta,
+                                  uint64_t offset,
+                                  uint64_t length)
 {
-    char filename[512];
-    std::string str_fopen;
-    if (d_burstnum == 0) {
-        str_fopen = "wb";
-    }
-    else {
-        str_fopen = "ab";
-    }
-    sprintf(filename, "%s%s_%04d.fc32", d_logfile.c_str(), name, num);
-    FILE* fp = fopen(filename, str_fopen.c_str());
-    if (fp == NULL) {
-        char msg[128] = "Error opening ";
-        perror(strcat(msg, filename));
-    } else {
-        fwrite(data, sizeof(gr_complex), len, fp);
-        fclose(fp);
+    pdu_file_writer& index = *d_index_files[type];
+    pdu_file_writer& metafile = *d_meta_files[type];
+    if (!index.is_open() || !metafile.is_open()) {
+        return;
     }
-}
 
-void pdu_logger_impl::write_data_f32(const float* data, size_t len, char* name, int num)
-{
-    char filename[512];
-    std::string str_fopen;
-    if (d_burstnum == 0) {
-        str_fopen = "wb";
-    }
-    else {
-        str_fopen = "ab";
-    }
-    sprintf(filename, "%s%s_%04d.f32", d_logfile.c_str(), name, num);
-    FILE* fp = fopen(filename, str_fopen.c_str());
-    if (fp == NULL) {
-        char msg[128] = "Error opening ";
-        perror(strcat(msg, filename));
-    } else {
-        fwrite(data, sizeof(float), len, fp);
-        fclose(fp);
+    if (index.size() == 0) {
+        pdu_log_header header = {};
+        memcpy(header.magic, PDU_LOG_MAGIC, sizeof(PDU_LOG_MAGIC));
+        header.version = PDU_LOG_VERSION;
+        header.record_size = sizeof(pdu_log_record);
+        index.write(&header, sizeof(header));
     }
+
+    pdu_log_record record = {};
+    record.dtype = type;
+    record.data_offset = offset;
+    record.data_length = length;
+
+    // position in the file, for PDUs without a pdu_num
+    record.pdu_num = (index.size() - sizeof(pdu_log_header)) / sizeof(pdu_log_record);
+    pmt::pmt_t pdu_num = pmt::dict_ref(meta, PMTCONSTSTR__pdu_num(), pmt::PMT_NIL);
+    if (pmt::is_uint64(pdu_num) ||
+        (pmt::is_integer(pdu_num) && pmt::to_long(pdu_num) >= 0)) {
+        record.pdu_num = pmt::to_uint64(pdu_num);
+        record.flags |= pdu_log_record::HAS_PDU_NUM;
+    }
+
+    pmt::pmt_t burst_time = pmt::dict_ref(meta, PMTCONSTSTR__burst_time(), pmt::PMT_NIL);
+    pmt::pmt_t start_time = pmt::dict_ref(meta, PMTCONSTSTR__start_time(), pmt::PMT_NIL);
+    pmt::pmt_t sec = pmt::PMT_NIL;
+    pmt::pmt_t frac = pmt::PMT_NIL;
+    if (pmt::is_tuple(burst_time) && pmt::length(burst_time) == 2) {
+        sec = pmt::tuple_ref(burst_time, 0);
+        frac = pmt::tuple_ref(burst_time, 1);
+    }
+    if ((pmt::is_uint64(sec) || (pmt::is_integer(sec) && pmt::to_long(sec) >= 0)) &&
+        pmt::is_real(frac)) {
+        record.time_sec = pmt::to_uint64(sec);
+        record.time_frac = pmt::to_double(frac);
+        record.flags |= pdu_log_record::HAS_TIME;
+    } else if (pmt::is_real(start_time) && pmt::to_double(start_time) >= 0) {
+        double t = pmt::to_double(start_time);
+        record.time_sec = (uint64_t)t;
+        record.time_frac = t - record.time_sec;
+        record.flags |= pdu_log_record::HAS_TIME;
+    }
+
+    std::string serialized = pmt::serialize_str(meta);
+    record.meta_offset = metafile.size();
+    record.meta_length = serialized.size();
+    metafile.write(serialized.data(), serialized.size());
+    index.write(&record, sizeof(record));
 }
 
-void pdu_logger_impl::write_data_u8(const char* data, size_t len, char* name, int num)
+void pdu_logger_impl::close_files()
 {
-    char filename[512];
-    std::string str_fopen;
-    if (d_burstnum == 0) {
-        str_fopen = "wb";
-    }
-    else {
-        str_fopen = "ab";
-    }
-    sprintf(filename, "%s%s_%04d.u8", d_logfile.c_str(), name, num);
-    FILE* fp = fopen(filename, str_fopen.c_str());
-    if (fp == NULL) {
-        char msg[128] = "Error opening ";
-        perror(strcat(msg, filename));
-    } else {
-        fwrite(data, sizeof(char), len, fp);
-        fclose(fp);
+    for (int ii = 0; ii < NUM_TYPES; ii++) {
+        d_files[ii]->close(d_fsync != FSYNC_NEVER);
+        if (d_index) {
+            d_meta_files[ii]->close(d_fsync != FSYNC_NEVER);
+            d_index_files[ii]->close(d_fsync != FSYNC_NEVER);
+        }
     }
 }
 
@@ -10,31 +10,80 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_LOGGER_IMPL_H
 #define INCLUDED_PDU_UTILS_PDU_LOGGER_IMPL_H
 
+#include "pdu_file_writer.h"
 #include <gnuradio/pdu_utils/constants.h>
+#include <gnuradio/pdu_utils/pdu_log_reader.h>
 #include <gnuradio/pdu_utils/pdu_logger.h>
 
+#include <atomic>
+#include <deque>
+#include <memory>
+
 namespace gr {
 namespace pdu_utils {
 
 class pdu_logger_impl : public pdu_logger
 {
 private:
+    // supported vector types, one output file per type is open at a time
+    enum data_type {
+        TYPE_C32 = PDU_LOG_C32,
+        TYPE_F32 = PDU_LOG_F32,
+        TYPE_U8 = PDU_LOG_U8,
+        NUM_TYPES
+    };
+
     std::string d_logfile;
     uint32_t d_pdus_per_file;
+    fsync_policy d_fsync;
+    bool d_index;
+
+    // writer thread state, only touched by the writer thread while it runs
     uint32_t d_burstnum;
     uint32_t d_filenum;
+    std::unique_ptr<pdu_file_writer> d_files[NUM_TYPES];
+    std::unique_ptr<pdu_file_writer> d_index_files[NUM_TYPES];
+    std::unique_ptr<pdu_file_writer> d_meta_files[NUM_TYPES];
 
-    void write_data_c32(const gr_complex* data, size_t len, char* name, int num);
-    void write_data_f32(const float* data, size_t len, char* name, int num);
-    void write_data_u8(const char* data, size_t len, char* name, int num);
+    // queue of PDUs waiting for the writer thread
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_queue_cond;
+    gr::thread::condition_variable d_space_cond;
+    std::deque<std::pair<data_type, pmt::pmt_t>> d_queue;
+    size_t d_queue_depth;
+    bool d_backpressure;
+    bool d_finished;
+    std::shared_ptr<gr::thread::thread> d_thread;
+
+    std::atomic<uint64_t> d_written;
+    std::atomic<uint64_t> d_dropped;
+    std::atomic<uint64_t> d_backpressure_waits;
 
     void handle_pdu(pmt::pmt_t pdu);
+    void run_writer();
+    void write_pdu(data_type type, pmt::pmt_t pdu);
+    void write_index(data_type type, pmt::pmt_t meta, uint64_t offset, uint64_t length);
+    void close_files();
+    void stop_writer();
 
 public:
-    pdu_logger_impl(std::string logfile, uint32_t pdus_per_file);
-    pdu_logger_impl(std::string logfile);
+    pdu_logger_impl(std::string logfile,
+                    uint32_t pdus_per_file,
+                    uint32_t queue_depth,
+                    bool backpressure,
+                    fsync_policy fsync,
+                    bool direct_io,
+                    bool index);
 
     ~pdu_logger_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    uint64_t get_written() override { return d_written; }
+    uint64_t get_dropped() override { return d_dropped; }
+    uint64_t get_backpressure_waits() override { return d_backpressure_waits; }
+    void set_backpressure(bool backpressure) override;
 };
 
 } // namespace pdu_utils
@@ -12,6 +12,7 @@
 #endif
 
 #include "complex"
+#include <cmath>
 #include "pdu_pfb_resamp_impl.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
@@ -19,12 +20,71 @@
 namespace gr {
 namespace pdu_utils {
 
+namespace {
+// upper bounds on the rational filterbank size before falling back to the
+// arbitrary resampling kernel
+const uint32_t MAX_RATIONAL_INTERP = 1024;
+const uint32_t MAX_RATIONAL_DECIM = 65536;
+// number of rational filterbanks cached before the cache is flushed
+const size_t MAX_RATIONAL_KERNELS = 16;
+// default relative tolerance, slightly larger than float precision so that
+// single precision rates such as 0.8f are still recognized as 4/5
+const double DEFAULT_RATIONAL_TOLERANCE = 1e-7;
+// PDUs queued per worker thread before the message handler blocks
+const size_t MAX_QUEUED_PER_THREAD = 4;
+
+/*
+ * Find the first continued fraction convergent interp/decim of rate that is
+ * within the relative tolerance, returns false if none exists within the size
+ * limits above.
+ */
+bool rational_approx(double rate, double tolerance, uint32_t& interp, uint32_t& decim)
+{
+    if (!(rate > 0) || !(tolerance > 0)) {
+        return false;
+    }
+
+    uint64_t h0 = 0, h1 = 1, k0 = 1, k1 = 0;
+    double x = rate;
+    for (int ii = 0; ii < 32; ii++) {
+        double a = std::floor(x);
+        if (a > MAX_RATIONAL_DECIM) {
+            return false;
+        }
+        uint64_t h2 = (uint64_t)a * h1 + h0;
+        uint64_t k2 = (uint64_t)a * k1 + k0;
+        if (h2 > MAX_RATIONAL_INTERP || k2 > MAX_RATIONAL_DECIM) {
+            return false;
+        }
+        if (h2 > 0 && std::fabs((double)h2 / k2 - rate) <= tolerance * rate) {
+            interp = h2;
+            decim = k2;
+            return true;
+        }
+        double frac = x - a;
+        if (frac < 1e-12) {
+            return false;
+        }
+        x = 1.0 / frac;
+        h0 = h1;
+        h1 = h2;
+        k0 = k1;
+        k1 = k2;
+    }
+    return false;
+}
+} // namespace
+
 template <class T, class S>
-typename pdu_pfb_resamp<T, S>::sptr
-pdu_pfb_resamp<T, S>::make(const std::vector<S> taps, int n_filters, float resamp_rate)
+typename pdu_pfb_resamp<T, S>::sptr pdu_pfb_resamp<T, S>::make(const std::vector<S> taps,
+                                                               int n_filters,
+                                                               float resamp_rate,
+                                                               double output_rate,
+                                                               bool reset_per_pdu,
+                                                               int n_threads)
 {
     return gnuradio::make_block_sptr<pdu_pfb_resamp_impl<T, S>>(
-        taps, n_filters, resamp_rate);
+        taps, n_filters, resamp_rate, output_rate, reset_per_pdu, n_threads);
 }
 
 /*
@@ -33,19 +93,36 @@ pdu_pfb_resamp<T, S>::make(const std::vector<S> taps, int n_filters, float resam
 template <class T, class S>
 pdu_pfb_resamp_impl<T, S>::pdu_pfb_resamp_impl(const std::vector<S> taps,
                                                int n_filters,
-                                               float resamp_rate)
+                                               float resamp_rate,
+                                               double output_rate,
+                                               bool reset_per_pdu,
+                                               int n_threads)
     : gr::block("pdu_pfb_resamp",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
+      d_taps(taps),
+      d_taps_version(0),
       d_nfilts(n_filters),
-      d_resamp_rate(resamp_rate)
+      d_nthreads(std::max(n_threads, 1)),
+      d_next_job(0),
+      d_finished(false),
+      d_next_pub(0)
 {
-    d_pfb = new pfb_filter_kernel<T, S>(taps, n_filters);
-    d_pfb->set_rate(d_resamp_rate);
+    if (!(resamp_rate > 0)) {
+        GR_LOG_ERROR(this->d_logger, "Resample rate must be positive");
+        throw std::runtime_error("pdu_pfb_resamp: resample rate must be positive");
+    }
+
+    d_params.resamp_rate = resamp_rate;
+    d_params.output_rate = output_rate;
+    d_params.rational_tolerance = DEFAULT_RATIONAL_TOLERANCE;
+    d_params.reset_per_pdu = reset_per_pdu;
 
-    d_in = NULL;
-    d_out = NULL;
-    d_input_size = 0;
+    for (int ii = 0; ii < d_nthreads; ii++) {
+        d_workers.emplace_back(
+            new pfb_resamp_worker<T, S>(d_taps, d_nfilts, d_params.resamp_rate));
+        d_worker_taps_version.push_back(d_taps_version);
+    }
 
     // GR_LOG_DEBUG(this->d_logger,
     //   boost::format("started pdu pfb resampler with %d taps") %
@@ -57,11 +134,267 @@ pdu_pfb_resamp_impl<T, S>::pdu_pfb_resamp_impl(const std::vector<S> taps,
     this->message_port_register_out(PMTCONSTSTR__pdu_out());
 }
 
-/*group_delay
+/*
  * Our virtual destructor.
  */
 template <class T, class S>
 pdu_pfb_resamp_impl<T, S>::~pdu_pfb_resamp_impl()
+{
+}
+
+template <class T, class S>
+bool pdu_pfb_resamp_impl<T, S>::start()
+{
+    if (d_nthreads > 1) {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = false;
+        for (int ii = 0; ii < d_nthreads; ii++) {
+            d_threads.push_back(std::make_shared<gr::thread::thread>(
+                [this, ii]() { this->run_worker(ii); }));
+        }
+    }
+    return block::start();
+}
+
+template <class T, class S>
+bool pdu_pfb_resamp_impl<T, S>::stop()
+{
+    // workers drain any queued PDUs before exiting
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+    }
+    d_job_cond.notify_all();
+    d_space_cond.notify_all();
+    for (auto& thread : d_threads) {
+        thread->join();
+    }
+    d_threads.clear();
+
+    return block::stop();
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::set_taps(std::vector<S> taps)
+{
+    gr::thread::scoped_lock l(d_mutex);
+
+    // workers pick up the new taps before their next PDU
+    d_taps = taps;
+    d_taps_version++;
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::set_output_rate(double output_rate)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_params.output_rate = output_rate;
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::set_rational_tolerance(double tolerance)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_params.rational_tolerance = tolerance;
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::set_reset_per_pdu(bool reset)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_params.reset_per_pdu = reset;
+}
+
+/*
+ * Must be called with d_mutex held by the thread owning the worker
+ */
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::sync_worker(size_t idx)
+{
+    if (d_worker_taps_version[idx] != d_taps_version) {
+        d_workers[idx]->set_taps(d_taps);
+        d_worker_taps_version[idx] = d_taps_version;
+    }
+}
+
+/*
+ * Checks everything resample_pdu() relies on, so malformed PDUs never reach a
+ * worker thread
+ */
+template <class T, class S>
+bool pdu_pfb_resamp_impl<T, S>::check_pdu(pmt::pmt_t pdu)
+{
+    if (!pmt::is_pdu(pdu)) {
+        GR_LOG_WARN(this->d_logger, "Received an invalid PDU");
+        return false;
+    }
+
+    size_t nbytes = 0;
+    pmt::uniform_vector_elements(pmt::cdr(pdu), nbytes);
+    if (nbytes % sizeof(T) != 0) {
+        GR_LOG_WARN(this->d_logger, "Potentially conflicting PDU data type...aborting");
+        return false;
+    }
+    if (nbytes == 0) {
+        GR_LOG_WARN(this->d_logger, "Zero length PDU, dropping");
+        return false;
+    }
+
+    pmt::pmt_t sample_rate =
+        pmt::dict_ref(pmt::car(pdu), PMTCONSTSTR__sample_rate(), pmt::PMT_NIL);
+    if (!(pmt::is_null(sample_rate) || pmt::is_number(sample_rate))) {
+        GR_LOG_WARN(this->d_logger, "PDU sample_rate is not a number, dropping");
+        return false;
+    }
+    return true;
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::handle_pdu(pmt::pmt_t pdu)
+{
+    if (!check_pdu(pdu)) {
+        return;
+    }
+
+    gr::thread::scoped_lock l(d_mutex);
+
+    if (d_nthreads <= 1) {
+        sync_worker(0);
+        pmt::pmt_t out = resample_pdu(*d_workers[0], pdu, d_params);
+        if (!pmt::is_null(out)) {
+            this->message_port_pub(PMTCONSTSTR__pdu_out(), out);
+        }
+        return;
+    }
+
+    // bound the number of queued PDUs so the input message queue applies backpressure
+    while (!d_finished && d_jobs.size() >= MAX_QUEUED_PER_THREAD * d_nthreads) {
+        d_space_cond.wait(l);
+    }
+    d_jobs.emplace_back(d_next_job++, pdu);
+    d_job_cond.notify_one();
+}
+
+template <class T, class S>
+void pdu_pfb_resamp_impl<T, S>::run_worker(size_t idx)
+{
+    pfb_resamp_worker<T, S>& worker = *d_workers[idx];
+
+    while (true) {
+        uint64_t seq;
+        pmt::pmt_t pdu;
+        resamp_params params;
+        {
+            gr::thread::scoped_lock l(d_mutex);
+            while (!d_finished && d_jobs.empty()) {
+                d_job_cond.wait(l);
+            }
+            if (d_jobs.empty()) {
+                return;
+            }
+            seq = d_jobs.front().first;
+            pdu = d_jobs.front().second;
+            d_jobs.pop_front();
+            d_space_cond.notify_one();
+
+            sync_worker(idx);
+            params = d_params;
+        }
+
+        // each worker carries its own history, so state cannot follow the PDU
+        // sequence and every PDU is processed from a clean kernel
+        params.reset_per_pdu = true;
+        pmt::pmt_t out = pmt::PMT_NIL;
+        try {
+            out = resample_pdu(worker, pdu, params);
+        } catch (const std::exception& e) {
+            // an exception escaping this thread would terminate the process, the
+            // sequence number is still filled so later results are published
+            GR_LOG_ERROR(this->d_logger,
+                         boost::format("failed to resample PDU, dropping: %s") %
+                             e.what());
+        }
+
+        // publish every completed result that is next in sequence
+        gr::thread::scoped_lock l(d_pub_mutex);
+        d_results[seq] = out;
+        auto it = d_results.find(d_next_pub);
+        while (it != d_results.end()) {
+            if (!pmt::is_null(it->second)) {
+                this->message_port_pub(PMTCONSTSTR__pdu_out(), it->second);
+            }
+            d_results.erase(it);
+            it = d_results.find(++d_next_pub);
+        }
+    }
+}
+
+/*
+ * Resample a single PDU that has passed check_pdu()
+ */
+template <class T, class S>
+pmt::pmt_t pdu_pfb_resamp_impl<T, S>::resample_pdu(pfb_resamp_worker<T, S>& worker,
+                                                   pmt::pmt_t pdu,
+                                                   const resamp_params& params)
+{
+    // the PDU has passed check_pdu()
+    pmt::pmt_t meta = pmt::car(pdu);
+    pmt::pmt_t v_data = pmt::cdr(pdu);
+
+    size_t nbytes = 0;
+    const T* input_data =
+        static_cast<const T*>(pmt::uniform_vector_elements(v_data, nbytes));
+    size_t nitems = nbytes / sizeof(T);
+
+    // per-PDU rate if an output rate is set and the PDU carries its sample rate
+    double rate = params.resamp_rate;
+    if (params.output_rate > 0) {
+        double in_rate = pmt::to_double(
+            pmt::dict_ref(meta, PMTCONSTSTR__sample_rate(), pmt::from_double(0)));
+        if (in_rate > 0) {
+            rate = params.output_rate / in_rate;
+        } else {
+            GR_LOG_NOTICE(this->d_logger,
+                          "PDU has no sample_rate, using the fixed resample rate");
+        }
+    }
+
+    int n_out = worker.resample(
+        input_data, nitems, rate, params.rational_tolerance, params.reset_per_pdu);
+
+    if (pmt::dict_has_key(meta, PMTCONSTSTR__sample_rate())) {
+        double sample_rate = pmt::to_double(
+            pmt::dict_ref(meta, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL));
+        sample_rate *= rate;
+        meta = pmt::dict_delete(meta, PMTCONSTSTR__sample_rate());
+        meta = pmt::dict_add(
+            meta, PMTCONSTSTR__sample_rate(), pmt::from_double(sample_rate));
+    }
+
+    return pmt::cons(meta, this->init_data(worker.output(), n_out));
+}
+
+/* ===========================================================================
+ * Resampling worker
+ ===========================================================================*/
+template <class T, class S>
+pfb_resamp_worker<T, S>::pfb_resamp_worker(const std::vector<S>& taps,
+                                           uint32_t n_filters,
+                                           float rate)
+    : d_taps(taps),
+      d_nfilts(n_filters),
+      d_pfb(taps, n_filters),
+      d_arb_rate(rate),
+      d_in(NULL),
+      d_out(NULL),
+      d_input_size(0),
+      d_output_size(0)
+{
+    d_pfb.set_rate(d_arb_rate);
+}
+
+template <class T, class S>
+pfb_resamp_worker<T, S>::~pfb_resamp_worker()
 {
     if (d_in != NULL)
         volk_free(d_in);
@@ -70,148 +403,255 @@ pdu_pfb_resamp_impl<T, S>::~pdu_pfb_resamp_impl()
 }
 
 template <class T, class S>
-void pdu_pfb_resamp_impl<T, S>::resize_arrays(size_t newSize)
+void pfb_resamp_worker<T, S>::set_taps(const std::vector<S>& taps)
+{
+    d_taps = taps;
+    d_pfb.set_taps(taps);
+    // cached filterbanks were derived from the old prototype
+    d_rational_kernels.clear();
+}
+
+template <class T, class S>
+void pfb_resamp_worker<T, S>::resize_arrays(size_t newSize)
 {
     if (d_in != NULL)
         volk_free(d_in);
-    if (d_out != NULL)
-        volk_free(d_out);
     d_in = (T*)volk_malloc(sizeof(T) * newSize, volk_get_alignment());
-    d_out =
-        (T*)volk_malloc((sizeof(T) * newSize * d_resamp_rate + 1), volk_get_alignment());
     d_input_size = newSize;
 }
 
 template <class T, class S>
-void pdu_pfb_resamp_impl<T, S>::handle_pdu(pmt::pmt_t pdu)
+void pfb_resamp_worker<T, S>::resize_output(size_t newSize)
 {
+    if (d_out != NULL)
+        volk_free(d_out);
+    d_out = (T*)volk_malloc(sizeof(T) * newSize, volk_get_alignment());
+    d_output_size = newSize;
+}
 
-    /* code */
-    pmt::pmt_t meta = pmt::car(pdu);
-    pmt::pmt_t v_data = pmt::cdr(pdu);
-    if (pmt::is_uniform_vector(v_data)) {
-        size_t nbytes = 0;
-        size_t nitems = 0;
-        const T* input_data =
-            static_cast<const T*>(pmt::uniform_vector_elements(v_data, nbytes));
-        if (nbytes % sizeof(T) != 0) {
-            GR_LOG_WARN(this->d_logger,
-                        "Potentially conflicting PDU data type...aborting");
-            return;
-        }
-        nitems = nbytes / sizeof(T);
-
-        // allocate enough space to pad with 1/2 filter length on each side of the data
-        // (group delay) also tack on some extra memory because the in-tree filter() call
-        // accesses out-of-bounds memory
-        if (d_input_size < nitems + d_nfilts * 2) {
-            // Give ourselves some extra size to prevent a ton of reallocs
-            resize_arrays(nitems * 1.25 + d_nfilts * 2);
-        }
-        //const float z = 0.0;
-        int start = d_nfilts / 2;
-        int num_read;
-
-        // adjust length by filter taps
-        // we'll also add on extra memory space at the end to protect against how
-        // gr::filter works (out of bounds memory access)
-        for (int ii = 0; ii < start; ii++)
-            d_in[ii] = input_data[0];
-        memcpy(&d_in[start], &input_data[0], sizeof(T) * nitems);
-        for (int ii = 0; ii < 2 * start; ii++)
-            d_in[ii + start + nitems] = input_data[nitems - 1];
-        // for (int ii=0; ii < start; ii++) d_in[ii+start+nitems] = input_data[nitems-1];
-        // // this is if filter() is ever fixed
-
-        int n_out = d_pfb->filter(d_out, d_in, nitems + start, num_read);
-
-        if (pmt::dict_has_key(meta, PMTCONSTSTR__sample_rate())) {
-            double sample_rate = pmt::to_double(
-                pmt::dict_ref(meta, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL));
-            sample_rate *= d_resamp_rate;
-            meta = pmt::dict_delete(meta, PMTCONSTSTR__sample_rate());
-            meta = pmt::dict_add(
-                meta, PMTCONSTSTR__sample_rate(), pmt::from_double(sample_rate));
-        }
+/*
+ * Returns the cached rational filterbank for the given rate, designing it on
+ * first use, or NULL if the rate is not rational within tolerance.
+ */
+template <class T, class S>
+pfb_rational_kernel<T, S>* pfb_resamp_worker<T, S>::rational_kernel(double rate,
+                                                                    double tolerance)
+{
+    uint32_t interp, decim;
+    if (!rational_approx(rate, tolerance, interp, decim)) {
+        return NULL;
+    }
 
-        // publish message
-        this->message_port_pub(PMTCONSTSTR__pdu_out(),
-                               pmt::cons(meta, this->init_data(d_out, n_out)));
+    auto key = std::make_pair(interp, decim);
+    auto it = d_rational_kernels.find(key);
+    if (it != d_rational_kernels.end()) {
+        return it->second.get();
+    }
 
-    } else {
-        GR_LOG_WARN(this->d_logger, "Received an invalid PDU");
+    if (d_rational_kernels.size() >= MAX_RATIONAL_KERNELS) {
+        d_rational_kernels.clear();
     }
+    auto& kernel = d_rational_kernels[key];
+    kernel.reset(new pfb_rational_kernel<T, S>(d_taps, d_nfilts, interp, decim));
+    return kernel.get();
+}
+
+template <class T, class S>
+int pfb_resamp_worker<T, S>::resample(
+    const T* input_data, size_t nitems, double& rate, double tolerance, bool reset)
+{
+    // the edge padding below repeats the first and last input samples
+    if (nitems == 0) {
+        return 0;
+    }
+
+    // allocate enough space to pad with 1/2 filter length on each side of the data
+    // (group delay) also tack on some extra memory because the in-tree filter() call
+    // accesses out-of-bounds memory
+    if (d_input_size < nitems + d_nfilts * 2) {
+        // Give ourselves some extra size to prevent a ton of reallocs
+        resize_arrays(nitems * 1.25 + d_nfilts * 2);
+    }
+    //const float z = 0.0;
+    int start = d_nfilts / 2;
+    int num_read;
+
+    // the kernels produce at most one output per 1/rate inputs consumed
+    size_t max_out = (nitems + start + 2) * rate + 2;
+    if (d_output_size < max_out) {
+        resize_output(max_out * 1.25);
+    }
+
+    // adjust length by filter taps
+    // we'll also add on extra memory space at the end to protect against how
+    // gr::filter works (out of bounds memory access)
+    for (int ii = 0; ii < start; ii++)
+        d_in[ii] = input_data[0];
+    memcpy(&d_in[start], &input_data[0], sizeof(T) * nitems);
+    for (int ii = 0; ii < 2 * start; ii++)
+        d_in[ii + start + nitems] = input_data[nitems - 1];
+    // for (int ii=0; ii < start; ii++) d_in[ii+start+nitems] = input_data[nitems-1];
+    // // this is if filter() is ever fixed
+
+    // rational rates use the exact polyphase kernel, anything else goes through
+    // the arbitrary resampler
+    pfb_rational_kernel<T, S>* rational = this->rational_kernel(rate, tolerance);
+    if (rational != NULL) {
+        if (reset) {
+            rational->reset();
+        }
+        rate = double(rational->interpolation()) / rational->decimation();
+        return rational->filter(d_out, d_in, nitems + start, num_read);
+    }
+
+    if (float(rate) != d_arb_rate) {
+        d_arb_rate = rate;
+        d_pfb.set_rate(d_arb_rate);
+    }
+    if (reset) {
+        d_pfb.reset();
+    }
+    return d_pfb.filter(d_out, d_in, nitems + start, num_read);
 }
 
 /* ===========================================================================
- * Filter kernels
+ * Arbitrary rate filter kernel
  ===========================================================================*/
 template <class T, class S>
-pfb_filter_kernel<T, S>::pfb_filter_kernel(std::vector<S> taps, int n_filters)
+pfb_filter_kernel<T, S>::pfb_filter_kernel(const std::vector<S>& taps,
+                                           uint32_t n_filters)
+    : d_nfilts(n_filters), d_last_filter(0)
 {
-    throw std::runtime_error("Invalid PDU PFB filter kernel type");
+    set_rate(1);
+    set_taps(taps);
+    reset();
 }
 
-template <>
-pfb_filter_kernel<float, float>::pfb_filter_kernel(std::vector<float> ktaps,
-                                                   int n_filters)
+template <class T, class S>
+void pfb_filter_kernel<T, S>::set_taps(const std::vector<S>& taps)
 {
-    namespace ph = std::placeholders;
+    const size_t ntaps = taps.size();
+    const size_t taps_pf = (ntaps + d_nfilts - 1) / d_nfilts;
 
-    // instantiate correct kernel
-    d_pfb_fff = new gr::filter::kernel::pfb_arb_resampler_fff(1, ktaps, n_filters);
+    // branch i holds prototype taps i, i+N, i+2N..., and its derivative branch the
+    // difference to the following prototype tap, zero padded to a whole number of
+    // taps per branch
+    d_filters.clear();
+    d_diff_filters.clear();
+    d_filters.reserve(d_nfilts);
+    d_diff_filters.reserve(d_nfilts);
+    std::vector<S> branch(taps_pf), diff(taps_pf);
+    for (uint32_t i = 0; i < d_nfilts; i++) {
+        for (size_t u = 0; u < taps_pf; u++) {
+            size_t idx = i + u * d_nfilts;
+            branch[u] = (idx < ntaps) ? taps[idx] : S(0);
+            diff[u] = (idx + 1 < ntaps) ? taps[idx + 1] - taps[idx] : S(0);
+        }
+        d_filters.emplace_back(branch);
+        d_diff_filters.emplace_back(diff);
+    }
 
-    // bind methods
-    group_delay =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_fff::group_delay, d_pfb_fff);
-    set_taps =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_fff::set_taps, d_pfb_fff, ph::_1);
-    taps = std::bind(&gr::filter::kernel::pfb_arb_resampler_fff::taps, d_pfb_fff);
-    set_rate =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_fff::set_rate, d_pfb_fff, ph::_1);
-    filter = std::bind(
-        &gr::filter::kernel::pfb_arb_resampler_fff::filter, d_pfb_fff, ph::_1, ph::_2, ph::_3, ph::_4);
+    // the in-tree kernel starts on the branch holding the center tap
+    d_start_filter = (ntaps / 2) % d_nfilts;
+    if (d_last_filter >= d_nfilts) {
+        d_last_filter = d_start_filter;
+    }
 }
 
-template <>
-pfb_filter_kernel<gr_complex, float>::pfb_filter_kernel(std::vector<float> ktaps,
-                                                        int n_filters)
+template <class T, class S>
+void pfb_filter_kernel<T, S>::set_rate(float rate)
+{
+    d_dec_rate = (uint32_t)std::floor(d_nfilts / rate);
+    d_flt_rate = (d_nfilts / rate) - d_dec_rate;
+}
+
+template <class T, class S>
+int pfb_filter_kernel<T, S>::filter(T* output, const T* input, int n_to_read, int& n_read)
+{
+    int i_out = 0, i_in = 0;
+    uint32_t j = d_last_filter;
+
+    while (i_in < n_to_read) {
+        while (j < d_nfilts) {
+            // linearly interpolate between branches with the derivative filter
+            T o0 = d_filters[j].filter(&input[i_in]);
+            T o1 = d_diff_filters[j].filter(&input[i_in]);
+            output[i_out++] = o0 + o1 * d_acc;
+
+            d_acc += d_flt_rate;
+            j += d_dec_rate + (uint32_t)std::floor(d_acc);
+            d_acc = std::fmod(d_acc, 1.0f);
+        }
+        i_in += j / d_nfilts;
+        j = j % d_nfilts;
+    }
+
+    d_last_filter = j;
+    n_read = i_in;
+    return i_out;
+}
+
+/* ===========================================================================
+ * Rational filter kernel
+ ===========================================================================*/
+template <class T, class S>
+pfb_rational_kernel<T, S>::pfb_rational_kernel(const std::vector<S>& taps,
+                                               uint32_t n_filters,
+                                               uint32_t interp,
+                                               uint32_t decim)
+    : d_interp(interp), d_decim(decim)
 {
-    namespace ph = std::placeholders;
+    const size_t ntaps = taps.size();
+    const size_t taps_pf = (ntaps + n_filters - 1) / n_filters;
+
+    // the arbitrary resampler starts on prototype branch (ntaps/2) % N; start on the
+    // nearest branch at or before it and carry the residual as a fixed fractional
+    // offset so both kernels are time aligned
+    const uint32_t first = (ntaps / 2) % n_filters;
+    d_start_filter = (uint64_t)first * interp / n_filters;
+    const double offset = first - double(d_start_filter) * n_filters / interp;
 
-    // instantiate correct kernel
-    d_pfb_ccf = new gr::filter::kernel::pfb_arb_resampler_ccf(1, ktaps, n_filters);
-    // bind methods
-    group_delay =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccf::group_delay, d_pfb_ccf);
-    set_taps =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccf::set_taps, d_pfb_ccf, ph::_1);
-    taps = std::bind(&gr::filter::kernel::pfb_arb_resampler_ccf::taps, d_pfb_ccf);
-    set_rate =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccf::set_rate, d_pfb_ccf, ph::_1);
-    filter = std::bind(
-        &gr::filter::kernel::pfb_arb_resampler_ccf::filter, d_pfb_ccf, ph::_1, ph::_2, ph::_3, ph::_4);
+    // branch p samples the prototype at fractional branch offset + p*N/L, linearly
+    // interpolating between neighboring prototype taps the same way the derivative
+    // filters of the arbitrary resampler do
+    d_filters.reserve(interp);
+    std::vector<S> branch(taps_pf);
+    for (uint32_t p = 0; p < interp; p++) {
+        double pos = offset + double(p) * n_filters / interp;
+        size_t base = (size_t)pos;
+        float frac = pos - base;
+        for (size_t u = 0; u < taps_pf; u++) {
+            size_t idx = base + u * n_filters;
+            S a = (idx < ntaps) ? taps[idx] : S(0);
+            S b = (idx + 1 < ntaps) ? taps[idx + 1] : a;
+            branch[u] = a + (b - a) * frac;
+        }
+        d_filters.emplace_back(branch);
+    }
+    d_last_filter = d_start_filter;
 }
 
-template <>
-pfb_filter_kernel<gr_complex, gr_complex>::pfb_filter_kernel(
-    std::vector<gr_complex> ktaps, int n_filters)
+template <class T, class S>
+int pfb_rational_kernel<T, S>::filter(T* output,
+                                      const T* input,
+                                      int n_to_read,
+                                      int& n_read)
 {
-    namespace ph = std::placeholders;
+    int i_out = 0, i_in = 0;
+    uint32_t j = d_last_filter;
 
-    // instantiate correct kernel
-    d_pfb_ccc = new gr::filter::kernel::pfb_arb_resampler_ccc(1, ktaps, n_filters);
+    while (i_in < n_to_read) {
+        while (j < d_interp) {
+            output[i_out++] = d_filters[j].filter(&input[i_in]);
+            j += d_decim;
+        }
+        i_in += j / d_interp;
+        j = j % d_interp;
+    }
 
-    // bind methods
-    group_delay =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccc::group_delay, d_pfb_ccc);
-    set_taps =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccc::set_taps, d_pfb_ccc, ph::_1);
-    taps = std::bind(&gr::filter::kernel::pfb_arb_resampler_ccc::taps, d_pfb_ccc);
-    set_rate =
-        std::bind(&gr::filter::kernel::pfb_arb_resampler_ccc::set_rate, d_pfb_ccc, ph::_1);
-    filter = std::bind(
-        &gr::filter::kernel::pfb_arb_resampler_ccc::filter, d_pfb_ccc, ph::_1, ph::_2, ph::_3, ph::_4);
+    d_last_filter = j;
+    n_read = i_in;
+    return i_out;
 }
 
 // only support float and gr_complex
@@ -10,31 +10,113 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_PFB_RESAMP_IMPL_H
 #define INCLUDED_PDU_UTILS_PDU_PFB_RESAMP_IMPL_H
 
-#include <gnuradio/filter/pfb_arb_resampler.h>
+#include <gnuradio/filter/fir_filter.h>
 #include <gnuradio/pdu_utils/constants.h>
 #include <gnuradio/pdu_utils/pdu_pfb_resamp.h>
+#include <deque>
+#include <map>
+#include <memory>
 
 namespace gr {
 namespace pdu_utils {
+
+/*
+ * Arbitrary rate polyphase resampler, the same filterbank and derivative filterbank
+ * interpolation as the in-tree pfb_arb_resampler. The in-tree kernel cannot be
+ * copied or have its filter index and fractional accumulator cleared, so resetting
+ * it meant re-deriving both filterbanks from the taps; here the filterbanks are
+ * built once per set of taps and reset() only restores the starting state.
+ */
 template <class T, class S>
 class pfb_filter_kernel
 {
 private:
-    // resampling kernels
-    gr::filter::kernel::pfb_arb_resampler_fff* d_pfb_fff;
-    gr::filter::kernel::pfb_arb_resampler_ccf* d_pfb_ccf;
-    gr::filter::kernel::pfb_arb_resampler_ccc* d_pfb_ccc;
+    std::vector<gr::filter::kernel::fir_filter<T, T, S>> d_filters;
+    std::vector<gr::filter::kernel::fir_filter<T, T, S>> d_diff_filters;
+    uint32_t d_nfilts;
+    uint32_t d_dec_rate;
+    float d_flt_rate;
+    uint32_t d_start_filter;
+    uint32_t d_last_filter;
+    float d_acc;
 
 public:
-    pfb_filter_kernel(std::vector<S> ktaps, int n_filters);
+    pfb_filter_kernel(const std::vector<S>& taps, uint32_t n_filters);
     ~pfb_filter_kernel() {}
 
-    // overloaded methods
-    std::function<int()> group_delay;
-    std::function<void(std::vector<S>)> set_taps;
-    std::function<std::vector<std::vector<S>>()> taps;
-    std::function<int(T*, T*, int, int&)> filter;
-    std::function<void(float)> set_rate;
+    void set_taps(const std::vector<S>& taps);
+    void set_rate(float rate);
+    void reset()
+    {
+        d_last_filter = d_start_filter;
+        d_acc = 0;
+    }
+    int filter(T* output, const T* input, int n_to_read, int& n_read);
+};
+
+/*
+ * Rational L/M polyphase resampler. The L branch filterbank is derived from the
+ * N filter prototype the user provided so the response matches the arbitrary
+ * resampler, but the branch index advances by exactly M per output sample so no
+ * derivative filter or fractional accumulator is required.
+ */
+template <class T, class S>
+class pfb_rational_kernel
+{
+private:
+    std::vector<gr::filter::kernel::fir_filter<T, T, S>> d_filters;
+    uint32_t d_interp;
+    uint32_t d_decim;
+    uint32_t d_start_filter;
+    uint32_t d_last_filter;
+
+public:
+    pfb_rational_kernel(const std::vector<S>& taps,
+                        uint32_t n_filters,
+                        uint32_t interp,
+                        uint32_t decim);
+    ~pfb_rational_kernel() {}
+
+    uint32_t interpolation() const { return d_interp; }
+    uint32_t decimation() const { return d_decim; }
+    void reset() { d_last_filter = d_start_filter; }
+    int filter(T* output, const T* input, int n_to_read, int& n_read);
+};
+
+/*
+ * Kernels and scratch buffers needed to resample one PDU at a time. Each worker
+ * thread owns one of these so nothing is shared while filtering.
+ */
+template <class T, class S>
+class pfb_resamp_worker
+{
+private:
+    std::vector<S> d_taps;
+    uint32_t d_nfilts;
+    pfb_filter_kernel<T, S> d_pfb;
+    float d_arb_rate;
+    T* d_in;
+    T* d_out;
+    size_t d_input_size;
+    size_t d_output_size;
+
+    // rational filterbanks keyed by interpolation / decimation ratio
+    std::map<std::pair<uint32_t, uint32_t>, std::unique_ptr<pfb_rational_kernel<T, S>>>
+        d_rational_kernels;
+
+    pfb_rational_kernel<T, S>* rational_kernel(double rate, double tolerance);
+    void resize_arrays(size_t newSize);
+    void resize_output(size_t newSize);
+
+public:
+    pfb_resamp_worker(const std::vector<S>& taps, uint32_t n_filters, float rate);
+    ~pfb_resamp_worker();
+
+    void set_taps(const std::vector<S>& taps);
+    // returns the number of output samples, rate is updated to the rate applied
+    int resample(
+        const T* input_data, size_t nitems, double& rate, double tolerance, bool reset);
+    T* output() { return d_out; }
 };
 
 template <class T, class S>
@@ -51,23 +133,62 @@ private:
         return pmt::init_c32vector(n, data);
     }
 
+    // settings snapshot handed to a worker with each PDU
+    struct resamp_params {
+        float resamp_rate;
+        double output_rate;
+        double rational_tolerance;
+        bool reset_per_pdu;
+    };
+
 private:
-    pfb_filter_kernel<T, S>* d_pfb;
-    T* d_in;
-    T* d_out;
-    size_t d_input_size;
+    gr::thread::mutex d_mutex;
+    resamp_params d_params;
+    std::vector<S> d_taps;
+    uint64_t d_taps_version;
     uint32_t d_nfilts;
-    float d_resamp_rate;
+    int d_nthreads;
 
-    void resize_arrays(size_t newSize);
+    std::vector<std::unique_ptr<pfb_resamp_worker<T, S>>> d_workers;
+    std::vector<uint64_t> d_worker_taps_version;
+
+    // worker pool state, jobs and results are tagged with a sequence number so
+    // the output order matches the input order
+    std::vector<std::shared_ptr<gr::thread::thread>> d_threads;
+    gr::thread::condition_variable d_job_cond;
+    gr::thread::condition_variable d_space_cond;
+    std::deque<std::pair<uint64_t, pmt::pmt_t>> d_jobs;
+    uint64_t d_next_job;
+    bool d_finished;
+    gr::thread::mutex d_pub_mutex;
+    std::map<uint64_t, pmt::pmt_t> d_results;
+    uint64_t d_next_pub;
+
+    void sync_worker(size_t idx);
+    pmt::pmt_t resample_pdu(pfb_resamp_worker<T, S>& worker,
+                            pmt::pmt_t pdu,
+                            const resamp_params& params);
+    void run_worker(size_t idx);
+    bool check_pdu(pmt::pmt_t pdu);
     void handle_pdu(pmt::pmt_t pdu);
 
 public:
-    pdu_pfb_resamp_impl(const std::vector<S> taps, int n_filters, float resamp_rate);
+    pdu_pfb_resamp_impl(const std::vector<S> taps,
+                        int n_filters,
+                        float resamp_rate,
+                        double output_rate,
+                        bool reset_per_pdu,
+                        int n_threads);
 
     ~pdu_pfb_resamp_impl() override;
 
-    void set_taps(std::vector<S> taps) override { d_pfb->set_taps(taps); }
+    bool start() override;
+    bool stop() override;
+
+    void set_taps(std::vector<S> taps) override;
+    void set_output_rate(double output_rate) override;
+    void set_rational_tolerance(double tolerance) override;
+    void set_reset_per_pdu(bool reset) override;
 };
 
 } // namespace pdu_utils
@@ -0,0 +1,424 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_predicate.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+namespace gr {
+namespace pdu_utils {
+
+typedef pdu_predicate::value value;
+typedef pdu_predicate::context context;
+typedef pdu_predicate::node node;
+
+value value::from_pmt(const pmt::pmt_t& p)
+{
+    value v;
+    if (pmt::is_bool(p)) {
+        v = number(pmt::to_bool(p) ? 1 : 0);
+    } else if (pmt::is_integer(p)) {
+        v = number(pmt::to_long(p));
+    } else if (pmt::is_uint64(p)) {
+        v = number(pmt::to_uint64(p));
+    } else if (pmt::is_real(p)) {
+        v = number(pmt::to_double(p));
+    } else if (pmt::is_symbol(p)) {
+        v.kind = STRING;
+        v.str = p;
+    } else {
+        v.kind = OTHER;
+    }
+    return v;
+}
+
+value value::number(double n)
+{
+    value v;
+    v.kind = NUMBER;
+    v.num = n;
+    return v;
+}
+
+bool value::truth() const
+{
+    switch (kind) {
+    case NUMBER:
+        return num != 0;
+    case STRING:
+    case OTHER:
+        return true;
+    default:
+        return false;
+    }
+}
+
+namespace {
+
+enum compare_op { OP_EQ, OP_NE, OP_LT, OP_LE, OP_GT, OP_GE };
+
+bool compare(compare_op op, const value& a, const value& b)
+{
+    if (a.kind == value::NUMBER && b.kind == value::NUMBER) {
+        switch (op) {
+        case OP_EQ:
+            return a.num == b.num;
+        case OP_NE:
+            return a.num != b.num;
+        case OP_LT:
+            return a.num < b.num;
+        case OP_LE:
+            return a.num <= b.num;
+        case OP_GT:
+            return a.num > b.num;
+        case OP_GE:
+            return a.num >= b.num;
+        }
+    }
+    if (a.kind == value::STRING && b.kind == value::STRING) {
+        if (op == OP_EQ) {
+            return pmt::eq(a.str, b.str);
+        }
+        if (op == OP_NE) {
+            return !pmt::eq(a.str, b.str);
+        }
+    }
+    return false;
+}
+
+/*
+ * Recursive descent parser, one method per grammar rule. Each method consumes its
+ * rule and returns the node evaluating it.
+ */
+class parser
+{
+private:
+    const std::string& d_s;
+    size_t d_pos;
+    std::vector<pmt::pmt_t>& d_keys;
+
+    [[noreturn]] void fail(const std::string& what)
+    {
+        std::stringstream ss;
+        ss << what << " at position " << d_pos << " in '" << d_s << "'";
+        throw std::runtime_error(ss.str());
+    }
+
+    void skip_space()
+    {
+        while (d_pos < d_s.size() && std::isspace((unsigned char)d_s[d_pos])) {
+            d_pos++;
+        }
+    }
+
+    static bool ident_start(char c) { return std::isalpha((unsigned char)c) || c == '_'; }
+    static bool ident_char(char c) { return std::isalnum((unsigned char)c) || c == '_'; }
+
+    // identifier at the current position without consuming it, empty if none
+    std::string peek_ident()
+    {
+        skip_space();
+        size_t end = d_pos;
+        if (end < d_s.size() && ident_start(d_s[end])) {
+            while (end < d_s.size() && ident_char(d_s[end])) {
+                end++;
+            }
+        }
+        return d_s.substr(d_pos, end - d_pos);
+    }
+
+    std::string ident()
+    {
+        std::string id = peek_ident();
+        if (id.empty()) {
+            fail("expected a metadata key");
+        }
+        d_pos += id.size();
+        return id;
+    }
+
+    bool accept_word(const char* word)
+    {
+        if (peek_ident() == word) {
+            d_pos += std::string(word).size();
+            return true;
+        }
+        return false;
+    }
+
+    // accepts tok, but not when it is the start of a longer operator in not_before
+    bool accept(const char* tok, const char* not_before = "")
+    {
+        skip_space();
+        size_t n = std::string(tok).size();
+        if (d_s.compare(d_pos, n, tok) != 0) {
+            return false;
+        }
+        if (d_pos + n < d_s.size() &&
+            std::string(not_before).find(d_s[d_pos + n]) != std::string::npos) {
+            return false;
+        }
+        d_pos += n;
+        return true;
+    }
+
+    void expect(const char* tok)
+    {
+        if (!accept(tok)) {
+            fail(std::string("expected '") + tok + "'");
+        }
+    }
+
+    size_t slot(const std::string& key)
+    {
+        pmt::pmt_t k = pmt::intern(key);
+        for (size_t i = 0; i < d_keys.size(); i++) {
+            if (pmt::eq(d_keys[i], k)) {
+                return i;
+            }
+        }
+        d_keys.push_back(k);
+        return d_keys.size() - 1;
+    }
+
+public:
+    parser(const std::string& s, std::vector<pmt::pmt_t>& keys)
+        : d_s(s), d_pos(0), d_keys(keys)
+    {
+    }
+
+    node parse()
+    {
+        node n = parse_or();
+        skip_space();
+        if (d_pos != d_s.size()) {
+            fail(std::string("unexpected '") + d_s[d_pos] + "'");
+        }
+        return n;
+    }
+
+    node parse_or()
+    {
+        node lhs = parse_and();
+        while (accept("||") || accept_word("or")) {
+            node rhs = parse_and();
+            lhs = [lhs, rhs](const context& c) {
+                return value::number(lhs(c).truth() || rhs(c).truth());
+            };
+        }
+        return lhs;
+    }
+
+    node parse_and()
+    {
+        node lhs = parse_not();
+        while (accept("&&") || accept_word("and")) {
+            node rhs = parse_not();
+            lhs = [lhs, rhs](const context& c) {
+                return value::number(lhs(c).truth() && rhs(c).truth());
+            };
+        }
+        return lhs;
+    }
+
+    node parse_not()
+    {
+        if (accept("!", "=") || accept_word("not")) {
+            node arg = parse_not();
+            return [arg](const context& c) { return value::number(!arg(c).truth()); };
+        }
+        return parse_compare();
+    }
+
+    node parse_compare()
+    {
+        std::vector<node> args(1, parse_sum());
+        std::vector<compare_op> ops;
+        while (true) {
+            if (accept("==")) {
+                ops.push_back(OP_EQ);
+            } else if (accept("!=")) {
+                ops.push_back(OP_NE);
+            } else if (accept("<=")) {
+                ops.push_back(OP_LE);
+            } else if (accept(">=")) {
+                ops.push_back(OP_GE);
+            } else if (accept("<")) {
+                ops.push_back(OP_LT);
+            } else if (accept(">")) {
+                ops.push_back(OP_GT);
+            } else {
+                break;
+            }
+            args.push_back(parse_sum());
+        }
+        if (ops.empty()) {
+            return args[0];
+        }
+
+        // a < b < c is a < b && b < c, with b evaluated once
+        return [args, ops](const context& c) {
+            value lhs = args[0](c);
+            for (size_t i = 0; i < ops.size(); i++) {
+                value rhs = args[i + 1](c);
+                if (!compare(ops[i], lhs, rhs)) {
+                    return value::number(0);
+                }
+                lhs = rhs;
+            }
+            return value::number(1);
+        };
+    }
+
+    node parse_sum()
+    {
+        node lhs = parse_product();
+        while (true) {
+            char op;
+            if (accept("+")) {
+                op = '+';
+            } else if (accept("-")) {
+                op = '-';
+            } else {
+                return lhs;
+            }
+            node rhs = parse_product();
+            lhs = [lhs, rhs, op](const context& c) {
+                value a = lhs(c), b = rhs(c);
+                if (a.kind != value::NUMBER || b.kind != value::NUMBER) {
+                    return value();
+                }
+                return value::number(op == '+' ? a.num + b.num : a.num - b.num);
+            };
+        }
+    }
+
+    node parse_product()
+    {
+        node lhs = parse_unary();
+        while (true) {
+            char op;
+            if (accept("*")) {
+                op = '*';
+            } else if (accept("/")) {
+                op = '/';
+            } else {
+                return lhs;
+            }
+            node rhs = parse_unary();
+            lhs = [lhs, rhs, op](const context& c) {
+                value a = lhs(c), b = rhs(c);
+                if (a.kind != value::NUMBER || b.kind != value::NUMBER ||
+                    (op == '/' && b.num == 0)) {
+                    return value();
+                }
+                return value::number(op == '*' ? a.num * b.num : a.num / b.num);
+            };
+        }
+    }
+
+    node parse_unary()
+    {
+        if (accept("-")) {
+            node arg = parse_unary();
+            return [arg](const context& c) {
+                value v = arg(c);
+                return v.kind == value::NUMBER ? value::number(-v.num) : value();
+            };
+        }
+        return parse_primary();
+    }
+
+    node parse_primary()
+    {
+        skip_space();
+        if (d_pos == d_s.size()) {
+            fail("unexpected end of expression");
+        }
+        char ch = d_s[d_pos];
+
+        if (accept("(")) {
+            node n = parse_or();
+            expect(")");
+            return n;
+        }
+
+        if (std::isdigit((unsigned char)ch) || ch == '.') {
+            const char* begin = d_s.c_str() + d_pos;
+            char* end;
+            double num = std::strtod(begin, &end);
+            if (end == begin) {
+                fail("invalid number");
+            }
+            d_pos += end - begin;
+            value v = value::number(num);
+            return [v](const context&) { return v; };
+        }
+
+        if (ch == '\'' || ch == '"') {
+            size_t close = d_s.find(ch, d_pos + 1);
+            if (close == std::string::npos) {
+                fail("unterminated string");
+            }
+            value v;
+            v.kind = value::STRING;
+            v.str = pmt::intern(d_s.substr(d_pos + 1, close - d_pos - 1));
+            d_pos = close + 1;
+            return [v](const context&) { return v; };
+        }
+
+        std::string id = ident();
+        if (id == "true" || id == "false") {
+            value v = value::number(id == "true");
+            return [v](const context&) { return v; };
+        }
+        if (id == "len") {
+            return [](const context& c) { return c.len; };
+        }
+        if (id == "has") {
+            expect("(");
+            size_t i = slot(ident());
+            expect(")");
+            return [i](const context& c) {
+                return value::number(c.keys[i].kind != value::MISSING);
+            };
+        }
+        if (id == "and" || id == "or" || id == "not") {
+            d_pos -= id.size();
+            fail("expected an operand");
+        }
+        if (accept("(")) {
+            fail("unknown function '" + id + "'");
+        }
+        size_t i = slot(id);
+        return [i](const context& c) { return c.keys[i]; };
+    }
+};
+
+} // namespace
+
+pdu_predicate::pdu_predicate(const std::string& expression,
+                             std::vector<pmt::pmt_t>& keys)
+    : d_expression(expression)
+{
+    // parse into a scratch table so keys is untouched if the expression is invalid
+    std::vector<pmt::pmt_t> k(keys);
+    d_root = parser(d_expression, k).parse();
+    keys.swap(k);
+}
+
+} // namespace pdu_utils
+} // namespace gr
@@ -0,0 +1,91 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_PREDICATE_H
+#define INCLUDED_PDU_UTILS_PDU_PREDICATE_H
+
+#include <pmt/pmt.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * Boolean expression over PDU metadata values and the data length, used by
+ * pdu_predicate_filter. Not a block.
+ *
+ * The expression is parsed once into a tree of closures. Metadata keys are not
+ * looked up by the expression itself: every key it references is given a slot in a
+ * key table shared by all predicates of a block, so the caller can fill the values
+ * of all of them in a single walk over the metadata dictionary.
+ *
+ * Grammar, loosest binding first:
+ *
+ *   or:      and ('||' and | 'or' and)*
+ *   and:     not ('&&' not | 'and' not)*
+ *   not:     ('!' | 'not') not | compare
+ *   compare: sum (('==' | '!=' | '<' | '<=' | '>' | '>=') sum)*
+ *   sum:     product (('+' | '-') product)*
+ *   product: unary (('*' | '/') unary)*
+ *   unary:   '-' unary | primary
+ *   primary: number | 'string' | "string" | true | false | len | has(key) | key
+ *            | '(' or ')'
+ *
+ * Comparisons chain as in Python, so '100 <= len < 2000' tests both bounds. 'len'
+ * is the number of items in the PDU data. Any other identifier is a metadata key;
+ * integer, real and boolean values are numbers and symbols are strings. A missing
+ * key, a value of another type, or a comparison between a number and a string
+ * makes the comparison false, and arithmetic on them or a division by zero gives a
+ * missing value. Strings can only be compared with == and !=. Used as a condition,
+ * a number is true when non-zero, a missing value is false and anything else is
+ * true.
+ */
+class pdu_predicate
+{
+public:
+    struct value {
+        enum kind_t { MISSING, NUMBER, STRING, OTHER } kind = MISSING;
+        double num = 0;
+        pmt::pmt_t str; // interned symbol, compared with pmt::eq
+
+        static value from_pmt(const pmt::pmt_t& p);
+        static value number(double n);
+        bool truth() const;
+    };
+
+    // values of the key table slots and the data length for one PDU
+    struct context {
+        std::vector<value> keys;
+        value len;
+    };
+
+    /**
+     * Compile expression, adding the keys it references to keys. Throws
+     * std::runtime_error describing the first syntax error.
+     */
+    pdu_predicate(const std::string& expression, std::vector<pmt::pmt_t>& keys);
+
+    bool operator()(const context& ctx) const { return d_root(ctx).truth(); }
+
+    const std::string& expression() const { return d_expression; }
+
+    typedef std::function<value(const context&)> node;
+
+private:
+    std::string d_expression;
+    node d_root;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_PREDICATE_H */
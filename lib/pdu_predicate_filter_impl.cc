@@ -0,0 +1,163 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_predicate_filter_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <sstream>
+
+namespace gr {
+namespace pdu_utils {
+
+static const pmt::pmt_t PMTCONSTSTR__unmatched()
+{
+    static const pmt::pmt_t val = pmt::mp("unmatched");
+    return val;
+}
+
+pdu_predicate_filter::sptr
+pdu_predicate_filter::make(std::vector<std::string> expressions)
+{
+    return gnuradio::make_block_sptr<pdu_predicate_filter_impl>(expressions);
+}
+
+/*
+ * The private constructor
+ */
+pdu_predicate_filter_impl::pdu_predicate_filter_impl(std::vector<std::string> expressions)
+    : gr::block("pdu_predicate_filter",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_counts(expressions.size() + 1, 0)
+{
+    compile(expressions);
+
+    message_port_register_in(PMTCONSTSTR__pdu_in());
+    set_msg_handler(PMTCONSTSTR__pdu_in(),
+                    [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+
+    // outputs
+    for (size_t i = 0; i < expressions.size(); i++) {
+        std::stringstream s;
+        s << "pdu_out_" << i;
+        d_ports.push_back(pmt::mp(s.str()));
+        message_port_register_out(d_ports.back());
+    }
+    d_ports.push_back(PMTCONSTSTR__unmatched());
+    message_port_register_out(d_ports.back());
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_predicate_filter_impl::~pdu_predicate_filter_impl() {}
+
+/*
+ * Compiles every expression against a fresh key table, replacing the current ones
+ * only if all of them are valid. Caller must hold d_mutex once running.
+ */
+void pdu_predicate_filter_impl::compile(const std::vector<std::string>& expressions)
+{
+    std::vector<pmt::pmt_t> keys;
+    std::vector<pdu_predicate> predicates;
+    for (const auto& expression : expressions) {
+        try {
+            predicates.emplace_back(expression, keys);
+        } catch (const std::runtime_error& e) {
+            GR_LOG_ERROR(d_logger, e.what());
+            throw std::runtime_error(std::string("pdu_predicate_filter: ") + e.what());
+        }
+    }
+
+    d_predicates.swap(predicates);
+    d_keys.swap(keys);
+    d_context.keys.resize(d_keys.size());
+}
+
+void pdu_predicate_filter_impl::set_expression(int index, std::string expression)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (index < 0 || index >= (int)d_predicates.size()) {
+        GR_LOG_ERROR(d_logger, boost::format("no output %d") % index);
+        throw std::runtime_error("pdu_predicate_filter: invalid output index");
+    }
+
+    std::vector<std::string> expressions = get_expressions_locked();
+    expressions[index] = expression;
+    compile(expressions);
+}
+
+std::vector<std::string> pdu_predicate_filter_impl::get_expressions_locked()
+{
+    std::vector<std::string> expressions;
+    for (const auto& p : d_predicates) {
+        expressions.push_back(p.expression());
+    }
+    return expressions;
+}
+
+std::vector<std::string> pdu_predicate_filter_impl::get_expressions()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return get_expressions_locked();
+}
+
+std::vector<uint64_t> pdu_predicate_filter_impl::get_counts()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_counts;
+}
+
+void pdu_predicate_filter_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    if (!(pmt::is_pair(pdu) && pmt::is_dict(pmt::car(pdu)))) {
+        GR_LOG_WARN(d_logger, "PDU has no metadata dictionary, dropping");
+        return;
+    }
+    pmt::pmt_t meta = pmt::car(pdu);
+    pmt::pmt_t data = pmt::cdr(pdu);
+
+    gr::thread::scoped_lock l(d_mutex);
+
+    // dict_items() is the dictionary's own association list, so every referenced key
+    // is resolved in one walk instead of a dict_ref per key
+    for (auto& v : d_context.keys) {
+        v = pdu_predicate::value();
+    }
+    size_t remaining = d_keys.size();
+    pmt::pmt_t items = pmt::dict_items(meta);
+    for (; remaining && pmt::is_pair(items); items = pmt::cdr(items)) {
+        pmt::pmt_t item = pmt::car(items);
+        for (size_t i = 0; i < d_keys.size(); i++) {
+            if (d_context.keys[i].kind == pdu_predicate::value::MISSING &&
+                pmt::eq(pmt::car(item), d_keys[i])) {
+                d_context.keys[i] = pdu_predicate::value::from_pmt(pmt::cdr(item));
+                remaining--;
+                break;
+            }
+        }
+    }
+    d_context.len = pmt::is_uniform_vector(data)
+                        ? pdu_predicate::value::number(pmt::length(data))
+                        : pdu_predicate::value();
+
+    size_t out = 0;
+    while (out < d_predicates.size() && !d_predicates[out](d_context)) {
+        out++;
+    }
+    d_counts[out]++;
+    message_port_pub(d_ports[out], pdu);
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_IMPL_H
+
+#include "pdu_predicate.h"
+#include <gnuradio/pdu_utils/pdu_predicate_filter.h>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_predicate_filter_impl : public pdu_predicate_filter
+{
+private:
+    gr::thread::mutex d_mutex;
+    std::vector<pdu_predicate> d_predicates;
+    std::vector<pmt::pmt_t> d_keys; // metadata keys referenced by any predicate
+    std::vector<pmt::pmt_t> d_ports;
+    std::vector<uint64_t> d_counts;
+    pdu_predicate::context d_context;
+
+    void compile(const std::vector<std::string>& expressions);
+    std::vector<std::string> get_expressions_locked();
+    void handle_pdu(pmt::pmt_t pdu);
+
+public:
+    pdu_predicate_filter_impl(std::vector<std::string> expressions);
+    ~pdu_predicate_filter_impl() override;
+
+    void set_expression(int index, std::string expression) override;
+    std::vector<std::string> get_expressions() override;
+    std::vector<uint64_t> get_counts() override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_PREDICATE_FILTER_IMPL_H */
@@ -13,29 +13,38 @@
 
 #include "pdu_quadrature_demod_cf_impl.h"
 #include <gnuradio/io_signature.h>
-#include <gnuradio/math.h>
 #include <gnuradio/pdu_utils/constants.h>
 
 #include <inttypes.h>
 #include <volk/volk.h>
 
+// conjugate products are computed in blocks of this many samples
+#define QUAD_DEMOD_CHUNK 1024
+
 namespace gr {
 namespace pdu_utils {
 
-pdu_quadrature_demod_cf::sptr pdu_quadrature_demod_cf::make(float sensitivity)
+pdu_quadrature_demod_cf::sptr pdu_quadrature_demod_cf::make(float sensitivity,
+                                                            bool remove_dc)
 {
-    return gnuradio::make_block_sptr<pdu_quadrature_demod_cf_impl>(sensitivity);
+    return gnuradio::make_block_sptr<pdu_quadrature_demod_cf_impl>(sensitivity,
+                                                                   remove_dc);
 }
 
 /*
  * The private constructor
  */
-pdu_quadrature_demod_cf_impl::pdu_quadrature_demod_cf_impl(float sensitivity)
+pdu_quadrature_demod_cf_impl::pdu_quadrature_demod_cf_impl(float sensitivity,
+                                                           bool remove_dc)
     : gr::block("pdu_quadrature_demod_cf",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
-      d_sensitivity(sensitivity)
+      d_sensitivity(sensitivity),
+      d_remove_dc(remove_dc)
 {
+    d_prod = (gr_complex*)volk_malloc(sizeof(gr_complex) * QUAD_DEMOD_CHUNK,
+                                      volk_get_alignment());
+
     message_port_register_in(PMTCONSTSTR__cpdus());
     message_port_register_out(PMTCONSTSTR__fpdus());
     set_msg_handler(PMTCONSTSTR__cpdus(),
@@ -45,28 +54,75 @@ pdu_quadrature_demod_cf_impl::pdu_quadrature_demod_cf_impl(float sensitivity)
 /*
  * Our virtual destructor.
  */
-pdu_quadrature_demod_cf_impl::~pdu_quadrature_demod_cf_impl() {}
+pdu_quadrature_demod_cf_impl::~pdu_quadrature_demod_cf_impl() { volk_free(d_prod); }
+
+void pdu_quadrature_demod_cf_impl::set_sensitivity(float sensitivity)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_sensitivity = sensitivity;
+}
+
+void pdu_quadrature_demod_cf_impl::set_remove_dc(bool remove_dc)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    d_remove_dc = remove_dc;
+}
 
 void pdu_quadrature_demod_cf_impl::handle_pdu(pmt::pmt_t pdu)
 {
+    // make sure PDU data is formed properly
+    if (!(pmt::is_pair(pdu))) {
+        GR_LOG_NOTICE(d_logger, "received unexpected PMT (non-pair)");
+        return;
+    }
+
+    pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t samples = pmt::cdr(pdu);
+
+    if (!pmt::is_dict(meta)) {
+        GR_LOG_WARN(d_logger, "PDU metadata is not a dict, dropping");
+        return;
+    }
+    if (!pmt::is_c32vector(samples)) {
+        GR_LOG_WARN(d_logger, "PDU data is not a c32vector, dropping");
+        return;
+    }
+
     size_t burst_size;
-    const gr_complex* burst =
-        (const gr_complex*)pmt::c32vector_elements(samples, burst_size);
+    const gr_complex* burst = pmt::c32vector_elements(samples, burst_size);
+    if (burst_size < 2) {
+        GR_LOG_WARN(d_logger, "PDU must contain at least two samples, dropping");
+        return;
+    }
     // Subtract off 1 from burst size because we do an offset for the conjugate multiply.
     burst_size--;
 
-    std::vector<gr_complex> tmp(burst_size);
-    std::vector<float> out(burst_size);
+    gr::thread::scoped_lock l(d_setlock);
+
+    // demodulate directly into the output PMT, the conjugate products are staged
+    // through a small cache resident buffer and atan2 applies the sensitivity
+    pmt::pmt_t pdu_vector = pmt::make_f32vector(burst_size, 0);
+    size_t out_size;
+    float* out = pmt::f32vector_writable_elements(pdu_vector, out_size);
+
+    const float normalize = 1.0f / d_sensitivity;
+    for (size_t offset = 0; offset < burst_size; offset += QUAD_DEMOD_CHUNK) {
+        unsigned int n = std::min((size_t)QUAD_DEMOD_CHUNK, burst_size - offset);
+        volk_32fc_x2_multiply_conjugate_32fc(
+            d_prod, &burst[offset + 1], &burst[offset], n);
+        volk_32fc_s32f_atan2_32f(&out[offset], d_prod, normalize, n);
+    }
 
-    volk_32fc_x2_multiply_conjugate_32fc(&tmp[0], &burst[1], &burst[0], burst_size);
-    for (size_t i = 0; i < burst_size; i++) {
-        out[i] = d_sensitivity * gr::fast_atan2f(imag(tmp[i]), real(tmp[i]));
+    if (d_remove_dc) {
+        float sum;
+        volk_32f_accumulator_s32f(&sum, out, burst_size);
+        const float mean = sum / burst_size;
+        for (size_t i = 0; i < burst_size; i++) {
+            out[i] -= mean;
+        }
     }
 
-    pmt::pmt_t pdu_vector = pmt::init_f32vector(burst_size, out);
-    pmt::pmt_t out_msg = pmt::cons(pmt::car(pdu), pdu_vector);
-    message_port_pub(PMTCONSTSTR__fpdus(), out_msg);
+    message_port_pub(PMTCONSTSTR__fpdus(), pmt::cons(meta, pdu_vector));
 }
 
 } /* namespace pdu_utils */
@@ -20,13 +20,18 @@ class pdu_quadrature_demod_cf_impl : public pdu_quadrature_demod_cf
 {
 private:
     float d_sensitivity;
+    bool d_remove_dc;
+    gr_complex* d_prod;
 
     void handle_pdu(pmt::pmt_t pdu);
 
 public:
-    pdu_quadrature_demod_cf_impl(float sensitivity);
+    pdu_quadrature_demod_cf_impl(float sensitivity, bool remove_dc);
 
     ~pdu_quadrature_demod_cf_impl() override;
+
+    void set_sensitivity(float sensitivity) override;
+    void set_remove_dc(bool remove_dc) override;
 };
 
 } // namespace pdu_utils
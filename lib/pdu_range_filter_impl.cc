@@ -67,7 +67,7 @@ void pdu_range_filter_impl::pdu_handler(pmt::pmt_t pdu)
         } else if (pmt::is_real(pmt_val)) {
             val = pmt::to_double(pmt_val);
         } else {
-            printf("WARNING: PDU metadata value is not a number, dropping PDU\n");
+            GR_LOG_WARN(d_logger, "PDU metadata value is not a number, dropping PDU");
             return;
         }
         // if the value is inside the range, let the packet through
@@ -0,0 +1,276 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pdu_resequencer_impl.h"
+#include <gnuradio/io_signature.h>
+#include <gnuradio/pdu_utils/constants.h>
+#include <algorithm>
+#include <sstream>
+
+namespace gr {
+namespace pdu_utils {
+
+// longest single wait, so a new timeout is picked up and stop() is never delayed
+static const int64_t MAX_WAIT_US = 100000;
+
+pdu_resequencer::sptr
+pdu_resequencer::make(int num_inputs, std::string key, int window, double timeout)
+{
+    return gnuradio::make_block_sptr<pdu_resequencer_impl>(
+        num_inputs, key, window, timeout);
+}
+
+/*
+ * The private constructor
+ */
+pdu_resequencer_impl::pdu_resequencer_impl(int num_inputs,
+                                           std::string key,
+                                           int window,
+                                           double timeout)
+    : gr::block("pdu_resequencer",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      d_key(pmt::mp(key)),
+      d_window(std::max(window, 1)),
+      d_timeout(timeout),
+      d_finished(true),
+      d_started(false),
+      d_next(0),
+      d_max_depth(0),
+      d_released(0),
+      d_skipped(0),
+      d_dropped(0)
+{
+    // inputs
+    for (int i = 0; i < num_inputs; i++) {
+        std::stringstream s;
+        s << "pdu_in_" << i;
+        pmt::pmt_t port = pmt::mp(s.str());
+        message_port_register_in(port);
+        set_msg_handler(port, [this](pmt::pmt_t msg) { this->handle_pdu(msg); });
+    }
+
+    // outputs
+    message_port_register_out(PMTCONSTSTR__pdu_out());
+}
+
+/*
+ * Our virtual destructor.
+ */
+pdu_resequencer_impl::~pdu_resequencer_impl() { stop_thread(); }
+
+bool pdu_resequencer_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_thread) {
+        d_finished = false;
+        // each run is a new stream, the sequence numbers may start over
+        d_started = false;
+        d_next = 0;
+        d_max_depth = 0;
+        d_released = 0;
+        d_skipped = 0;
+        d_dropped = 0;
+        d_depths.reset();
+        d_thread = std::make_shared<gr::thread::thread>([this]() { this->run(); });
+    }
+    return block::start();
+}
+
+bool pdu_resequencer_impl::stop()
+{
+    stop_thread();
+
+    gr::thread::scoped_lock l(d_mutex);
+    if (!d_buffer.empty()) {
+        GR_LOG_WARN(d_logger,
+                    boost::format("discarding %d buffered PDUs") % d_buffer.size());
+        d_buffer.clear();
+    }
+    GR_LOG_INFO(d_logger,
+                boost::format("released %d PDUs, skipped %d, dropped %d, max depth %d") %
+                    d_released % d_skipped % d_dropped % d_max_depth);
+    return block::stop();
+}
+
+void pdu_resequencer_impl::stop_thread()
+{
+    std::shared_ptr<gr::thread::thread> thread;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        d_finished = true;
+        thread.swap(d_thread);
+    }
+    d_cond.notify_all();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void pdu_resequencer_impl::set_window(int window)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_window = std::max(window, 1);
+    while (d_buffer.size() > d_window) {
+        skip_gap();
+    }
+}
+
+void pdu_resequencer_impl::set_timeout(double timeout)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_timeout = timeout;
+    d_cond.notify_all();
+}
+
+size_t pdu_resequencer_impl::get_depth()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_buffer.size();
+}
+
+size_t pdu_resequencer_impl::get_max_depth()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_max_depth;
+}
+
+uint64_t pdu_resequencer_impl::get_skipped()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_skipped;
+}
+
+uint64_t pdu_resequencer_impl::get_dropped()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_dropped;
+}
+
+pmt::pmt_t pdu_resequencer_impl::get_stats()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    pmt::pmt_t stats = pmt::make_dict();
+    stats = pmt::dict_add(stats, pmt::mp("released"), pmt::from_uint64(d_released));
+    stats = pmt::dict_add(stats, pmt::mp("skipped"), pmt::from_uint64(d_skipped));
+    stats = pmt::dict_add(stats, pmt::mp("dropped"), pmt::from_uint64(d_dropped));
+    stats = pmt::dict_add(stats, pmt::mp("depth"), pmt::from_uint64(d_buffer.size()));
+    stats = pmt::dict_add(stats, pmt::mp("max_depth"), pmt::from_uint64(d_max_depth));
+    stats = pmt::dict_add(stats, pmt::mp("depth_histogram"), d_depths.to_pmt());
+    return stats;
+}
+
+/*
+ * Publishes buffered PDUs while they are next in sequence. Publishing happens with
+ * d_mutex held so the handler and the timeout thread cannot interleave output.
+ */
+void pdu_resequencer_impl::release()
+{
+    while (!d_buffer.empty() && d_buffer.begin()->first == d_next) {
+        message_port_pub(PMTCONSTSTR__pdu_out(), d_buffer.begin()->second);
+        d_buffer.erase(d_buffer.begin());
+        d_next++;
+        d_released++;
+        d_progress = clock::now();
+    }
+}
+
+/*
+ * Gives up on the missing sequence numbers before the first buffered PDU, or picks
+ * the first sequence number if the stream has not started yet. Caller must hold
+ * d_mutex and the buffer must not be empty.
+ */
+void pdu_resequencer_impl::skip_gap()
+{
+    uint64_t first = d_buffer.begin()->first;
+    if (d_started) {
+        d_skipped += first - d_next;
+    }
+    d_started = true;
+    d_next = first;
+    release();
+}
+
+void pdu_resequencer_impl::handle_pdu(pmt::pmt_t pdu)
+{
+    gr::thread::scoped_lock l(d_mutex);
+
+    pmt::pmt_t seq = pmt::PMT_NIL;
+    if (pmt::is_pair(pdu) && pmt::is_dict(pmt::car(pdu))) {
+        seq = pmt::dict_ref(pmt::car(pdu), d_key, pmt::PMT_NIL);
+    }
+    if (!(pmt::is_uint64(seq) || (pmt::is_integer(seq) && pmt::to_long(seq) >= 0))) {
+        d_dropped++;
+        GR_LOG_WARN(d_logger, "PDU has no sequence number, dropping");
+        return;
+    }
+    uint64_t n = pmt::to_uint64(seq);
+
+    if (d_started && n < d_next) {
+        d_dropped++;
+        GR_LOG_WARN(d_logger,
+                    boost::format("PDU %d arrived after it was released or skipped, "
+                                  "dropping") %
+                        n);
+        return;
+    }
+    if (d_buffer.empty()) {
+        d_progress = clock::now();
+    }
+    if (!d_buffer.emplace(n, pdu).second) {
+        d_dropped++;
+        GR_LOG_WARN(d_logger, boost::format("duplicate PDU %d, dropping") % n);
+        return;
+    }
+    d_depths.record(d_buffer.size());
+    d_max_depth = std::max(d_max_depth, d_buffer.size());
+
+    if (d_started) {
+        release();
+    }
+    while (d_buffer.size() > d_window) {
+        skip_gap();
+    }
+    d_cond.notify_all();
+}
+
+/*
+ * Skips missing PDUs once nothing has been released for the timeout
+ */
+void pdu_resequencer_impl::run()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    while (!d_finished) {
+        if (d_buffer.empty() || d_timeout <= 0) {
+            d_cond.timed_wait(l, boost::posix_time::microseconds(MAX_WAIT_US));
+            continue;
+        }
+
+        clock::time_point deadline =
+            d_progress + std::chrono::duration_cast<clock::duration>(
+                             std::chrono::duration<double>(d_timeout));
+        int64_t remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                                deadline - clock::now())
+                                .count();
+        if (remaining > 0) {
+            d_cond.timed_wait(
+                l, boost::posix_time::microseconds(std::min(remaining, MAX_WAIT_US)));
+            continue;
+        }
+
+        skip_gap();
+    }
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
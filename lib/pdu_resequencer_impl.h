@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_RESEQUENCER_IMPL_H
+#define INCLUDED_PDU_UTILS_PDU_RESEQUENCER_IMPL_H
+
+#include <gnuradio/pdu_utils/log_linear_histogram.h>
+#include <gnuradio/pdu_utils/pdu_resequencer.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+
+namespace gr {
+namespace pdu_utils {
+
+class pdu_resequencer_impl : public pdu_resequencer
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    pmt::pmt_t d_key;
+    size_t d_window;
+    double d_timeout;
+
+    gr::thread::mutex d_mutex;
+    gr::thread::condition_variable d_cond;
+    bool d_finished;
+    std::shared_ptr<gr::thread::thread> d_thread;
+
+    std::map<uint64_t, pmt::pmt_t> d_buffer;
+    bool d_started;               // d_next is valid
+    uint64_t d_next;              // next sequence number to release
+    clock::time_point d_progress; // last release, or when the buffer became non-empty
+
+    size_t d_max_depth;
+    uint64_t d_released;
+    uint64_t d_skipped;
+    uint64_t d_dropped;
+    log_linear_histogram d_depths;
+
+    void handle_pdu(pmt::pmt_t pdu);
+    void release();
+    void skip_gap();
+    void run();
+    void stop_thread();
+
+public:
+    pdu_resequencer_impl(int num_inputs, std::string key, int window, double timeout);
+    ~pdu_resequencer_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    void set_window(int window) override;
+    void set_timeout(double timeout) override;
+    size_t get_depth() override;
+    size_t get_max_depth() override;
+    uint64_t get_skipped() override;
+    uint64_t get_dropped() override;
+    pmt::pmt_t get_stats() override;
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_RESEQUENCER_IMPL_H */
@@ -13,25 +13,29 @@
 
 #include "pdu_round_robin_impl.h"
 #include "gnuradio/pdu_utils/constants.h"
+#include <gnuradio/block_registry.h>
 #include <gnuradio/io_signature.h>
 
 namespace gr {
 namespace pdu_utils {
 
-pdu_round_robin::sptr pdu_round_robin::make(int num_outputs)
+pdu_round_robin::sptr pdu_round_robin::make(int num_outputs, dispatch_mode mode)
 {
-    return gnuradio::make_block_sptr<pdu_round_robin_impl>(num_outputs);
+    return gnuradio::make_block_sptr<pdu_round_robin_impl>(num_outputs, mode);
 }
 
 /*
  * The private constructor
  */
-pdu_round_robin_impl::pdu_round_robin_impl(int num_outputs)
+pdu_round_robin_impl::pdu_round_robin_impl(int num_outputs, dispatch_mode mode)
     : gr::block("pdu_round_robin",
                 gr::io_signature::make(0, 0, 0),
                 gr::io_signature::make(0, 0, 0)),
       d_num_outputs(num_outputs),
-      d_counter(0)
+      d_counter(0),
+      d_mode(mode),
+      d_loads(num_outputs),
+      d_counts(num_outputs, 0)
 {
     // inputs
     message_port_register_in(PMTCONSTSTR__pdu_in());
@@ -52,11 +56,139 @@ pdu_round_robin_impl::pdu_round_robin_impl(int num_outputs)
  */
 pdu_round_robin_impl::~pdu_round_robin_impl() {}
 
+bool pdu_round_robin_impl::start()
+{
+    gr::thread::scoped_lock l(d_mutex);
+
+    // watch the ports subscribed to each output
+    for (int i = 0; i < d_num_outputs; i++) {
+        output_load& load = d_loads[i];
+        load.queues.reset();
+        load.sizes.clear();
+        load.pending_items = 0;
+
+        pmt::pmt_t subscribers = message_subscribers(d_output_ports[i]);
+        while (pmt::is_pair(subscribers)) {
+            pmt::pmt_t target = pmt::car(subscribers);
+            gr::basic_block_sptr block =
+                global_block_registry.block_lookup(pmt::car(target));
+            if (block) {
+                if (!load.queues) {
+                    load.queues.reset(
+                        new pdu_flow_ctrl_helper(std::vector<gr::basic_block_sptr>()));
+                }
+                load.queues->add_port(block, pmt::cdr(target));
+            }
+            subscribers = pmt::cdr(subscribers);
+        }
+        if (load.queues) {
+            load.queues->resolve();
+        }
+    }
+    return block::start();
+}
+
+bool pdu_round_robin_impl::stop()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    for (output_load& load : d_loads) {
+        if (load.queues) {
+            load.queues->release();
+        }
+    }
+    return block::stop();
+}
+
+void pdu_round_robin_impl::set_mode(dispatch_mode mode)
+{
+    gr::thread::scoped_lock l(d_mutex);
+    d_mode = mode;
+    for (output_load& load : d_loads) {
+        load.sizes.clear();
+        load.pending_items = 0;
+        load.empty_samples = 0;
+    }
+}
+
+dispatch_mode pdu_round_robin_impl::get_mode()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_mode;
+}
+
+std::vector<uint64_t> pdu_round_robin_impl::get_counts()
+{
+    gr::thread::scoped_lock l(d_mutex);
+    return d_counts;
+}
+
+/*
+ * Returns the connected output with the fewest messages (or items) waiting, starting
+ * the search at the next output in turn so ties rotate. Returns -1 if no output is
+ * connected. Caller must hold d_mutex.
+ */
+int pdu_round_robin_impl::least_loaded(bool by_size)
+{
+    int best = -1;
+    uint64_t best_load = 0;
+    for (int k = 0; k < d_num_outputs; k++) {
+        int i = (d_counter + k) % d_num_outputs;
+        output_load& load = d_loads[i];
+        if (!load.queues) {
+            continue;
+        }
+
+        uint64_t value = load.queues->max_nmsgs();
+        if (by_size) {
+            // the most recent 'depth' PDUs sent are the ones still queued, and the one
+            // before them was the last taken off the queue, which the handler may
+            // still be working on; queue depth does not count it. Once the queue has
+            // been found empty twice in a row the handler is assumed to be idle, so
+            // the size of the last PDU it was sent does not count against it forever
+            load.empty_samples = value ? 0 : load.empty_samples + 1;
+            uint64_t keep = value + (load.empty_samples < 2 ? 1 : 0);
+            while (load.sizes.size() > keep) {
+                load.pending_items -= load.sizes.front();
+                load.sizes.pop_front();
+            }
+            value = load.pending_items;
+        }
+
+        if (best < 0 || value < best_load) {
+            best = i;
+            best_load = value;
+        }
+    }
+    return best;
+}
+
 void pdu_round_robin_impl::pdu_handler(pmt::pmt_t pdu)
 {
-    message_port_pub(d_output_ports[d_counter], pdu);
+    int output;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        output = d_counter;
+        if (d_mode != DISPATCH_ROUND_ROBIN) {
+            int best = least_loaded(d_mode == DISPATCH_SIZE_WEIGHTED);
+            if (best >= 0) {
+                output = best;
+            }
+        }
+
+        if (d_mode == DISPATCH_SIZE_WEIGHTED && d_loads[output].queues) {
+            uint64_t size = 1;
+            if (pmt::is_pair(pdu) && pmt::is_uniform_vector(pmt::cdr(pdu))) {
+                size = pmt::length(pmt::cdr(pdu));
+            }
+            d_loads[output].sizes.push_back(size);
+            d_loads[output].pending_items += size;
+        }
+
+        d_counts[output]++;
+        d_counter = (output + 1) % d_num_outputs;
+    }
 
-    d_counter = (d_counter + 1) % d_num_outputs;
+    message_port_pub(d_output_ports[output], pdu);
 }
 
 } /* namespace pdu_utils */
@@ -10,25 +10,49 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_ROUND_ROBIN_IMPL_H
 #define INCLUDED_PDU_UTILS_PDU_ROUND_ROBIN_IMPL_H
 
+#include <gnuradio/pdu_utils/pdu_flow_ctrl_helper.h>
 #include <gnuradio/pdu_utils/pdu_round_robin.h>
 
+#include <deque>
+#include <memory>
+
 namespace gr {
 namespace pdu_utils {
 
 class pdu_round_robin_impl : public pdu_round_robin
 {
 private:
+    // load tracking for one output
+    struct output_load {
+        std::unique_ptr<pdu_flow_ctrl_helper> queues; // null when unconnected
+        std::deque<uint64_t> sizes; // lengths of PDUs sent, oldest first
+        uint64_t pending_items = 0; // sum of sizes
+        int empty_samples = 0;      // consecutive dispatches that found the queue empty
+    };
+
     int d_num_outputs;
     int d_counter;
+    dispatch_mode d_mode;
 
     std::vector<pmt::pmt_t> d_output_ports;
+    std::vector<output_load> d_loads;
+    std::vector<uint64_t> d_counts;
+    gr::thread::mutex d_mutex;
 
     void pdu_handler(pmt::pmt_t pdu);
+    int least_loaded(bool by_size);
 
 public:
-    pdu_round_robin_impl(int num_outputs);
+    pdu_round_robin_impl(int num_outputs, dispatch_mode mode);
 
     ~pdu_round_robin_impl() override;
+
+    bool start() override;
+    bool stop() override;
+
+    void set_mode(dispatch_mode mode) override;
+    dispatch_mode get_mode() override;
+    std::vector<uint64_t> get_counts() override;
 };
 
 } // namespace pdu_utils
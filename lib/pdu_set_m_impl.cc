@@ -20,21 +20,35 @@ namespace gr {
 namespace pdu_utils {
 
 
-pdu_set_m::sptr pdu_set_m::make(pmt::pmt_t k, pmt::pmt_t v, bool kv_merge, bool v_overwrite)
+pdu_set_m::sptr pdu_set_m::make(pmt::pmt_t k,
+                                pmt::pmt_t v,
+                                bool kv_merge,
+                                bool v_overwrite,
+                                pmt::pmt_t pairs,
+                                bool merge_bytes)
 {
-    return gnuradio::make_block_sptr<pdu_utils::pdu_set_m_impl>(k, v, kv_merge, v_overwrite);
+    return gnuradio::make_block_sptr<pdu_utils::pdu_set_m_impl>(
+        k, v, kv_merge, v_overwrite, pairs, merge_bytes);
 }
 
 /*
  * The private constructor
  */
-pdu_set_m_impl::pdu_set_m_impl(pmt::pmt_t k, pmt::pmt_t v, bool kv_merge, bool v_overwrite)
+pdu_set_m_impl::pdu_set_m_impl(pmt::pmt_t k,
+                               pmt::pmt_t v,
+                               bool kv_merge,
+                               bool v_overwrite,
+                               pmt::pmt_t pairs,
+                               bool merge_bytes)
     : gr::block("pdu_set_m", io_signature::make(0, 0, 0), io_signature::make(0, 0, 0)),
-      d_k(k),
-      d_v(v),
+      d_pairs(pmt::PMT_NIL),
       d_kv_merge(kv_merge),
-      d_v_overwrite(v_overwrite)
+      d_v_overwrite(v_overwrite),
+      d_merge_bytes(merge_bytes)
 {
+    d_templates.push_back(compile(k, v));
+    set_pairs(pairs);
+
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_msg(msg); });
@@ -108,58 +122,95 @@ void pdu_set_m_impl::handle_msg(pmt::pmt_t pdu)
         return;
     }
 
-    if (!d_v_overwrite && pmt::dict_has_key(meta, d_k)) {
-        GR_LOG_WARN(d_logger, "key already found, and overwrite disabled");
-        return;
-    }
-
-    if (d_kv_merge) {
-        meta = parse_val(meta);
-    }
-    else {
-        meta = pmt::dict_add(meta, d_k, d_v);
-    }
+    meta = add_pairs(meta, d_kv_merge, !d_v_overwrite);
     message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, pmt::cdr(pdu)));
 }
 
 pmt::pmt_t pdu_set_m_impl::parse_val(pmt::pmt_t dict)
 {
-    std::string out_val;
-    std::string in_val = pmt::symbol_to_string(d_v);
-    std::string tmp;
-    pmt::pmt_t refval;
-    // if there are no values to parse, add key/val pair as seen and return
-    if (!(std::count(in_val.begin(), in_val.end(), '{'))) {
-        pmt::dict_add(dict, d_k, d_v);
-        return dict;
+    return add_pairs(dict, true, false);
+}
+
+/*
+ * Adds every key/value pair to the dictionary, substituting metadata values into
+ * the templates if merge is set
+ */
+pmt::pmt_t pdu_set_m_impl::add_pairs(pmt::pmt_t dict, bool merge, bool check_overwrite)
+{
+    pmt::pmt_t out = dict;
+    for (const kv_template& t : d_templates) {
+        if (check_overwrite && pmt::dict_has_key(dict, t.key)) {
+            GR_LOG_WARN(d_logger, "key already found, and overwrite disabled");
+            continue;
+        }
+        if (merge && !t.valid) {
+            continue;
+        }
+        if (!merge || t.refs.empty()) {
+            out = pmt::dict_add(out, t.key, t.val);
+        } else {
+            out = pmt::dict_add(out, t.key, substitute(t, dict));
+        }
+    }
+    return out;
+}
+
+/*
+ * Splits a value into the literal text and the {key} references between it. Values
+ * that are not symbols, or have no references, are added as is.
+ */
+pdu_set_m_impl::kv_template pdu_set_m_impl::compile(pmt::pmt_t k, pmt::pmt_t v)
+{
+    kv_template t;
+    t.key = k;
+    t.val = v;
+    t.valid = true;
+    if (!pmt::is_symbol(v)) {
+        return t;
     }
-    while (in_val.size()) {
-        // if there are no more left braces, append the rest of the val
-        if (!std::count(in_val.begin(), in_val.end(), '{')) {
-            out_val += in_val;
+
+    std::string in_val = pmt::symbol_to_string(v);
+    std::string literal;
+    size_t pos = 0;
+    while (pos < in_val.size()) {
+        size_t open = in_val.find('{', pos);
+        // if there are no more left braces, the rest of the val is literal
+        if (open == std::string::npos) {
+            literal += in_val.substr(pos);
             break;
         }
 
-        // if right brace appears before left brace, invalid syntax
-        if (in_val.find('}') < in_val.find('{')) {
-            GR_LOG_WARN(d_logger, "unable to parse val string");
-            return dict;
-        }
-        // read up to first brace and add to output string
-        tmp = in_val.substr(0, in_val.find('{'));
-        out_val += tmp;
-        in_val.erase(0, in_val.find('{')+1);
-        // if there's no right brace after a left brace, invalid syntax
-        if (in_val.find('}') > in_val.size()) {
-            GR_LOG_WARN(d_logger, "unable to parse val string");
-            return dict;
+        // a right brace before the left brace, or none after it, is invalid syntax
+        size_t close = in_val.find('}', pos);
+        if (close < open || close == std::string::npos) {
+            GR_LOG_WARN(d_logger,
+                        boost::format("unable to parse val string %1%") % in_val);
+            t.valid = false;
+            t.literals.clear();
+            t.refs.clear();
+            return t;
         }
 
-        // read in key to parse the metadata for
-        tmp = in_val.substr(0, in_val.find('}'));
-        in_val.erase(0, in_val.find('}')+1);
-        // if found, return value; otherwise, return key
-        refval = pmt::dict_ref(dict, pmt::intern(tmp), pmt::intern(tmp));
+        literal += in_val.substr(pos, open - pos);
+        t.literals.push_back(literal);
+        literal.clear();
+        t.refs.push_back(pmt::intern(in_val.substr(open + 1, close - open - 1)));
+        pos = close + 1;
+    }
+    t.literals.push_back(literal);
+    return t;
+}
+
+/*
+ * Builds the value string in one pass over the compiled template. As a u8vector the
+ * result is freed with the PDU; as a symbol it is interned for good.
+ */
+pmt::pmt_t pdu_set_m_impl::substitute(const kv_template& t, pmt::pmt_t dict)
+{
+    std::string out_val = t.literals[0];
+    for (size_t i = 0; i < t.refs.size(); i++) {
+        // if found, use value; otherwise, use key
+        pmt::pmt_t refval = pmt::dict_ref(dict, t.refs[i], t.refs[i]);
         // is_bool, is_integer, is_uint64, is_real, is_complex, is_symbol
         if (pmt::is_bool(refval)) {
             out_val += (pmt::is_true(refval)) ? "true" : "false";
@@ -171,23 +222,28 @@ pmt::pmt_t pdu_set_m_impl::parse_val(pmt::pmt_t dict)
             out_val += std::to_string(pmt::to_double(refval));
         } else if (pmt::is_complex(refval)) {
             std::complex<double> compval = pmt::to_complex(refval);
-            out_val += std::to_string(compval.real()) + "+" + std::to_string(compval.imag()) + "i";
+            out_val += std::to_string(compval.real()) + "+" +
+                       std::to_string(compval.imag()) + "i";
         } else if (pmt::is_symbol(refval)) {
             out_val += pmt::symbol_to_string(refval);
         } else {
-            GR_LOG_WARN(d_logger, boost::format("value type of %1% not supported") % tmp);
-            out_val += tmp;
+            GR_LOG_WARN(d_logger,
+                        boost::format("value type of %1% not supported") % t.refs[i]);
+            out_val += pmt::symbol_to_string(t.refs[i]);
         }
+        out_val += t.literals[i + 1];
+    }
+    if (d_merge_bytes) {
+        return pmt::init_u8vector(out_val.size(), (const uint8_t*)out_val.data());
     }
-    dict = pmt::dict_add(dict, d_k, pmt::intern(out_val));
-    return dict;
+    return pmt::intern(out_val);
 }
 
 void pdu_set_m_impl::set_key(pmt::pmt_t k)
 {
     gr::thread::scoped_lock l(d_setlock);
 
-    d_k = k;
+    d_templates[0].key = k;
 }
 
 
@@ -195,15 +251,35 @@ void pdu_set_m_impl::set_val(pmt::pmt_t v)
 {
     gr::thread::scoped_lock l(d_setlock);
 
-    d_v = v;
+    d_templates[0] = compile(d_templates[0].key, v);
 }
 
 void pdu_set_m_impl::set_kv(pmt::pmt_t k, pmt::pmt_t v)
 {
     gr::thread::scoped_lock l(d_setlock);
 
-    d_k = k;
-    d_v = v;
+    d_templates[0] = compile(k, v);
+}
+
+void pdu_set_m_impl::set_pairs(pmt::pmt_t pairs)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    if (!pmt::is_null(pairs) && !pmt::is_dict(pairs)) {
+        GR_LOG_WARN(d_logger, "additional pairs must be a dictionary, ignoring");
+        return;
+    }
+    d_pairs = pairs;
+    d_templates.resize(1);
+    if (pmt::is_null(pairs)) {
+        return;
+    }
+    pmt::pmt_t items = pmt::dict_items(pairs);
+    while (pmt::is_pair(items)) {
+        pmt::pmt_t item = pmt::car(items);
+        d_templates.push_back(compile(pmt::car(item), pmt::cdr(item)));
+        items = pmt::cdr(items);
+    }
 }
 
 void pdu_set_m_impl::set_kv_merge(bool kv_merge)
@@ -220,5 +296,12 @@ void pdu_set_m_impl::set_v_overwrite(bool v_overwrite)
     d_v_overwrite = v_overwrite;
 }
 
+void pdu_set_m_impl::set_merge_bytes(bool merge_bytes)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_merge_bytes = merge_bytes;
+}
+
 } /* namespace pdu_utils */
 } /* namespace gr */
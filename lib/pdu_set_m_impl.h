@@ -13,6 +13,9 @@
 #include <gnuradio/pdu_utils/constants.h>
 #include <gnuradio/pdu_utils/pdu_set_m.h>
 
+#include <string>
+#include <vector>
+
 namespace gr {
 namespace pdu_utils {
 
@@ -21,10 +24,25 @@ namespace pdu_utils {
 class pdu_set_m_impl : public pdu_set_m
 {
 private:
-    pmt::pmt_t d_k;
-    pmt::pmt_t d_v;
+    // a key and its value, with the value split into literal text and metadata key
+    // references for kv_merge
+    struct kv_template {
+        pmt::pmt_t key;
+        pmt::pmt_t val;
+        bool valid;                        // false if the braces did not parse
+        std::vector<std::string> literals; // literals[i] precedes refs[i], one extra
+        std::vector<pmt::pmt_t> refs;
+    };
+
+    std::vector<kv_template> d_templates; // the k/v pair first, then the extra pairs
+    pmt::pmt_t d_pairs;
     bool d_kv_merge;
     bool d_v_overwrite;
+    bool d_merge_bytes;
+
+    kv_template compile(pmt::pmt_t k, pmt::pmt_t v);
+    pmt::pmt_t substitute(const kv_template& t, pmt::pmt_t dict);
+    pmt::pmt_t add_pairs(pmt::pmt_t dict, bool merge, bool check_overwrite);
 
 public:
     /**
@@ -34,8 +52,15 @@ public:
      * @param v - Value to add
      * @param kv_merge - Bool to parse v for keys
      * @param v_overwrite - Bool to overwrite key/val pair if key already present
+     * @param pairs - Dictionary of additional key/value pairs
+     * @param merge_bytes - Bool to add merged values as u8vectors
      */
-    pdu_set_m_impl(pmt::pmt_t k, pmt::pmt_t v, bool kv_merge, bool v_overwrite);
+    pdu_set_m_impl(pmt::pmt_t k,
+                   pmt::pmt_t v,
+                   bool kv_merge,
+                   bool v_overwrite,
+                   pmt::pmt_t pairs,
+                   bool merge_bytes);
 
     /**
      * Deconstructor
@@ -51,14 +76,14 @@ public:
      *
      * @return pmt::pmt_t
      */
-    pmt::pmt_t key() { return d_k; }
+    pmt::pmt_t key() { return d_templates[0].key; }
 
     /**
      * Get Val value
      *
      * @return pmt::pmt_t
      */
-    pmt::pmt_t val() { return d_v; }
+    pmt::pmt_t val() { return d_templates[0].val; }
 
     /**
      * Set Key Value
@@ -96,6 +121,34 @@ public:
      */
     void set_v_overwrite(bool v_overwrite);
 
+    /**
+     * Get additional K-V pairs
+     *
+     * @return pmt::pmt_t
+     */
+    pmt::pmt_t pairs() { return d_pairs; }
+
+    /**
+     * Set additional K-V pairs
+     *
+     * @param pairs - dictionary of keys and values
+     */
+    void set_pairs(pmt::pmt_t pairs);
+
+    /**
+     * Set Merge Bytes Value
+     *
+     * @param merge_bytes - u8vector boolean
+     */
+    void set_merge_bytes(bool merge_bytes);
+
+    /**
+     * Get Merge Bytes Value
+     *
+     * @return bool
+     */
+    bool merge_bytes() { return d_merge_bytes; }
+
     /**
      * Set Parsed Val
      *
@@ -14,6 +14,8 @@
 #include <gnuradio/io_signature.h>
 #include "pdu_slice_impl.h"
 #include "gnuradio/pdu_utils/constants.h"
+#include <climits>
+#include <cstdlib>
 
 namespace gr {
 namespace pdu_utils {
@@ -30,14 +32,10 @@ pdu_slice::make(std::string slice)
 pdu_slice_impl::pdu_slice_impl(std::string slice)
     : gr::block("pdu_slice",
                 gr::io_signature::make(0, 0, 0),
-                gr::io_signature::make(0, 0, 0)),
-      d_slice(slice),
-      d_start_index(0),
-      d_stop_index(INT_MAX),
-      d_stride_size(1),
-      d_blank_start(false),
-      d_blank_stop(false)
+                gr::io_signature::make(0, 0, 0))
 {
+    set_slice(slice);
+
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->pdu_slice_impl::handle_pdu(msg); });
@@ -50,38 +48,103 @@ pdu_slice_impl::pdu_slice_impl(std::string slice)
 pdu_slice_impl::~pdu_slice_impl() {}
 
 
-template<typename T>
-void pdu_slice_impl::slice_vector(std::vector<T> &in_data, std::vector<T> &out_data)
+/*
+ * Resolves the slice against a PDU of length v_len with python semantics: negative
+ * indices count from the end, out of range indices are clamped and blank indices
+ * default to the start or end depending on the direction of the stride.
+ */
+pdu_slice_impl::slice_range pdu_slice_impl::resolve(const slice_spec& spec, int v_len)
+{
+    long len = v_len;
+    long stride = spec.stride;
+
+    auto clamp = [len, stride](long idx) {
+        if (idx < 0) {
+            idx += len;
+            if (idx < 0) {
+                idx = (stride < 0) ? -1 : 0;
+            }
+        } else if (idx >= len) {
+            idx = (stride < 0) ? len - 1 : len;
+        }
+        return idx;
+    };
+
+    // positive stride puts the start of the slice at the front
+    // negative stride puts the start of the slice at the back
+    long start = spec.blank_start ? ((stride > 0) ? 0 : len - 1) : clamp(spec.start);
+    long stop = spec.blank_stop ? ((stride > 0) ? len : -1) : clamp(spec.stop);
+
+    long span = (stride > 0) ? stop - start : start - stop;
+    long step = std::abs(stride);
+
+    slice_range range;
+    range.first = start;
+    range.stride = stride;
+    range.count = (span > 0) ? (span + step - 1) / step : 0;
+    return range;
+}
+
+
+template <typename T>
+pmt::pmt_t pdu_slice_impl::slice_vector(const pdu_view<T>& in_data,
+                                        const slice_range& range)
+{
+    if (range.count == 0) {
+        return pdu_builder<T>(0).release();
+    }
+
+    // contiguous slices are a single copy into the new vector
+    const T* in = in_data.data() + range.first;
+    if (range.stride == 1) {
+        return pdu_builder<T>::copy_of(in, range.count);
+    }
+
+    // otherwise gather with the stride, reversed for negative strides
+    pdu_builder<T> out_data(range.count);
+    T* out = out_data.data();
+    const long stride = range.stride;
+    for (size_t i = 0; i < range.count; i++) {
+        out[i] = in[i * stride];
+    }
+    return out_data.release();
+}
+
+
+/*
+ * Moves start_time to the earliest sample kept and sets duration to the span of the
+ * output, if the PDU has a sample rate to convert indices to time
+ */
+pmt::pmt_t pdu_slice_impl::update_time(pmt::pmt_t meta, const slice_range& range)
 {
-  int v_len = in_data.size();
-  out_data.reserve(v_len);
-
-  // update index values according to length of PDU data
-  if (d_start_index < -v_len) d_start_index = 0;
-  if (d_start_index < 0) d_start_index += v_len;
-  if (d_start_index > v_len) d_start_index = (d_stride_size > 0) ? v_len : v_len-1;
-
-  if (d_stop_index < -v_len) d_stop_index = 0;
-  if (d_stop_index < 0) d_stop_index += v_len;
-  if (d_stop_index > v_len) d_stop_index = v_len;
-
-  // if slice notation has blank values, update the indices now
-  // positive stride puts the start of the slice at the front
-  // negative stride puts the start of the slice at the back
-  if (d_blank_start == true) d_start_index = (d_stride_size > 0) ? 0 : v_len-1;
-  if (d_blank_stop == true) d_stop_index = (d_stride_size > 0) ? v_len : -1;
-
-  // positive stride - forward traversal
-  if (d_stride_size > 0) {
-     for (int i = d_start_index; i < d_stop_index; i += d_stride_size) {
-         out_data.push_back(in_data[i]);
-      }
-  } else {
-  // negative stride - backward traversal
-     for (int i = d_start_index; i > d_stop_index; i += d_stride_size) {
-          out_data.push_back(in_data[i]);
-     }
-  }
+    if (!pmt::is_dict(meta) || !pmt::dict_has_key(meta, PMTCONSTSTR__sample_rate())) {
+        return meta;
+    }
+    double sample_rate =
+        pmt::to_double(pmt::dict_ref(meta, PMTCONSTSTR__sample_rate(), pmt::PMT_NIL));
+    if (sample_rate <= 0) {
+        return meta;
+    }
+
+    long stride = std::abs(range.stride);
+    long earliest = range.first;
+    if (range.stride < 0 && range.count > 0) {
+        earliest += range.stride * (long)(range.count - 1);
+    }
+
+    if (pmt::dict_has_key(meta, PMTCONSTSTR__start_time())) {
+        double start_time =
+            pmt::to_double(pmt::dict_ref(meta, PMTCONSTSTR__start_time(), pmt::PMT_NIL));
+        meta = pmt::dict_add(meta,
+                             PMTCONSTSTR__start_time(),
+                             pmt::from_double(start_time + earliest / sample_rate));
+    }
+    if (pmt::dict_has_key(meta, PMTCONSTSTR__duration())) {
+        meta = pmt::dict_add(meta,
+                             PMTCONSTSTR__duration(),
+                             pmt::from_float(float(range.count * stride / sample_rate)));
+    }
+    return meta;
 }
 
 
@@ -93,171 +156,106 @@ void pdu_slice_impl::handle_pdu(pmt::pmt_t pdu)
         return;
     }
 
-    // parse slice notation and update values
-    try {
-        this->set_slice(d_slice);
-    }
-    catch (const std::exception&) {
-        throw std::runtime_error("");
+    slice_spec spec;
+    {
+        gr::thread::scoped_lock l(d_mutex);
+        spec = d_spec;
     }
+
     pmt::pmt_t meta = pmt::car(pdu);
     pmt::pmt_t v_data = pmt::cdr(pdu);
 
-    // is data u8int?
-    if (pmt::is_u8vector(v_data)) {
-        std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> out_data;
-        slice_vector(in_data, out_data);
+    bool handled =
+        pdu_dispatch<uint8_t, float, gr_complex>(v_data, [&](auto in_data) {
+            slice_range range = resolve(spec, in_data.size());
+            pmt::pmt_t out_data = slice_vector(in_data, range);
 
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_u8vector(out_data.size(), out_data))));
+            // publish the new pdu
+            message_port_pub(PMTCONSTSTR__pdu_out(),
+                             pmt::cons(update_time(meta, range), out_data));
+        });
 
+    if (!handled) {
+        GR_LOG_WARN(d_logger, "Got unknown PDU vector type, dropping");
     }
-    // is data float?
-    else if (pmt::is_f32vector(v_data)) {
-        std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<float> out_data;
-        slice_vector(in_data, out_data);
+}
 
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_f32vector(out_data.size(), out_data))));
 
+int pdu_slice_impl::parse_index(const std::string& token, const char* name)
+{
+    try {
+        return stoi(token);
+    } catch (const std::exception&) {
+        GR_LOG_ERROR(d_logger,
+                     boost::format("received invalid %s for slice") % name);
+        throw std::runtime_error("");
     }
-    // is data complex32?
-    else if (pmt::is_c32vector(v_data)) {
-        std::vector<gr_complex> in_data = pmt::c32vector_elements(v_data);
-        std::vector<gr_complex> out_data;
-        slice_vector(in_data, out_data);
-
-        // publish the new pdu
-        message_port_pub(
-            PMTCONSTSTR__pdu_out(),
-            (pmt::cons(meta, pmt::init_c32vector(out_data.size(), out_data))));
-    }
-    else {
-        GR_LOG_WARN(d_logger, "Got unknown PDU vector type, dropping");
-    }
-
 }
 
-void pdu_slice_impl::set_slice(std::string slice)
+
+/*
+ * Parses [start:stop] or [start:stop:stride], any of which may be blank
+ */
+pdu_slice_impl::slice_spec pdu_slice_impl::parse_slice(const std::string& slice)
 {
-    d_slice = slice;
-    std::string start_token, stop_token, stride_token, tmp;
+    slice_spec spec;
+    spec.start = 0;
+    spec.stop = INT_MAX;
+    spec.stride = 1;
 
     // Make sure slice notation begins and ends in brackets
-    if (d_slice.find("[") !=0 ||
-        d_slice.find("]") != d_slice.size()-1) {
-            GR_LOG_ERROR(d_logger, "received invalid slice notation");
-            throw std::runtime_error("");
+    if (slice.find("[") != 0 || slice.find("]") != slice.size() - 1) {
+        GR_LOG_ERROR(d_logger, "received invalid slice notation");
+        throw std::runtime_error("");
     }
 
     // Find number of colons to determine how to parse notation
-    size_t num_colon = count(d_slice.begin(), d_slice.end(), ':');
-
-    switch (num_colon) {
-        case 1 :    // one colon - [start index : stop index] with stride size = 1
-            // parse from open bracket to colon for start index
-            start_token = d_slice.substr(1,d_slice.find(":")-1);
-            // if blank, set boolean to true
-            // otherwise, try to interpret as integer
-            if (!start_token.compare("")) {
-                d_blank_start = true;
-            } else {
-                d_blank_start = false;
-                try {
-                    d_start_index = stoi(start_token);
-                }
-                catch (const std::exception&) {
-                    GR_LOG_ERROR(d_logger, "received invalid start index for slice");
-                    throw std::runtime_error("");
-                }
-            }
-            // parse from colon to end bracket for stop index
-            tmp = d_slice.substr(d_slice.find(":")+1);
-            stop_token = tmp.substr(0,tmp.size()-1);
-            // if blank, set boolean to true
-            // otherwise, try to interpret as integer
-            if (!stop_token.compare("")) {
-                d_blank_stop = true;
-            } else {
-                d_blank_stop = false;
-                try {
-                    d_stop_index = stoi(stop_token);
-                }
-                catch (const std::exception&) {
-                    GR_LOG_ERROR(d_logger, "received invalid stop index for slice");
-                    throw std::runtime_error("");
-                }
-                // set stride size to default
-                d_stride_size = 1;
-            }
-            break;
-        case 2 :     // two colons - [start index : stop index : stride size]
-            // parse from open bracket to first colon for start index
-            start_token = d_slice.substr(1,d_slice.find(":")-1);
-            // if blank, set boolean to true
-            // otherwise, try to interpret as integer
-            if (!start_token.compare("")) {
-                d_blank_start = true;
-            } else {
-                d_blank_start = false;
-                try {
-                    d_start_index = stoi(start_token);
-                }
-                catch (const std::exception&) {
-                    GR_LOG_ERROR(d_logger, "received invalid start index for slice");
-                    throw std::runtime_error("");
-                }
-            }
-            // parse from first colon to second colon for stop index
-            tmp = d_slice.substr(d_slice.find(":")+1);
-            stop_token = tmp.substr(0,tmp.find(":"));
-            // if blank, set boolean to true
-            // otherwise, try to interpret as integer
-            if (!stop_token.compare("")) {
-                d_blank_stop = true;
-            } else {
-                d_blank_stop = false;
-                try {
-                    d_stop_index = stoi(stop_token);
-                }
-                catch (const std::exception&) {
-                    GR_LOG_ERROR(d_logger, "received invalid stop index for slice");
-                    throw std::runtime_error("");
-                }
-            }
-            // parse from second colon to end bracket for stride size
-            tmp = tmp.substr(tmp.find(":")+1);
-            stride_token = tmp.substr(0,tmp.size()-1);
-            // if blank, set stride size to 1
-            // otherwise, try to interpret as integer
-            if (!stride_token.compare("")) {
-                d_stride_size = 1;
-            } else {
-                try {
-                    d_stride_size = stoi(stride_token);
-                }
-                catch (const std::exception&) {
-                    GR_LOG_ERROR(d_logger, "received invalid stride size for slice");
-                    throw std::runtime_error("");
-                }
-                // stride size cannot be 0
-                if (d_stride_size == 0) {
-                    GR_LOG_ERROR(d_logger, "received zero stride size for slice");
-                    throw std::runtime_error("");
-            }
-            break;
-        // if number of colons is not 1 or 2, notation is invalid
-        default :
-                GR_LOG_ERROR(d_logger, "received invalid slice notation");
+    size_t num_colon = count(slice.begin(), slice.end(), ':');
+    if (num_colon != 1 && num_colon != 2) {
+        GR_LOG_ERROR(d_logger, "received invalid slice notation");
+        throw std::runtime_error("");
+    }
+
+    std::string body = slice.substr(1, slice.size() - 2);
+    size_t colon1 = body.find(":");
+    size_t colon2 = body.find(":", colon1 + 1);
+    std::string start_token = body.substr(0, colon1);
+    std::string stop_token = body.substr(colon1 + 1, colon2 - colon1 - 1);
+
+    // blank start and stop are resolved per PDU
+    spec.blank_start = start_token.empty();
+    if (!spec.blank_start) {
+        spec.start = parse_index(start_token, "start index");
+    }
+    spec.blank_stop = stop_token.empty();
+    if (!spec.blank_stop) {
+        spec.stop = parse_index(stop_token, "stop index");
+    }
+
+    if (colon2 != std::string::npos) {
+        std::string stride_token = body.substr(colon2 + 1);
+        if (!stride_token.empty()) {
+            spec.stride = parse_index(stride_token, "stride size");
+            // stride size cannot be 0
+            if (spec.stride == 0) {
+                GR_LOG_ERROR(d_logger, "received zero stride size for slice");
                 throw std::runtime_error("");
+            }
         }
     }
+
+    return spec;
+}
+
+
+void pdu_slice_impl::set_slice(std::string slice)
+{
+    // parse before taking the lock so an invalid slice leaves the current one in place
+    slice_spec spec = parse_slice(slice);
+
+    gr::thread::scoped_lock l(d_mutex);
+    d_slice = slice;
+    d_spec = spec;
 }
 
 
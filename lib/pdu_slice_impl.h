@@ -10,6 +10,7 @@
 #ifndef INCLUDED_PDU_UTILS_PDU_SLICE_IMPL_H
 #define INCLUDED_PDU_UTILS_PDU_SLICE_IMPL_H
 
+#include "pdu_view.h"
 #include "gnuradio/pdu_utils/constants.h"
 #include <gnuradio/io_signature.h>
 #include <gnuradio/pdu_utils/pdu_slice.h>
@@ -19,16 +20,32 @@ namespace pdu_utils {
 class pdu_slice_impl : public pdu_slice
 {
 private:
-    template<typename T>
-    void slice_vector(std::vector<T> &in_data, std::vector<T> &out_data);
+    // parsed slice notation, blank start/stop are resolved against each PDU
+    struct slice_spec {
+        int start;
+        int stop;
+        int stride;
+        bool blank_start;
+        bool blank_stop;
+    };
+
+    // python slice resolved for one PDU length
+    struct slice_range {
+        long first;
+        long stride;
+        size_t count;
+    };
 
-private:
     std::string d_slice;
-    int d_start_index;
-    int d_stop_index;
-    int d_stride_size;
-    bool d_blank_start;
-    bool d_blank_stop;
+    slice_spec d_spec;
+    gr::thread::mutex d_mutex;
+
+    slice_spec parse_slice(const std::string& slice);
+    int parse_index(const std::string& token, const char* name);
+    static slice_range resolve(const slice_spec& spec, int v_len);
+    template <typename T>
+    pmt::pmt_t slice_vector(const pdu_view<T>& in_data, const slice_range& range);
+    pmt::pmt_t update_time(pmt::pmt_t meta, const slice_range& range);
 
 public:
     /**
@@ -51,8 +68,6 @@ public:
      * @param slice
      */
     void set_slice(std::string slice);
-    
-
 };
 
 } // namespace pdu_utils
@@ -0,0 +1,194 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_PDU_VIEW_H
+#define INCLUDED_PDU_UTILS_PDU_VIEW_H
+
+#include <gnuradio/gr_complex.h>
+#include <pmt/pmt.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * Maps an element type to the matching PMT uniform vector functions. Only the
+ * specializations below exist, so using an unsupported type is a compile error.
+ */
+template <typename T>
+struct pdu_vector_traits;
+
+#define PDU_UTILS_VECTOR_TRAITS(T, N)                                               \
+    template <>                                                                    \
+    struct pdu_vector_traits<T> {                                                  \
+        static bool is(const pmt::pmt_t& v) { return pmt::is_##N##vector(v); }     \
+        static const T* elements(const pmt::pmt_t& v, size_t& len)                 \
+        {                                                                          \
+            return pmt::N##vector_elements(v, len);                                \
+        }                                                                          \
+        static T* writable_elements(const pmt::pmt_t& v, size_t& len)              \
+        {                                                                          \
+            return pmt::N##vector_writable_elements(v, len);                       \
+        }                                                                          \
+        static pmt::pmt_t make(size_t len, T fill)                                 \
+        {                                                                          \
+            return pmt::make_##N##vector(len, fill);                               \
+        }                                                                          \
+        static pmt::pmt_t init(size_t len, const T* data)                          \
+        {                                                                          \
+            return pmt::init_##N##vector(len, data);                               \
+        }                                                                          \
+    };
+
+PDU_UTILS_VECTOR_TRAITS(uint8_t, u8)
+PDU_UTILS_VECTOR_TRAITS(int8_t, s8)
+PDU_UTILS_VECTOR_TRAITS(uint16_t, u16)
+PDU_UTILS_VECTOR_TRAITS(int16_t, s16)
+PDU_UTILS_VECTOR_TRAITS(uint32_t, u32)
+PDU_UTILS_VECTOR_TRAITS(int32_t, s32)
+PDU_UTILS_VECTOR_TRAITS(uint64_t, u64)
+PDU_UTILS_VECTOR_TRAITS(int64_t, s64)
+PDU_UTILS_VECTOR_TRAITS(float, f32)
+PDU_UTILS_VECTOR_TRAITS(double, f64)
+PDU_UTILS_VECTOR_TRAITS(gr_complex, c32)
+PDU_UTILS_VECTOR_TRAITS(gr_complexd, c64)
+
+#undef PDU_UTILS_VECTOR_TRAITS
+
+/**
+ * Read only view of the elements of a PMT uniform vector.
+ *
+ * The view points directly at the PMT storage and holds a reference to the vector so
+ * the data stays valid for the lifetime of the view; no elements are copied. The
+ * vector type must be checked before construction, either with pdu_vector_traits or
+ * through pdu_dispatch().
+ */
+template <typename T>
+class pdu_view
+{
+public:
+    typedef T value_type;
+    typedef const T* const_iterator;
+
+    explicit pdu_view(pmt::pmt_t vec) : d_vec(vec), d_size(0)
+    {
+        d_data = pdu_vector_traits<T>::elements(d_vec, d_size);
+    }
+
+    const T* data() const { return d_data; }
+    size_t size() const { return d_size; }
+    bool empty() const { return d_size == 0; }
+    const T& operator[](size_t i) const { return d_data[i]; }
+    const_iterator begin() const { return d_data; }
+    const_iterator end() const { return d_data + d_size; }
+
+    // the viewed vector, for republishing the input unmodified
+    const pmt::pmt_t& vector() const { return d_vec; }
+
+private:
+    pmt::pmt_t d_vec;
+    const T* d_data;
+    size_t d_size;
+};
+
+/**
+ * Writable output vector of known size.
+ *
+ * The output PMT is allocated once up front and filled in place through data(), so
+ * handlers do not build a std::vector and copy it into the PMT. release() returns the
+ * finished vector for publishing.
+ */
+template <typename T>
+class pdu_builder
+{
+public:
+    typedef T value_type;
+    typedef T* iterator;
+
+    explicit pdu_builder(size_t len, T fill = T()) : d_size(0)
+    {
+        d_vec = pdu_vector_traits<T>::make(len, fill);
+        d_data = pdu_vector_traits<T>::writable_elements(d_vec, d_size);
+    }
+
+    T* data() { return d_data; }
+    size_t size() const { return d_size; }
+    T& operator[](size_t i) { return d_data[i]; }
+    iterator begin() { return d_data; }
+    iterator end() { return d_data + d_size; }
+
+    pmt::pmt_t release() { return d_vec; }
+
+    /**
+     * Copy of a contiguous range in a single allocation
+     */
+    static pmt::pmt_t copy_of(const T* in, size_t len)
+    {
+        return pdu_vector_traits<T>::init(len, in);
+    }
+
+private:
+    pmt::pmt_t d_vec;
+    T* d_data;
+    size_t d_size;
+};
+
+namespace detail {
+
+template <typename T, typename F>
+inline bool pdu_dispatch_one(const pmt::pmt_t& vec, F& f)
+{
+    if (!pdu_vector_traits<T>::is(vec)) {
+        return false;
+    }
+    f(pdu_view<T>(vec));
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * Calls f with a pdu_view<T> of vec for the first T in Ts matching the vector type.
+ * f is normally a generic lambda, so one body is instantiated per supported type in
+ * place of an if/else chain per type.
+ *
+ * Returns false without calling f if vec is not one of the listed types.
+ */
+template <typename... Ts, typename F>
+inline bool pdu_dispatch(const pmt::pmt_t& vec, F&& f)
+{
+    return (detail::pdu_dispatch_one<Ts>(vec, f) || ...);
+}
+
+/**
+ * pdu_dispatch() over every PMT uniform vector type
+ */
+template <typename F>
+inline bool pdu_dispatch_all(const pmt::pmt_t& vec, F&& f)
+{
+    return pdu_dispatch<uint8_t,
+                        int8_t,
+                        uint16_t,
+                        int16_t,
+                        uint32_t,
+                        int32_t,
+                        uint64_t,
+                        int64_t,
+                        float,
+                        double,
+                        gr_complex,
+                        gr_complexd>(vec, std::forward<F>(f));
+}
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_PDU_VIEW_H */
@@ -12,28 +12,38 @@
 #endif
 
 #include "upsample_impl.h"
+#include "pdu_view.h"
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
 
 namespace gr {
 namespace pdu_utils {
 
-upsample::sptr upsample::make(uint32_t n, bool repeat)
+upsample::sptr upsample::make(uint32_t n, bool repeat, const std::vector<float> taps)
 {
-    return gnuradio::make_block_sptr<upsample_impl>(n, repeat);
+    return gnuradio::make_block_sptr<upsample_impl>(n, repeat, taps);
 }
 
 /*
  * The private constructor
  */
-upsample_impl::upsample_impl(uint32_t n, bool repeat)
+upsample_impl::upsample_impl(uint32_t n, bool repeat, const std::vector<float> taps)
     : gr::block("upsample", io_signature::make(0, 0, 0), io_signature::make(0, 0, 0)),
-      d_repeat(repeat)
+      d_repeat(repeat),
+      d_taps(taps),
+      d_branch_len(0),
+      d_first(0)
 {
     if (n > 0) {
         d_n = n;
     } else {
         throw std::invalid_argument("pdu_utils upsample: ERROR! n must be >= 1!\n");
     }
+    // workaround for upstream FIR kernels reading past the end of the input
+    d_pad = volk_get_alignment() / sizeof(float);
+    update_branches();
+
     message_port_register_in(PMTCONSTSTR__pdu_in());
     set_msg_handler(PMTCONSTSTR__pdu_in(),
                     [this](pmt::pmt_t msg) { this->handle_msg(msg); });
@@ -56,6 +66,11 @@ void upsample_impl::handle_msg(pmt::pmt_t pdu)
 
     gr::thread::scoped_lock l(d_setlock);
 
+    if (!d_taps.empty()) {
+        handle_msg_taps(pmt::car(pdu), pmt::cdr(pdu));
+        return;
+    }
+
     // if the repquested repetition is 1, just re-publish the message
     if (d_n == 1) {
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
@@ -70,244 +85,147 @@ void upsample_impl::handle_msg(pmt::pmt_t pdu)
         return;
     }
 
-    uint32_t v_len = pmt::length(v_data);
-    uint32_t out_len = v_len * d_n;
+    size_t v_len = pmt::length(v_data);
+    size_t out_len = v_len * d_n;
 
     // if the input length is zero, just re-publish the message
     if (v_len == 0) {
         message_port_pub(PMTCONSTSTR__pdu_out(), pdu);
         return;
+    }
 
-    } else if (pmt::is_u8vector(v_data)) {
-        // 8 bit integers
-        const std::vector<uint8_t> in_data = pmt::u8vector_elements(v_data);
-        std::vector<uint8_t> output;
+    bool handled = pdu_dispatch_all(v_data, [&](auto in_data) {
+        typedef typename decltype(in_data)::value_type T;
+        pdu_builder<T> output(out_len);
         if (d_repeat) {
-            output.reserve(out_len);
             for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
+                std::fill_n(&output[ii * d_n], d_n, in_data[ii]);
             }
         } else {
-            output.resize(out_len, 0);
             for (size_t ii = 0; ii < v_len; ii++) {
                 output[ii * d_n] = in_data[ii];
             }
         }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_u8vector(output.size(), output)));
+        message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, output.release()));
+    });
 
-    } else if (pmt::is_s8vector(v_data)) {
-        // 8 bit integers
-        const std::vector<int8_t> in_data = pmt::s8vector_elements(v_data);
-        std::vector<int8_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_s8vector(output.size(), output)));
+    if (!handled) {
+        // drop message and return
+        GR_LOG_NOTICE(d_logger, "unknown PDU vector type, dropped");
+    }
+}
 
-    } else if (pmt::is_u16vector(v_data)) {
-        // 16 bit integers
-        const std::vector<uint16_t> in_data = pmt::u16vector_elements(v_data);
-        std::vector<uint16_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_u16vector(output.size(), output)));
 
-    } else if (pmt::is_s16vector(v_data)) {
-        // 16 bit integers
-        const std::vector<int16_t> in_data = pmt::s16vector_elements(v_data);
-        std::vector<int16_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_s16vector(output.size(), output)));
+/*
+ * Polyphase interpolation
+ *
+ * Zero stuffing by n and filtering with taps h is equivalent to running n branch
+ * filters h[p], h[p+n], h[p+2n], ... over the input and interleaving the results.
+ * In repeat mode the taps are first convolved with an n sample boxcar, which is the
+ * same as filtering the repeated samples. As with the PDU FIR Filter block the
+ * output is compensated for the group delay of the user taps; for even numbers of
+ * taps the output is half an output sample late.
+ */
+void upsample_impl::handle_msg_taps(pmt::pmt_t meta, pmt::pmt_t v_data)
+{
+    if (!(is_dict(meta) && pmt::is_uniform_vector(v_data))) {
+        GR_LOG_NOTICE(d_logger, "received unexpected PMT (non-PDU)");
+        return;
+    }
 
-    } else if (pmt::is_u32vector(v_data)) {
-        // 32 bit integers
-        const std::vector<uint32_t> in_data = pmt::u32vector_elements(v_data);
-        std::vector<uint32_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_u32vector(output.size(), output)));
+    size_t v_len = 0;
+    pmt::pmt_t out_data;
+    if (pmt::is_f32vector(v_data)) {
+        const float* in_p = pmt::f32vector_elements(v_data, v_len);
+        d_in_f.assign(d_branch_len - 1, 0);
+        d_in_f.insert(d_in_f.end(), in_p, in_p + v_len);
+        d_in_f.resize(d_in_f.size() + 2 * d_branch_len + d_pad, 0);
 
-    } else if (pmt::is_s32vector(v_data)) {
-        // 32 bit integers
-        const std::vector<int32_t> in_data = pmt::s32vector_elements(v_data);
-        std::vector<int32_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_s32vector(output.size(), output)));
+        out_data = pmt::make_f32vector(v_len * d_n, 0);
+        size_t out_len;
+        float* out = pmt::f32vector_writable_elements(out_data, out_len);
+        interpolate(out, out_len, d_in_f.data(), d_branches_fff);
 
-    } else if (pmt::is_u64vector(v_data) || pmt::is_s64vector(v_data)) {
-        // 64 bit integers
-        const std::vector<uint64_t> in_data = pmt::u64vector_elements(v_data);
-        std::vector<uint64_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_u64vector(output.size(), output)));
+    } else if (pmt::is_c32vector(v_data)) {
+        const gr_complex* in_p = pmt::c32vector_elements(v_data, v_len);
+        d_in_c.assign(d_branch_len - 1, 0);
+        d_in_c.insert(d_in_c.end(), in_p, in_p + v_len);
+        d_in_c.resize(d_in_c.size() + 2 * d_branch_len + d_pad, 0);
 
-    } else if (pmt::is_s64vector(v_data)) {
-        // 64 bit integers
-        const std::vector<int64_t> in_data = pmt::s64vector_elements(v_data);
-        std::vector<int64_t> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_s64vector(output.size(), output)));
+        out_data = pmt::make_c32vector(v_len * d_n, 0);
+        size_t out_len;
+        gr_complex* out = pmt::c32vector_writable_elements(out_data, out_len);
+        interpolate(out, out_len, d_in_c.data(), d_branches_ccf);
 
-    } else if (pmt::is_f32vector(v_data)) {
-        // single precision floating point
-        const std::vector<float> in_data = pmt::f32vector_elements(v_data);
-        std::vector<float> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
-        }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_f32vector(output.size(), output)));
+    } else if (pmt::is_u8vector(v_data)) {
+        // bytes are interpolated to float
+        const uint8_t* in_p = pmt::u8vector_elements(v_data, v_len);
+        d_in_f.assign(d_branch_len - 1, 0);
+        d_in_f.insert(d_in_f.end(), in_p, in_p + v_len);
+        d_in_f.resize(d_in_f.size() + 2 * d_branch_len + d_pad, 0);
 
-    } else if (pmt::is_f64vector(v_data)) {
-        // double precision floating point
-        const std::vector<double> in_data = pmt::f64vector_elements(v_data);
-        std::vector<double> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
-            }
+        out_data = pmt::make_f32vector(v_len * d_n, 0);
+        size_t out_len;
+        float* out = pmt::f32vector_writable_elements(out_data, out_len);
+        interpolate(out, out_len, d_in_f.data(), d_branches_fff);
+
+    } else {
+        GR_LOG_NOTICE(d_logger,
+                      "interpolation only supports byte, float, or complex PDUs, dropped");
+        return;
+    }
+
+    message_port_pub(PMTCONSTSTR__pdu_out(), pmt::cons(meta, out_data));
+}
+
+template <class T, class B>
+void upsample_impl::interpolate(T* out,
+                                size_t out_len,
+                                const T* in,
+                                const std::vector<B>& branches)
+{
+    // output k is sample d_first + k of the full convolution, which is branch p
+    // applied at input i; inputs are offset by d_branch_len - 1 zeros
+    size_t i = d_first / d_n;
+    size_t p = d_first % d_n;
+    for (size_t k = 0; k < out_len; k++) {
+        out[k] = branches[p].filter(&in[i]);
+        if (++p == d_n) {
+            p = 0;
+            i++;
         }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_f64vector(output.size(), output)));
+    }
+}
 
-    } else if (pmt::is_c32vector(v_data)) {
-        // gr_complex
-        const std::vector<gr_complex> in_data = pmt::c32vector_elements(v_data);
-        std::vector<gr_complex> output;
-        if (d_repeat) {
-            output.reserve(out_len);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                for (size_t jj = 0; jj < d_n; jj++) {
-                    output.push_back(in_data[ii]);
-                }
-            }
-        } else {
-            output.resize(out_len, 0);
-            for (size_t ii = 0; ii < v_len; ii++) {
-                output[ii * d_n] = in_data[ii];
+void upsample_impl::update_branches()
+{
+    d_branches_fff.clear();
+    d_branches_ccf.clear();
+    if (d_taps.empty()) {
+        return;
+    }
+
+    std::vector<float> taps(d_taps);
+    if (d_repeat && d_n > 1) {
+        taps.assign(d_taps.size() + d_n - 1, 0);
+        for (size_t ii = 0; ii < d_taps.size(); ii++) {
+            for (size_t jj = 0; jj < d_n; jj++) {
+                taps[ii + jj] += d_taps[ii];
             }
         }
-        message_port_pub(PMTCONSTSTR__pdu_out(),
-                         pmt::cons(meta, pmt::init_c32vector(output.size(), output)));
-    } else if (pmt::is_c64vector(v_data)) {
-        // TODO: support this...
-        GR_LOG_NOTICE(d_logger, "PDU of type complex double not supported, dropped");
-        return;
+    }
 
-    } else {
-        // drop message and return
-        GR_LOG_NOTICE(d_logger, "unknown PDU vector type, dropped");
-        return;
+    d_first = (d_taps.size() - 1) / 2;
+    d_branch_len = (taps.size() + d_n - 1) / d_n;
+    std::vector<float> branch(d_branch_len);
+    for (size_t p = 0; p < d_n; p++) {
+        for (size_t k = 0; k < d_branch_len; k++) {
+            size_t idx = p + k * d_n;
+            branch[k] = (idx < taps.size()) ? taps[idx] : 0;
+        }
+        d_branches_fff.emplace_back(branch);
+        d_branches_ccf.emplace_back(branch);
     }
-    return;
 }
 
 
@@ -317,6 +235,7 @@ void upsample_impl::set_n(uint32_t n)
 
     if (n > 0) {
         d_n = n;
+        update_branches();
     }
 }
 
@@ -326,6 +245,16 @@ void upsample_impl::set_repeat(bool repeat)
     gr::thread::scoped_lock l(d_setlock);
 
     d_repeat = repeat;
+    update_branches();
+}
+
+
+void upsample_impl::set_taps(std::vector<float> taps)
+{
+    gr::thread::scoped_lock l(d_setlock);
+
+    d_taps = taps;
+    update_branches();
 }
 
 } /* namespace pdu_utils */
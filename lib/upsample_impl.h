@@ -10,6 +10,7 @@
 #ifndef INCLUDED_PDU_UTILS_UPSAMPLE_IMPL_H
 #define INCLUDED_PDU_UTILS_UPSAMPLE_IMPL_H
 
+#include <gnuradio/filter/fir_filter.h>
 #include <gnuradio/pdu_utils/constants.h>
 #include <gnuradio/pdu_utils/upsample.h>
 
@@ -22,15 +23,31 @@ private:
     uint32_t d_n;
     bool d_repeat;
 
+    // polyphase interpolator
+    std::vector<float> d_taps;
+    std::vector<filter::kernel::fir_filter_fff> d_branches_fff;
+    std::vector<filter::kernel::fir_filter_ccf> d_branches_ccf;
+    size_t d_branch_len;
+    size_t d_first;
+    size_t d_pad;
+    std::vector<float> d_in_f;
+    std::vector<gr_complex> d_in_c;
+
+    void update_branches();
+    template <class T, class B>
+    void
+    interpolate(T* out, size_t out_len, const T* in, const std::vector<B>& branches);
     void handle_msg(pmt::pmt_t);
+    void handle_msg_taps(pmt::pmt_t meta, pmt::pmt_t v_data);
 
 public:
-    upsample_impl(uint32_t n, bool repeat);
+    upsample_impl(uint32_t n, bool repeat, const std::vector<float> taps);
 
     ~upsample_impl() override;
 
     void set_n(uint32_t n) override;
     void set_repeat(bool repeat) override;
+    void set_taps(std::vector<float> taps) override;
 };
 
 } // namespace pdu_utils
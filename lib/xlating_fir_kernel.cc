@@ -0,0 +1,123 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "xlating_fir_kernel.h"
+#include <volk/volk.h>
+
+#include <cstring>
+
+namespace gr {
+namespace pdu_utils {
+
+xlating_fir_input::xlating_fir_input()
+    // to avoid memory access issues within the filterNdec function of gnuradio
+    // pad the input at the front and back based on the volk alignment
+    : d_pad(volk_get_alignment() / sizeof(float)),
+      d_is_complex(false)
+{
+}
+
+void xlating_fir_input::load(pmt::pmt_t data, size_t group_delay)
+{
+    size_t vlen_in = pmt::length(data);
+    size_t head = d_pad + group_delay;
+    size_t buf_len = vlen_in + 2 * d_pad + 2 * group_delay;
+    size_t len;
+
+    d_is_complex = pmt::is_c32vector(data);
+    if (d_is_complex) {
+        const gr_complex* in = pmt::c32vector_elements(data, len);
+        d_in_c.assign(buf_len, gr_complex(0, 0));
+        memcpy(&d_in_c[head], in, vlen_in * sizeof(gr_complex));
+    } else {
+        const float* in = pmt::f32vector_elements(data, len);
+        d_in_f.assign(buf_len, 0);
+        memcpy(&d_in_f[head], in, vlen_in * sizeof(float));
+    }
+}
+
+xlating_fir_kernel::xlating_fir_kernel(const std::vector<float>& taps)
+    : d_fir_ccc(std::vector<gr_complex>(1, 1)),
+      d_fir_fcc(std::vector<gr_complex>(1, 1)),
+      d_loaded_phase_inc(0),
+      d_taps_loaded(false)
+{
+    set_taps(taps);
+}
+
+void xlating_fir_kernel::set_taps(const std::vector<float>& taps)
+{
+    size_t tap_len = taps.size();
+    d_proto_taps = taps;
+    d_taps_loaded = false;
+
+    if (tap_len % 2) {
+        d_group_delay_offset = (tap_len - 1) / 2;
+        d_even_num_taps = false;
+    } else {
+        d_group_delay_offset = (tap_len) / 2;
+        d_even_num_taps = true;
+    }
+}
+
+size_t xlating_fir_kernel::output_length(size_t vlen_in, int decimation) const
+{
+    size_t vlen_out(d_even_num_taps ? vlen_in + 1 : vlen_in);
+    return vlen_out / decimation;
+}
+
+void xlating_fir_kernel::load_taps(double phase_inc)
+{
+    if (d_taps_loaded && (phase_inc == d_loaded_phase_inc)) {
+        return;
+    }
+
+    /*
+     * The kernel computes out[i] = sum_j in[i*D + j] * h[N-1-j]. Rotating the input by
+     * exp(j*phase_inc*n) is the same as rotating tap h[k] by exp(j*phase_inc*(N-1-k))
+     * and multiplying output i by exp(j*phase_inc*i*D), which is done after filtering
+     */
+    size_t ntaps = d_proto_taps.size();
+    std::vector<gr_complex> ctaps(ntaps);
+    for (size_t k = 0; k < ntaps; k++) {
+        ctaps[k] = d_proto_taps[k] * exp(gr_complex(0, phase_inc * (ntaps - 1 - k)));
+    }
+    d_fir_ccc.set_taps(ctaps);
+    d_fir_fcc.set_taps(ctaps);
+
+    d_loaded_phase_inc = phase_inc;
+    d_taps_loaded = true;
+}
+
+void xlating_fir_kernel::filter(gr_complex* out,
+                                size_t n_out,
+                                const xlating_fir_input& in,
+                                int decimation,
+                                double phase_inc)
+{
+    load_taps(phase_inc);
+
+    if (in.is_complex()) {
+        d_fir_ccc.filterNdec(out, in.complex_data(), n_out, decimation);
+    } else {
+        d_fir_fcc.filterNdec(out, in.float_data(), n_out, decimation);
+    }
+
+    // residual rotation at the decimated rate, phase referenced to the first input
+    d_r.set_phase(exp(gr_complex(0, -phase_inc * d_group_delay_offset)));
+    d_r.set_phase_incr(exp(gr_complex(0, phase_inc * decimation)));
+    d_r.rotateN(out, out, n_out);
+}
+
+} /* namespace pdu_utils */
+} /* namespace gr */
@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+ * (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_PDU_UTILS_XLATING_FIR_KERNEL_H
+#define INCLUDED_PDU_UTILS_XLATING_FIR_KERNEL_H
+
+#include <gnuradio/blocks/rotator.h>
+#include <gnuradio/filter/fir_filter.h>
+#include <pmt/pmt.h>
+
+#include <vector>
+
+namespace gr {
+namespace pdu_utils {
+
+/**
+ * PDU samples copied into a zero padded scratch buffer for xlating_fir_kernel. One
+ * buffer may be filtered by several kernels sharing the same prototype taps.
+ */
+class xlating_fir_input
+{
+private:
+    std::vector<gr_complex> d_in_c;
+    std::vector<float> d_in_f;
+    size_t d_pad;
+    bool d_is_complex;
+
+public:
+    xlating_fir_input();
+
+    /**
+     * Copies a c32 or f32 vector into the scratch buffer
+     *
+     * @param data - PDU data, must be a c32vector or f32vector
+     * @param group_delay - group delay of the kernels that will filter it
+     */
+    void load(pmt::pmt_t data, size_t group_delay);
+
+    bool is_complex() const { return d_is_complex; }
+    const gr_complex* complex_data() const { return d_in_c.data() + d_pad; }
+    const float* float_data() const { return d_in_f.data() + d_pad; }
+};
+
+/**
+ * Frequency translating decimating FIR filter shared by pdu_freq_xlating_fir_filter
+ * and pdu_channelizer. Not a block; the rotated taps are cached for the last phase
+ * increment, so an instance must not be used from more than one thread at a time.
+ */
+class xlating_fir_kernel
+{
+private:
+    filter::kernel::fir_filter_ccc d_fir_ccc;
+    filter::kernel::fir_filter_fcc d_fir_fcc;
+    blocks::rotator d_r;
+    std::vector<float> d_proto_taps;
+    double d_loaded_phase_inc; // phase increment the kernel taps were built for
+    bool d_taps_loaded;
+    size_t d_group_delay_offset;
+    bool d_even_num_taps;
+
+    /**
+     * Rotates the prototype taps by phase_inc and loads them into the kernels if they
+     * are not already loaded.
+     *
+     * @param phase_inc - phase increment in radians per input sample
+     */
+    void load_taps(double phase_inc);
+
+public:
+    xlating_fir_kernel(const std::vector<float>& taps);
+
+    void set_taps(const std::vector<float>& taps);
+    size_t ntaps() const { return d_proto_taps.size(); }
+    size_t group_delay() const { return d_group_delay_offset; }
+
+    /**
+     * Even length filters are compensated with an extra output sample and a half
+     * sample start_time shift, the same as pdu_fir_filter
+     */
+    bool even_num_taps() const { return d_even_num_taps; }
+
+    /**
+     * Number of output samples for vlen_in input samples
+     */
+    size_t output_length(size_t vlen_in, int decimation) const;
+
+    /**
+     * Rotates the input by phase_inc radians per input sample, with the phase
+     * referenced to the first input sample, then filters and decimates it
+     *
+     * @param out - output buffer of n_out samples
+     * @param n_out - number of output samples, at most output_length()
+     * @param in - padded input, loaded with this kernel's group delay
+     * @param decimation - decimation factor, at least 1
+     * @param phase_inc - phase increment in radians per input sample
+     */
+    void filter(gr_complex* out,
+                size_t n_out,
+                const xlating_fir_input& in,
+                int decimation,
+                double phase_inc);
+};
+
+} // namespace pdu_utils
+} // namespace gr
+
+#endif /* INCLUDED_PDU_UTILS_XLATING_FIR_KERNEL_H */
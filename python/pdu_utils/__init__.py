@@ -20,8 +20,6 @@ except ModuleNotFoundError:
     pass
 
 # import any pure python here
-from .pdu_flow_ctrl import pdu_flow_ctrl
-from .pdu_delay import pdu_delay
 try: from .qt_pdu_source import qt_pdu_source
 except: print("QT PDU Source not available (import PyQt4 failed)")
 #
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(constants.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(e6a3383b218cac0ff6735f43209923d0)                     */
+/* BINDTOOL_HEADER_FILE_HASH(9c8390eebdc25e514d59a868793bd365)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -53,7 +53,7 @@ void bind_constants(py::module& m)
                ::gr::pdu_utils::input_type::INPUTTYPE_UNPACKED_BYTE) // 0
         .value("INPUTTYPE_PACKED_BYTE",
                ::gr::pdu_utils::input_type::INPUTTYPE_PACKED_BYTE)              // 1
-        .value("INPUTTYPE_FLOAT", ::gr::pdu_utils::input_type::INPUTTYPE_FLOAT) // 1
+        .value("INPUTTYPE_FLOAT", ::gr::pdu_utils::input_type::INPUTTYPE_FLOAT) // 2
         .export_values();
 
     py::implicitly_convertible<int, ::gr::pdu_utils::input_type>();
@@ -87,6 +87,30 @@ void bind_constants(py::module& m)
         .export_values();
 
     py::implicitly_convertible<int, ::gr::pdu_utils::window_type>();
+    py::enum_<::gr::pdu_utils::fsync_policy>(m, "fsync_policy")
+        .value("FSYNC_NEVER", ::gr::pdu_utils::fsync_policy::FSYNC_NEVER)         // 0
+        .value("FSYNC_ON_CLOSE", ::gr::pdu_utils::fsync_policy::FSYNC_ON_CLOSE)   // 1
+        .value("FSYNC_EVERY_PDU", ::gr::pdu_utils::fsync_policy::FSYNC_EVERY_PDU) // 2
+        .export_values();
+
+    py::implicitly_convertible<int, ::gr::pdu_utils::fsync_policy>();
+    py::enum_<::gr::pdu_utils::replay_mode>(m, "replay_mode")
+        .value("REPLAY_RATE", ::gr::pdu_utils::replay_mode::REPLAY_RATE)           // 0
+        .value("REPLAY_ASAP", ::gr::pdu_utils::replay_mode::REPLAY_ASAP)           // 1
+        .value("REPLAY_TIMESTAMP", ::gr::pdu_utils::replay_mode::REPLAY_TIMESTAMP) // 2
+        .export_values();
+
+    py::implicitly_convertible<int, ::gr::pdu_utils::replay_mode>();
+    py::enum_<::gr::pdu_utils::dispatch_mode>(m, "dispatch_mode")
+        .value("DISPATCH_ROUND_ROBIN",
+               ::gr::pdu_utils::dispatch_mode::DISPATCH_ROUND_ROBIN) // 0
+        .value("DISPATCH_LEAST_LOADED",
+               ::gr::pdu_utils::dispatch_mode::DISPATCH_LEAST_LOADED) // 1
+        .value("DISPATCH_SIZE_WEIGHTED",
+               ::gr::pdu_utils::dispatch_mode::DISPATCH_SIZE_WEIGHTED) // 2
+        .export_values();
+
+    py::implicitly_convertible<int, ::gr::pdu_utils::dispatch_mode>();
     py::enum_<::gr::pdu_utils::align_modes>(m, "align_modes")
         .value("ALIGN_DROP", ::gr::pdu_utils::align_modes::ALIGN_DROP)       // 0
         .value("ALIGN_FORWARD", ::gr::pdu_utils::align_modes::ALIGN_FORWARD) // 1
@@ -357,4 +381,54 @@ void bind_constants(py::module& m)
     m.def("PMTCONSTSTR__bit_index",
           &::gr::pdu_utils::PMTCONSTSTR__bit_index,
           D(PMTCONSTSTR__bit_index));
+
+
+    m.def("PMTCONSTSTR__symbol_rate_min",
+          &::gr::pdu_utils::PMTCONSTSTR__symbol_rate_min,
+          D(PMTCONSTSTR__symbol_rate_min));
+
+
+    m.def("PMTCONSTSTR__symbol_rate_max",
+          &::gr::pdu_utils::PMTCONSTSTR__symbol_rate_max,
+          D(PMTCONSTSTR__symbol_rate_max));
+
+
+    m.def("PMTCONSTSTR__demod",
+          &::gr::pdu_utils::PMTCONSTSTR__demod,
+          D(PMTCONSTSTR__demod));
+
+
+    m.def("PMTCONSTSTR__filtered",
+          &::gr::pdu_utils::PMTCONSTSTR__filtered,
+          D(PMTCONSTSTR__filtered));
+
+
+    m.def("PMTCONSTSTR__realization",
+          &::gr::pdu_utils::PMTCONSTSTR__realization,
+          D(PMTCONSTSTR__realization));
+
+
+    m.def("PMTCONSTSTR__center_frequency",
+          &::gr::pdu_utils::PMTCONSTSTR__center_frequency,
+          D(PMTCONSTSTR__center_frequency));
+
+
+    m.def("PMTCONSTSTR__channel",
+          &::gr::pdu_utils::PMTCONSTSTR__channel,
+          D(PMTCONSTSTR__channel));
+
+
+    m.def("PMTCONSTSTR__delay",
+          &::gr::pdu_utils::PMTCONSTSTR__delay,
+          D(PMTCONSTSTR__delay));
+
+
+    m.def("PMTCONSTSTR__time_in",
+          &::gr::pdu_utils::PMTCONSTSTR__time_in,
+          D(PMTCONSTSTR__time_in));
+
+
+    m.def("PMTCONSTSTR__time_out",
+          &::gr::pdu_utils::PMTCONSTSTR__time_out,
+          D(PMTCONSTSTR__time_out));
 }
@@ -172,3 +172,33 @@ static const char* __doc_gr_pdu_utils_PMTCONSTSTR__bit_reversed = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_PMTCONSTSTR__bit_index = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__symbol_rate_min = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__symbol_rate_max = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__demod = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__filtered = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__realization = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__center_frequency = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__channel = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__delay = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__time_in = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_PMTCONSTSTR__time_out = R"doc()doc";
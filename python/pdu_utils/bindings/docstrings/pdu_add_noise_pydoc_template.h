@@ -40,3 +40,9 @@ static const char* __doc_gr_pdu_utils_pdu_add_noise_set_noise_dist = R"doc()doc"
 
 
 static const char* __doc_gr_pdu_utils_pdu_add_noise_set_seed = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_add_noise_set_realizations = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_add_noise_set_fast_rng = R"doc()doc";
@@ -22,3 +22,12 @@ static const char* __doc_gr_pdu_utils_pdu_burst_combiner_pdu_burst_combiner = R"
 
 
 static const char* __doc_gr_pdu_utils_pdu_burst_combiner_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_combiner_set_timeout = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_combiner_set_max_samples = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_combiner_get_n_dropped = R"doc()doc";
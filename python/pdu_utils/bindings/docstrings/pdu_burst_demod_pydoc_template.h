@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, pdu_utils, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_pdu_burst_demod_0 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_pdu_burst_demod_1 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_set_sensitivity = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_set_remove_dc = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_set_taps = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_set_decimation = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_burst_demod_set_symbol_rate_range = R"doc()doc";
@@ -36,3 +36,7 @@ static const char* __doc_gr_pdu_utils_pdu_clock_recovery_set_gauss_sigma = R"doc
 
 
 static const char* __doc_gr_pdu_utils_pdu_clock_recovery_set_dc_reject = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_clock_recovery_set_symbol_rate_range =
+    R"doc()doc";
@@ -26,7 +26,28 @@ static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_pdu_flow_ctrl_helper_
     R"doc()doc";
 
 
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_add_port = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_resolve = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_release = R"doc()doc";
+
+
 static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_max_nmsgs = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_print_nmsgs = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_sample = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_max_high_water = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_stats = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_helper_reset_stats = R"doc()doc";
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, pdu_utils, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_pdu_flow_ctrl_0 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_pdu_flow_ctrl_1 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_set_max_nmsgs = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_set_low_watermark = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_set_backpressure = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_dropped = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_held = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_set_stats_interval = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_high_water = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_latency_p50 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_latency_p99 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_get_stats = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_flow_ctrl_reset_stats = R"doc()doc";
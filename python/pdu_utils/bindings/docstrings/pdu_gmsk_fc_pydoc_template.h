@@ -31,3 +31,6 @@ static const char* __doc_gr_pdu_utils_pdu_gmsk_fc_set_sensitivity = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_pdu_gmsk_fc_set_taps = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_gmsk_fc_set_samples_per_symbol = R"doc()doc";
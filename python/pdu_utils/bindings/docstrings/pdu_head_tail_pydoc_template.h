@@ -34,3 +34,12 @@ static const char* __doc_gr_pdu_utils_pdu_head_tail_set_histsize = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_pdu_head_tail_set_space_bytes = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_head_tail_set_bit_order = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_head_tail_set_publish_interval = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_head_tail_set_delta = R"doc()doc";
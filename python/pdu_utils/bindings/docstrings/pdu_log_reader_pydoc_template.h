@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, pdu_utils, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_record = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_pdu_log_reader = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_size = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_record = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_nitems = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_metadata = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_pdu = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_find_pdu_num = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_find_time = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_log_reader_item_size = R"doc()doc";
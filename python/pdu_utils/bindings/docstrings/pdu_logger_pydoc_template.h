@@ -25,3 +25,15 @@ static const char* __doc_gr_pdu_utils_pdu_logger_make_0 = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_pdu_logger_make_1 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_logger_get_written = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_logger_get_dropped = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_logger_get_backpressure_waits = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_logger_set_backpressure = R"doc()doc";
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, pdu_utils, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_pdu_predicate_filter_0 =
+    R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_pdu_predicate_filter_1 =
+    R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_set_expression = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_get_expressions = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_predicate_filter_get_counts = R"doc()doc";
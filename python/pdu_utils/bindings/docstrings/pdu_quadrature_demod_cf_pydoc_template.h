@@ -23,3 +23,9 @@ static const char* __doc_gr_pdu_utils_pdu_quadrature_demod_cf_pdu_quadrature_dem
 
 
 static const char* __doc_gr_pdu_utils_pdu_quadrature_demod_cf_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_quadrature_demod_cf_set_sensitivity = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_quadrature_demod_cf_set_remove_dc = R"doc()doc";
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, pdu_utils, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_pdu_resequencer_0 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_pdu_resequencer_1 = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_set_window = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_set_timeout = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_get_depth = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_get_max_depth = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_get_skipped = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_get_dropped = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_resequencer_get_stats = R"doc()doc";
@@ -22,3 +22,12 @@ static const char* __doc_gr_pdu_utils_pdu_round_robin_pdu_round_robin = R"doc()d
 
 
 static const char* __doc_gr_pdu_utils_pdu_round_robin_make = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_round_robin_set_mode = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_round_robin_get_mode = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_round_robin_get_counts = R"doc()doc";
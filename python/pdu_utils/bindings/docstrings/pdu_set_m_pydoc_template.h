@@ -49,3 +49,15 @@ static const char* __doc_gr_pdu_utils_pdu_set_m_set_v_overwrite = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_pdu_set_m_set_kv = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_set_m_pairs = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_set_m_set_pairs = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_set_m_set_merge_bytes = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_pdu_set_m_merge_bytes = R"doc()doc";
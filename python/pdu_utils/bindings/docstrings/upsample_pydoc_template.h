@@ -31,3 +31,6 @@ static const char* __doc_gr_pdu_utils_upsample_set_n = R"doc()doc";
 
 
 static const char* __doc_gr_pdu_utils_upsample_set_repeat = R"doc()doc";
+
+
+static const char* __doc_gr_pdu_utils_upsample_set_taps = R"doc()doc";
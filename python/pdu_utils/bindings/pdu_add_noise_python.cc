@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_add_noise.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(2b05892d026a8c3d900e6fcec3e06218)                     */
+/* BINDTOOL_HEADER_FILE_HASH(ae164af78c8227ac32c014f95ee552e4)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -42,6 +42,8 @@ void bind_pdu_add_noise(py::module& m)
              py::arg("scale"),
              py::arg("seed") = 12345678,
              py::arg("dist") = 0,
+             py::arg("realizations") = 1,
+             py::arg("fast_rng") = false,
              D(pdu_add_noise, make))
 
 
@@ -74,5 +76,17 @@ void bind_pdu_add_noise(py::module& m)
              py::arg("x"),
              D(pdu_add_noise, set_seed))
 
+
+        .def("set_realizations",
+             &pdu_add_noise::set_realizations,
+             py::arg("n"),
+             D(pdu_add_noise, set_realizations))
+
+
+        .def("set_fast_rng",
+             &pdu_add_noise::set_fast_rng,
+             py::arg("fast"),
+             D(pdu_add_noise, set_fast_rng))
+
         ;
 }
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_burst_combiner.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(c067a247112e206cdbd524fb59017ff4)                     */
+/* BINDTOOL_HEADER_FILE_HASH(7e8cc144f6b86e486d95c0498e00dba8)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -39,8 +39,27 @@ void bind_pdu_burst_combiner(py::module& m)
                std::shared_ptr<pdu_burst_combiner>>(
         m, "pdu_burst_combiner", D(pdu_burst_combiner))
 
-        .def(py::init(&pdu_burst_combiner::make), D(pdu_burst_combiner, make))
+        .def(py::init(&pdu_burst_combiner::make),
+             py::arg("timeout") = 0,
+             py::arg("max_samples") = 0,
+             D(pdu_burst_combiner, make))
 
 
+        .def("set_timeout",
+             &pdu_burst_combiner::set_timeout,
+             py::arg("timeout"),
+             D(pdu_burst_combiner, set_timeout))
+
+
+        .def("set_max_samples",
+             &pdu_burst_combiner::set_max_samples,
+             py::arg("max_samples"),
+             D(pdu_burst_combiner, set_max_samples))
+
+
+        .def("get_n_dropped",
+             &pdu_burst_combiner::get_n_dropped,
+             D(pdu_burst_combiner, get_n_dropped))
+
         ;
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_burst_demod.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(7f4849b083651bb584ea59f4890ed21e)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_burst_demod.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_burst_demod_pydoc.h>
+
+void bind_pdu_burst_demod(py::module& m)
+{
+
+    using pdu_burst_demod = ::gr::pdu_utils::pdu_burst_demod;
+
+
+    py::class_<pdu_burst_demod,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_burst_demod>>(
+        m, "pdu_burst_demod", D(pdu_burst_demod))
+
+        .def(py::init(&pdu_burst_demod::make),
+             py::arg("sensitivity"),
+             py::arg("taps"),
+             py::arg("decimation") = 1,
+             py::arg("remove_dc") = false,
+             py::arg("binary_slice") = true,
+             py::arg("debug") = false,
+             py::arg("type") = ::gr::pdu_utils::window_type::TUKEY_WIN,
+             py::arg("min_symbol_rate") = 0,
+             py::arg("max_symbol_rate") = 0,
+             D(pdu_burst_demod, make))
+
+
+        .def("set_sensitivity",
+             &pdu_burst_demod::set_sensitivity,
+             py::arg("sensitivity"),
+             D(pdu_burst_demod, set_sensitivity))
+
+
+        .def("set_remove_dc",
+             &pdu_burst_demod::set_remove_dc,
+             py::arg("remove_dc"),
+             D(pdu_burst_demod, set_remove_dc))
+
+
+        .def("set_taps",
+             &pdu_burst_demod::set_taps,
+             py::arg("taps"),
+             D(pdu_burst_demod, set_taps))
+
+
+        .def("set_decimation",
+             &pdu_burst_demod::set_decimation,
+             py::arg("decimation"),
+             D(pdu_burst_demod, set_decimation))
+
+
+        .def("set_symbol_rate_range",
+             &pdu_burst_demod::set_symbol_rate_range,
+             py::arg("min_symbol_rate"),
+             py::arg("max_symbol_rate"),
+             D(pdu_burst_demod, set_symbol_rate_range))
+
+        ;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_channelizer.h)                           */
+/* BINDTOOL_HEADER_FILE_HASH(0ec522e949997b255551db1dab50e880)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_channelizer.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_channelizer_pydoc.h>
+
+void bind_pdu_channelizer(py::module& m)
+{
+
+    using pdu_channelizer = ::gr::pdu_utils::pdu_channelizer;
+
+
+    py::class_<pdu_channelizer,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_channelizer>>(
+        m, "pdu_channelizer", D(pdu_channelizer))
+
+        .def(py::init(&pdu_channelizer::make),
+             py::arg("decimation"),
+             py::arg("taps"),
+             py::arg("center_freqs"),
+             D(pdu_channelizer, make))
+
+
+        .def("set_taps",
+             &pdu_channelizer::set_taps,
+             py::arg("taps"),
+             D(pdu_channelizer, set_taps))
+
+
+        .def("set_decimation",
+             &pdu_channelizer::set_decimation,
+             py::arg("decimation"),
+             D(pdu_channelizer, set_decimation))
+
+
+        .def("set_center_freqs",
+             &pdu_channelizer::set_center_freqs,
+             py::arg("center_freqs"),
+             D(pdu_channelizer, set_center_freqs))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_clock_recovery.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(6a315e7e601700a7f9c1cbcb392dc9db)                     */
+/* BINDTOOL_HEADER_FILE_HASH(1de78c355e3d9b76d8c518b5bcf4d52d)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -43,6 +43,8 @@ void bind_pdu_clock_recovery(py::module& m)
              py::arg("binary_slice"),
              py::arg("debug") = false,
              py::arg("type") = ::gr::pdu_utils::window_type::TUKEY_WIN,
+             py::arg("min_symbol_rate") = 0,
+             py::arg("max_symbol_rate") = 0,
              D(pdu_clock_recovery, make))
 
 
@@ -63,5 +65,12 @@ void bind_pdu_clock_recovery(py::module& m)
              py::arg("dc_reject"),
              D(pdu_clock_recovery, set_dc_reject))
 
+
+        .def("set_symbol_rate_range",
+             &pdu_clock_recovery::set_symbol_rate_range,
+             py::arg("min_symbol_rate"),
+             py::arg("max_symbol_rate"),
+             D(pdu_clock_recovery, set_symbol_rate_range))
+
         ;
 }
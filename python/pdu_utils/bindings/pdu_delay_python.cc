@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_delay.h)                                          */
+/* BINDTOOL_HEADER_FILE_HASH(f2ac2428429de5bcc860f87069e9876b)                     */
+/***********************************************************************************/
+
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/constants.h>
+#include <gnuradio/pdu_utils/pdu_delay.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_delay_pydoc.h>
+
+void bind_pdu_delay(py::module& m)
+{
+
+    using pdu_delay = ::gr::pdu_utils::pdu_delay;
+
+
+    py::class_<pdu_delay, gr::block, gr::basic_block, std::shared_ptr<pdu_delay>>(
+        m, "pdu_delay", D(pdu_delay))
+
+        .def(py::init(&pdu_delay::make),
+             py::arg("delay"),
+             py::arg("debug") = false,
+             D(pdu_delay, make))
+
+
+        .def("set_delay", &pdu_delay::set_delay, py::arg("delay"), D(pdu_delay, set_delay))
+
+
+        .def("get_delay", &pdu_delay::get_delay, D(pdu_delay, get_delay))
+
+
+        .def("set_debug", &pdu_delay::set_debug, py::arg("debug"), D(pdu_delay, set_debug))
+
+
+        .def("get_debug", &pdu_delay::get_debug, D(pdu_delay, get_debug))
+
+
+        .def("get_pending", &pdu_delay::get_pending, D(pdu_delay, get_pending))
+
+        // attributes of the former python block
+        .def_property_readonly("delay", &pdu_delay::get_delay)
+        .def_property_readonly("debug", &pdu_delay::get_debug)
+        .def_property_readonly(
+            "in_key", [](pdu_delay&) { return ::gr::pdu_utils::PMTCONSTSTR__time_in(); })
+        .def_property_readonly(
+            "out_key", [](pdu_delay&) { return ::gr::pdu_utils::PMTCONSTSTR__time_out(); })
+        .def_property_readonly(
+            "delay_key", [](pdu_delay&) { return ::gr::pdu_utils::PMTCONSTSTR__delay(); })
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_fine_time_measure.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(68aa3349aaeea14f717727fc1693744e)                     */
+/* BINDTOOL_HEADER_FILE_HASH(0cbd755a9b9c2b1c223ad65d940d12f2)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -44,6 +44,7 @@ void bind_pdu_fine_time_measure(py::module& m)
              py::arg("post_burst_time"),
              py::arg("average_width"),
              py::arg("buffer_percent"),
+             py::arg("trim_end") = false,
              D(pdu_fine_time_measure, make))
 
 
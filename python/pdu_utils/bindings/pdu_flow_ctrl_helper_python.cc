@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_flow_ctrl_helper.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(9ad954cbd0c298360575b91384e0453c)                     */
+/* BINDTOOL_HEADER_FILE_HASH(377e9374f76e58134ec4e83dbf4bc8d4)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -45,6 +45,19 @@ void bind_pdu_flow_ctrl_helper(py::module& m)
              D(pdu_flow_ctrl_helper, pdu_flow_ctrl_helper, 1))
 
 
+        .def("add_port",
+             &pdu_flow_ctrl_helper::add_port,
+             py::arg("block"),
+             py::arg("port"),
+             D(pdu_flow_ctrl_helper, add_port))
+
+
+        .def("resolve", &pdu_flow_ctrl_helper::resolve, D(pdu_flow_ctrl_helper, resolve))
+
+
+        .def("release", &pdu_flow_ctrl_helper::release, D(pdu_flow_ctrl_helper, release))
+
+
         .def("max_nmsgs",
              &pdu_flow_ctrl_helper::max_nmsgs,
              D(pdu_flow_ctrl_helper, max_nmsgs))
@@ -54,5 +67,21 @@ void bind_pdu_flow_ctrl_helper(py::module& m)
              &pdu_flow_ctrl_helper::print_nmsgs,
              D(pdu_flow_ctrl_helper, print_nmsgs))
 
+
+        .def("sample", &pdu_flow_ctrl_helper::sample, D(pdu_flow_ctrl_helper, sample))
+
+
+        .def("max_high_water",
+             &pdu_flow_ctrl_helper::max_high_water,
+             D(pdu_flow_ctrl_helper, max_high_water))
+
+
+        .def("stats", &pdu_flow_ctrl_helper::stats, D(pdu_flow_ctrl_helper, stats))
+
+
+        .def("reset_stats",
+             &pdu_flow_ctrl_helper::reset_stats,
+             D(pdu_flow_ctrl_helper, reset_stats))
+
         ;
 }
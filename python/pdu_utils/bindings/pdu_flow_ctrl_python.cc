@@ -0,0 +1,101 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_flow_ctrl.h)                                      */
+/* BINDTOOL_HEADER_FILE_HASH(1e73fd16d457e363028d4b79e0077c50)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_flow_ctrl.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_flow_ctrl_pydoc.h>
+
+void bind_pdu_flow_ctrl(py::module& m)
+{
+
+    using pdu_flow_ctrl = ::gr::pdu_utils::pdu_flow_ctrl;
+
+
+    py::class_<pdu_flow_ctrl,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_flow_ctrl>>(m, "pdu_flow_ctrl", D(pdu_flow_ctrl))
+
+        .def(py::init(&pdu_flow_ctrl::make),
+             py::arg("blocks"),
+             py::arg("max_nmsgs"),
+             py::arg("backpressure") = false,
+             py::arg("low_watermark") = -1,
+             py::arg("stats_interval") = 0,
+             D(pdu_flow_ctrl, make))
+
+
+        .def("set_max_nmsgs",
+             &pdu_flow_ctrl::set_max_nmsgs,
+             py::arg("max_nmsgs"),
+             D(pdu_flow_ctrl, set_max_nmsgs))
+
+
+        .def("set_low_watermark",
+             &pdu_flow_ctrl::set_low_watermark,
+             py::arg("low_watermark"),
+             D(pdu_flow_ctrl, set_low_watermark))
+
+
+        .def("set_backpressure",
+             &pdu_flow_ctrl::set_backpressure,
+             py::arg("backpressure"),
+             D(pdu_flow_ctrl, set_backpressure))
+
+
+        .def("get_dropped", &pdu_flow_ctrl::get_dropped, D(pdu_flow_ctrl, get_dropped))
+
+
+        .def("get_held", &pdu_flow_ctrl::get_held, D(pdu_flow_ctrl, get_held))
+
+
+        .def("set_stats_interval",
+             &pdu_flow_ctrl::set_stats_interval,
+             py::arg("stats_interval"),
+             D(pdu_flow_ctrl, set_stats_interval))
+
+
+        .def("get_high_water",
+             &pdu_flow_ctrl::get_high_water,
+             D(pdu_flow_ctrl, get_high_water))
+
+
+        .def("get_latency_p50",
+             &pdu_flow_ctrl::get_latency_p50,
+             D(pdu_flow_ctrl, get_latency_p50))
+
+
+        .def("get_latency_p99",
+             &pdu_flow_ctrl::get_latency_p99,
+             D(pdu_flow_ctrl, get_latency_p99))
+
+
+        .def("get_stats", &pdu_flow_ctrl::get_stats, D(pdu_flow_ctrl, get_stats))
+
+
+        .def("reset_stats", &pdu_flow_ctrl::reset_stats, D(pdu_flow_ctrl, reset_stats))
+
+        ;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_freq_xlating_fir_filter.h)                           */
+/* BINDTOOL_HEADER_FILE_HASH(a06c5f01b6f9bf5c0ab0e2719a156f98)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_freq_xlating_fir_filter.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_freq_xlating_fir_filter_pydoc.h>
+
+void bind_pdu_freq_xlating_fir_filter(py::module& m)
+{
+
+    using pdu_freq_xlating_fir_filter = ::gr::pdu_utils::pdu_freq_xlating_fir_filter;
+
+
+    py::class_<pdu_freq_xlating_fir_filter,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_freq_xlating_fir_filter>>(
+        m, "pdu_freq_xlating_fir_filter", D(pdu_freq_xlating_fir_filter))
+
+        .def(py::init(&pdu_freq_xlating_fir_filter::make),
+             py::arg("decimation"),
+             py::arg("taps"),
+             py::arg("phase_inc"),
+             D(pdu_freq_xlating_fir_filter, make))
+
+
+        .def("set_taps",
+             &pdu_freq_xlating_fir_filter::set_taps,
+             py::arg("taps"),
+             D(pdu_freq_xlating_fir_filter, set_taps))
+
+
+        .def("set_decimation",
+             &pdu_freq_xlating_fir_filter::set_decimation,
+             py::arg("decimation"),
+             D(pdu_freq_xlating_fir_filter, set_decimation))
+
+
+        .def("set_phase_inc",
+             &pdu_freq_xlating_fir_filter::set_phase_inc,
+             py::arg("phase_inc"),
+             D(pdu_freq_xlating_fir_filter, set_phase_inc))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_gmsk_fc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(092a48c5585c6af9ae32c9c7e33cfdd2)                     */
+/* BINDTOOL_HEADER_FILE_HASH(b221bb1929f7e59dd6b95be78499c9db)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -39,6 +39,7 @@ void bind_pdu_gmsk_fc(py::module& m)
         .def(py::init(&pdu_gmsk_fc::make),
              py::arg("sensitivity"),
              py::arg("taps"),
+             py::arg("samples_per_symbol") = 0,
              D(pdu_gmsk_fc, make))
 
 
@@ -51,5 +52,11 @@ void bind_pdu_gmsk_fc(py::module& m)
         .def(
             "set_taps", &pdu_gmsk_fc::set_taps, py::arg("taps"), D(pdu_gmsk_fc, set_taps))
 
+
+        .def("set_samples_per_symbol",
+             &pdu_gmsk_fc::set_samples_per_symbol,
+             py::arg("samples_per_symbol"),
+             D(pdu_gmsk_fc, set_samples_per_symbol))
+
         ;
 }
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_head_tail.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(77064d78cbbdb5f83238181d8cd7fb05)                     */
+/* BINDTOOL_HEADER_FILE_HASH(c8217ba3ad3ee636c991a1c967121899)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,6 +40,8 @@ void bind_pdu_head_tail(py::module& m)
              py::arg("pdu_type"),
              py::arg("length"),
              py::arg("histsize"),
+             py::arg("publish_interval") = 1,
+             py::arg("delta") = false,
              D(pdu_head_tail, make))
 
 
@@ -60,5 +62,23 @@ void bind_pdu_head_tail(py::module& m)
              py::arg("spacebytes"),
              D(pdu_head_tail, set_space_bytes))
 
+
+        .def("set_bit_order",
+             &pdu_head_tail::set_bit_order,
+             py::arg("order"),
+             D(pdu_head_tail, set_bit_order))
+
+
+        .def("set_publish_interval",
+             &pdu_head_tail::set_publish_interval,
+             py::arg("publish_interval"),
+             D(pdu_head_tail, set_publish_interval))
+
+
+        .def("set_delta",
+             &pdu_head_tail::set_delta,
+             py::arg("delta"),
+             D(pdu_head_tail, set_delta))
+
         ;
 }
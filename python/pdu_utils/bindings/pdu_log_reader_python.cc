@@ -0,0 +1,115 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_log_reader.h)                                              */
+/* BINDTOOL_HEADER_FILE_HASH(dc7e881b28b4d43f96a62d05ff51b03c)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_log_reader.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_log_reader_pydoc.h>
+
+void bind_pdu_log_reader(py::module& m)
+{
+
+    using pdu_log_reader = ::gr::pdu_utils::pdu_log_reader;
+    using pdu_log_record = ::gr::pdu_utils::pdu_log_record;
+
+
+    py::enum_<::gr::pdu_utils::pdu_log_dtype>(m, "pdu_log_dtype")
+        .value("PDU_LOG_C32", ::gr::pdu_utils::pdu_log_dtype::PDU_LOG_C32) // 0
+        .value("PDU_LOG_F32", ::gr::pdu_utils::pdu_log_dtype::PDU_LOG_F32) // 1
+        .value("PDU_LOG_U8", ::gr::pdu_utils::pdu_log_dtype::PDU_LOG_U8)   // 2
+        .export_values();
+
+    py::implicitly_convertible<int, ::gr::pdu_utils::pdu_log_dtype>();
+
+
+    py::class_<pdu_log_record>(m, "pdu_log_record", D(pdu_log_record))
+
+        .def_readonly_static("HAS_PDU_NUM", &pdu_log_record::HAS_PDU_NUM)
+        .def_readonly_static("HAS_TIME", &pdu_log_record::HAS_TIME)
+        .def_readonly("pdu_num", &pdu_log_record::pdu_num)
+        .def_readonly("time_sec", &pdu_log_record::time_sec)
+        .def_readonly("time_frac", &pdu_log_record::time_frac)
+        .def_readonly("data_offset", &pdu_log_record::data_offset)
+        .def_readonly("data_length", &pdu_log_record::data_length)
+        .def_readonly("meta_offset", &pdu_log_record::meta_offset)
+        .def_readonly("meta_length", &pdu_log_record::meta_length)
+        .def_readonly("dtype", &pdu_log_record::dtype)
+        .def_readonly("flags", &pdu_log_record::flags)
+
+        ;
+
+
+    py::class_<pdu_log_reader, std::shared_ptr<pdu_log_reader>>(
+        m, "pdu_log_reader", D(pdu_log_reader))
+
+        .def(py::init<std::string const&>(),
+             py::arg("filename"),
+             D(pdu_log_reader, pdu_log_reader))
+
+
+        .def("size", &pdu_log_reader::size, D(pdu_log_reader, size))
+
+
+        .def("__len__", &pdu_log_reader::size)
+
+
+        .def("record",
+             &pdu_log_reader::record,
+             py::arg("i"),
+             py::return_value_policy::copy,
+             D(pdu_log_reader, record))
+
+
+        .def("nitems", &pdu_log_reader::nitems, py::arg("i"), D(pdu_log_reader, nitems))
+
+
+        .def("metadata",
+             &pdu_log_reader::metadata,
+             py::arg("i"),
+             D(pdu_log_reader, metadata))
+
+
+        .def("pdu", &pdu_log_reader::pdu, py::arg("i"), D(pdu_log_reader, pdu))
+
+
+        .def("find_pdu_num",
+             &pdu_log_reader::find_pdu_num,
+             py::arg("pdu_num"),
+             D(pdu_log_reader, find_pdu_num))
+
+
+        .def("find_time",
+             &pdu_log_reader::find_time,
+             py::arg("sec"),
+             py::arg("frac") = 0,
+             D(pdu_log_reader, find_time))
+
+
+        .def_static("item_size",
+                    &pdu_log_reader::item_size,
+                    py::arg("dtype"),
+                    D(pdu_log_reader, item_size))
+
+        ;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_log_source.h)                                      */
+/* BINDTOOL_HEADER_FILE_HASH(19735095c62d7079282ba9978c7b3544)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_log_source.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_log_source_pydoc.h>
+
+void bind_pdu_log_source(py::module& m)
+{
+
+    using pdu_log_source = ::gr::pdu_utils::pdu_log_source;
+
+
+    py::class_<pdu_log_source,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_log_source>>(m, "pdu_log_source", D(pdu_log_source))
+
+        .def(py::init(&pdu_log_source::make),
+             py::arg("filename"),
+             py::arg("mode") = ::gr::pdu_utils::REPLAY_RATE,
+             py::arg("rate") = 1000,
+             py::arg("queue_depth") = 8,
+             py::arg("repeat") = false,
+             D(pdu_log_source, make))
+
+
+        .def("set_rate",
+             &pdu_log_source::set_rate,
+             py::arg("rate"),
+             D(pdu_log_source, set_rate))
+
+
+        .def("get_size", &pdu_log_source::get_size, D(pdu_log_source, get_size))
+
+
+        .def("get_emitted", &pdu_log_source::get_emitted, D(pdu_log_source, get_emitted))
+
+
+        .def("is_done", &pdu_log_source::is_done, D(pdu_log_source, is_done))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_logger.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(195f942e44fbcbfbd8bfeaeab32c908b)                     */
+/* BINDTOOL_HEADER_FILE_HASH(3a0b1acaf1b15b3b312a105988489608)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -35,11 +35,22 @@ void bind_pdu_logger(py::module& m)
     py::class_<pdu_logger, gr::block, gr::basic_block,
         std::shared_ptr<pdu_logger>>(m, "pdu_logger", D(pdu_logger))
 
-        .def(py::init((std::shared_ptr<gr::pdu_utils::pdu_logger>(*)(std::string,
-                                                                     uint32_t)) &
+        .def(py::init((std::shared_ptr<gr::pdu_utils::pdu_logger>(*)(
+                          std::string,
+                          uint32_t,
+                          uint32_t,
+                          bool,
+                          ::gr::pdu_utils::fsync_policy,
+                          bool,
+                          bool)) &
                       pdu_logger::make),
              py::arg("logfile"),
              py::arg("pdus_per_file"),
+             py::arg("queue_depth") = 1024,
+             py::arg("backpressure") = false,
+             py::arg("fsync") = ::gr::pdu_utils::FSYNC_NEVER,
+             py::arg("direct_io") = false,
+             py::arg("index") = false,
              D(pdu_logger, make_0))
 
         .def(py::init((std::shared_ptr<gr::pdu_utils::pdu_logger>(*)(std::string)) &
@@ -48,8 +59,21 @@ void bind_pdu_logger(py::module& m)
              D(pdu_logger, make_1))
 
 
+        .def("get_written", &pdu_logger::get_written, D(pdu_logger, get_written))
 
 
+        .def("get_dropped", &pdu_logger::get_dropped, D(pdu_logger, get_dropped))
+
+
+        .def("get_backpressure_waits",
+             &pdu_logger::get_backpressure_waits,
+             D(pdu_logger, get_backpressure_waits))
+
+
+        .def("set_backpressure",
+             &pdu_logger::set_backpressure,
+             py::arg("backpressure"),
+             D(pdu_logger, set_backpressure))
 
         ;
 }
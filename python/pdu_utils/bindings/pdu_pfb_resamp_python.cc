@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_pfb_resamp.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(f7b9083a2a9452775f2f8333e3e9a6ef)                     */
+/* BINDTOOL_HEADER_FILE_HASH(40aa63fa8673b0150fdfda2902a1bf55)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -41,8 +41,16 @@ void bind_pdu_pfb_resamp_template(py::module& m, const char* classname)
         .def(py::init(&gr::pdu_utils::pdu_pfb_resamp<T, S>::make),
              py::arg("taps"),
              py::arg("n_filters"),
-             py::arg("resamp_rate"))
-        .def("set_taps", &pdu_pfb_resamp::set_taps, py::arg("taps"));
+             py::arg("resamp_rate"),
+             py::arg("output_rate") = 0,
+             py::arg("reset_per_pdu") = false,
+             py::arg("n_threads") = 1)
+        .def("set_taps", &pdu_pfb_resamp::set_taps, py::arg("taps"))
+        .def("set_output_rate", &pdu_pfb_resamp::set_output_rate, py::arg("output_rate"))
+        .def("set_rational_tolerance",
+             &pdu_pfb_resamp::set_rational_tolerance,
+             py::arg("tolerance"))
+        .def("set_reset_per_pdu", &pdu_pfb_resamp::set_reset_per_pdu, py::arg("reset"));
 }
 
 
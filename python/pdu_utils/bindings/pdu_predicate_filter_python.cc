@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_predicate_filter.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(d66688593baa96f31b182b81ab94ccfa)                     */
+/***********************************************************************************/
+
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_predicate_filter.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_predicate_filter_pydoc.h>
+
+void bind_pdu_predicate_filter(py::module& m)
+{
+
+    using pdu_predicate_filter = ::gr::pdu_utils::pdu_predicate_filter;
+
+
+    py::class_<pdu_predicate_filter,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_predicate_filter>>(
+        m, "pdu_predicate_filter", D(pdu_predicate_filter))
+
+        .def(py::init(&pdu_predicate_filter::make),
+             py::arg("expressions"),
+             D(pdu_predicate_filter, make))
+
+
+        .def("set_expression",
+             &pdu_predicate_filter::set_expression,
+             py::arg("index"),
+             py::arg("expression"),
+             D(pdu_predicate_filter, set_expression))
+
+
+        .def("get_expressions",
+             &pdu_predicate_filter::get_expressions,
+             D(pdu_predicate_filter, get_expressions))
+
+
+        .def("get_counts",
+             &pdu_predicate_filter::get_counts,
+             D(pdu_predicate_filter, get_counts))
+
+        ;
+}
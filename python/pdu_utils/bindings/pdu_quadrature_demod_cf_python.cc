@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_quadrature_demod_cf.h) */
-/* BINDTOOL_HEADER_FILE_HASH(450dc397766c7b23cd8d7bfd4f132759)                     */
+/* BINDTOOL_HEADER_FILE_HASH(4fdefb32ba09553ddc779d03def64df0)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -41,8 +41,21 @@ void bind_pdu_quadrature_demod_cf(py::module& m)
 
         .def(py::init(&pdu_quadrature_demod_cf::make),
              py::arg("sensitivity"),
+             py::arg("remove_dc") = false,
              D(pdu_quadrature_demod_cf, make))
 
 
+        .def("set_sensitivity",
+             &pdu_quadrature_demod_cf::set_sensitivity,
+             py::arg("sensitivity"),
+             D(pdu_quadrature_demod_cf, set_sensitivity))
+
+
+        .def("set_remove_dc",
+             &pdu_quadrature_demod_cf::set_remove_dc,
+             py::arg("remove_dc"),
+             D(pdu_quadrature_demod_cf, set_remove_dc))
+
+
         ;
 }
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2022 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(pdu_resequencer.h)                                    */
+/* BINDTOOL_HEADER_FILE_HASH(68a128df8cffc6f0114cbb9acaafba6e)                     */
+/***********************************************************************************/
+
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/pdu_utils/pdu_resequencer.h>
+// pydoc.h is automatically generated in the build directory
+#include <pdu_resequencer_pydoc.h>
+
+void bind_pdu_resequencer(py::module& m)
+{
+
+    using pdu_resequencer = ::gr::pdu_utils::pdu_resequencer;
+
+
+    py::class_<pdu_resequencer,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<pdu_resequencer>>(m, "pdu_resequencer", D(pdu_resequencer))
+
+        .def(py::init(&pdu_resequencer::make),
+             py::arg("num_inputs"),
+             py::arg("key") = "pdu_num",
+             py::arg("window") = 64,
+             py::arg("timeout") = 0.1,
+             D(pdu_resequencer, make))
+
+
+        .def("set_window",
+             &pdu_resequencer::set_window,
+             py::arg("window"),
+             D(pdu_resequencer, set_window))
+
+
+        .def("set_timeout",
+             &pdu_resequencer::set_timeout,
+             py::arg("timeout"),
+             D(pdu_resequencer, set_timeout))
+
+
+        .def("get_depth", &pdu_resequencer::get_depth, D(pdu_resequencer, get_depth))
+
+
+        .def("get_max_depth",
+             &pdu_resequencer::get_max_depth,
+             D(pdu_resequencer, get_max_depth))
+
+
+        .def("get_skipped", &pdu_resequencer::get_skipped, D(pdu_resequencer, get_skipped))
+
+
+        .def("get_dropped", &pdu_resequencer::get_dropped, D(pdu_resequencer, get_dropped))
+
+
+        .def("get_stats", &pdu_resequencer::get_stats, D(pdu_resequencer, get_stats))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_round_robin.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(6d69bd9fc09a5b2d37dac8958555af60)                     */
+/* BINDTOOL_HEADER_FILE_HASH(9bcb88685c368e4a7ee266717df90858)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,8 +40,20 @@ void bind_pdu_round_robin(py::module& m)
 
         .def(py::init(&pdu_round_robin::make),
              py::arg("num_outputs"),
+             py::arg("mode") = ::gr::pdu_utils::DISPATCH_ROUND_ROBIN,
              D(pdu_round_robin, make))
 
 
+        .def("set_mode",
+             &pdu_round_robin::set_mode,
+             py::arg("mode"),
+             D(pdu_round_robin, set_mode))
+
+
+        .def("get_mode", &pdu_round_robin::get_mode, D(pdu_round_robin, get_mode))
+
+
+        .def("get_counts", &pdu_round_robin::get_counts, D(pdu_round_robin, get_counts))
+
         ;
 }
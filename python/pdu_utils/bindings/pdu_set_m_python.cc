@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_set_m.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(7995a63985015d8c45cf60bbcfe450d3)                     */
+/* BINDTOOL_HEADER_FILE_HASH(045b80c6793d9bde273f607a101abe0b)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -41,6 +41,8 @@ void bind_pdu_set_m(py::module& m)
              py::arg("v"),
              py::arg("kv_merge") = false,
              py::arg("v_overwrite") = false,
+             py::arg("pairs") = pmt::get_PMT_NIL(),
+             py::arg("merge_bytes") = false,
              D(pdu_set_m, make))
 
 
@@ -77,5 +79,20 @@ void bind_pdu_set_m(py::module& m)
              py::arg("v"),
              D(pdu_set_m, set_kv))
 
+
+        .def("pairs", &pdu_set_m::pairs, D(pdu_set_m, pairs))
+
+
+        .def("set_pairs", &pdu_set_m::set_pairs, py::arg("pairs"), D(pdu_set_m, set_pairs))
+
+
+        .def("set_merge_bytes",
+             &pdu_set_m::set_merge_bytes,
+             py::arg("merge_bytes"),
+             D(pdu_set_m, set_merge_bytes))
+
+
+        .def("merge_bytes", &pdu_set_m::merge_bytes, D(pdu_set_m, merge_bytes))
+
         ;
 }
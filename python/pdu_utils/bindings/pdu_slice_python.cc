@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(pdu_slice.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(c630a9faf1e07aca1a3310d5b3e89e20)                     */
+/* BINDTOOL_HEADER_FILE_HASH(ce62c38f847f4739836130e85028f55c)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
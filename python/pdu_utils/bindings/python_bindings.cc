@@ -38,10 +38,12 @@ void bind_pdu_complex_to_mag2(py::module& m);
 void bind_pdu_downsample(py::module& m);
 void bind_pdu_fine_time_measure(py::module& m);
 void bind_pdu_fir_filter(py::module& m);
+void bind_pdu_flow_ctrl_helper(py::module& m);
 void bind_pdu_gmsk_fc(py::module& m);
 void bind_pdu_head_tail(py::module& m);
 void bind_pdu_length_filter(py::module& m);
 void bind_pdu_logger(py::module& m);
+void bind_pdu_log_reader(py::module& m);
 void bind_pdu_pfb_resamp(py::module& m);
 void bind_pdu_preamble(py::module& m);
 void bind_pdu_quadrature_demod_cf(py::module& m);
@@ -57,6 +59,14 @@ void bind_take_skip_to_pdu(py::module& m);
 void bind_upsample(py::module& m);
 void bind_pdu_slice(py::module& m);
 void bind_access_code_to_pdu(py::module& m);
+void bind_pdu_freq_xlating_fir_filter(py::module& m);
+void bind_pdu_burst_demod(py::module& m);
+void bind_pdu_channelizer(py::module& m);
+void bind_pdu_log_source(py::module& m);
+void bind_pdu_flow_ctrl(py::module& m);
+void bind_pdu_delay(py::module& m);
+void bind_pdu_resequencer(py::module& m);
+void bind_pdu_predicate_filter(py::module& m);
 // ) END BINDING_FUNCTION_PROTOTYPES
 
 
@@ -102,10 +112,12 @@ PYBIND11_MODULE(pdu_utils_python, m)
     bind_pdu_downsample(m);
     bind_pdu_fine_time_measure(m);
     bind_pdu_fir_filter(m);
+    bind_pdu_flow_ctrl_helper(m);
     bind_pdu_gmsk_fc(m);
     bind_pdu_head_tail(m);
     bind_pdu_length_filter(m);
     bind_pdu_logger(m);
+    bind_pdu_log_reader(m);
     bind_pdu_pfb_resamp(m);
     bind_pdu_preamble(m);
     bind_pdu_quadrature_demod_cf(m);
@@ -121,5 +133,13 @@ PYBIND11_MODULE(pdu_utils_python, m)
     bind_upsample(m);
     bind_pdu_slice(m);
     bind_access_code_to_pdu(m);
+    bind_pdu_freq_xlating_fir_filter(m);
+    bind_pdu_burst_demod(m);
+    bind_pdu_channelizer(m);
+    bind_pdu_log_source(m);
+    bind_pdu_flow_ctrl(m);
+    bind_pdu_delay(m);
+    bind_pdu_resequencer(m);
+    bind_pdu_predicate_filter(m);
     // ) END BINDING_FUNCTION_CALLS
 }
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(upsample.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(d17e5f439d282ee9df7cbdddd7e5e433)                     */
+/* BINDTOOL_HEADER_FILE_HASH(937ed8d7791eee6b854f1d182964b12a)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -36,8 +36,11 @@ void bind_upsample(py::module& m)
     py::class_<upsample, gr::block, gr::basic_block, std::shared_ptr<upsample>>(
         m, "upsample", D(upsample))
 
-        .def(
-            py::init(&upsample::make), py::arg("n"), py::arg("repeat"), D(upsample, make))
+        .def(py::init(&upsample::make),
+             py::arg("n"),
+             py::arg("repeat"),
+             py::arg("taps") = std::vector<float>(),
+             D(upsample, make))
 
 
         .def("set_n", &upsample::set_n, py::arg("n"), D(upsample, set_n))
@@ -48,5 +51,8 @@ void bind_upsample(py::module& m)
              py::arg("repeat"),
              D(upsample, set_repeat))
 
+
+        .def("set_taps", &upsample::set_taps, py::arg("taps"), D(upsample, set_taps))
+
         ;
 }
@@ -82,6 +82,13 @@ class qa_extract_metadata (gr_unittest.TestCase):
         assert(pmt.eq(pdu_utils.PMTCONSTSTR__set_armed(), pmt.intern("set_armed")))
         assert(pmt.eq(pdu_utils.PMTCONSTSTR__trigger_now(), pmt.intern("trigger_now")))
         assert(pmt.eq(pdu_utils.PMTCONSTSTR__system(), pmt.intern("system")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__symbol_rate_min(), pmt.intern("symbol_rate_min")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__symbol_rate_max(), pmt.intern("symbol_rate_max")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__demod(), pmt.intern("demod")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__filtered(), pmt.intern("filtered")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__realization(), pmt.intern("realization")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__center_frequency(), pmt.intern("center_frequency")))
+        assert(pmt.eq(pdu_utils.PMTCONSTSTR__channel(), pmt.intern("channel")))
 
 
 if __name__ == '__main__':
@@ -21,6 +21,7 @@ from gnuradio import gr, gr_unittest
 from gnuradio import blocks
 import pmt
 import time
+import numpy as np
 
 class qa_pdu_add_noise (gr_unittest.TestCase):
 
@@ -145,5 +146,59 @@ class qa_pdu_add_noise (gr_unittest.TestCase):
 
         self.assertComplexTuplesAlmostEqual(out_data, expected_data, 3)
 
+    def test_005_realizations (self):
+        self.add.set_noise_level(0.1)
+        self.add.set_noise_dist(pdu_utils.GAUSSIAN)
+        self.add.set_realizations(3)
+        self.add.set_seed(123)
+
+        in_data = [0.0] * 16
+        in_pdu = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(in_data), in_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 3)
+        outputs = []
+        for k in range(3):
+            msg = self.debug.get_message(k)
+            self.assertEqual(pmt.to_long(pmt.dict_ref(pmt.car(msg), pmt.intern("realization"), pmt.PMT_NIL)), k)
+            outputs.append(pmt.f32vector_elements(pmt.cdr(msg)))
+        # each realization gets its own noise
+        self.assertNotEqual(outputs[0], outputs[1])
+        self.assertNotEqual(outputs[1], outputs[2])
+
+    def test_006_fast_rng (self):
+        n = 20000
+        in_pdu = pmt.cons(pmt.make_dict(), pmt.init_c32vector(n, [0j] * n))
+        add2 = pdu_utils.pdu_add_noise(1.0, 0, 1, 42, pdu_utils.GAUSSIAN, 1, True)
+        debug2 = blocks.message_debug()
+        self.tb.msg_connect((self.emitter, 'msg'), (add2, 'pdu_in'))
+        self.tb.msg_connect((add2, 'pdu_out'), (debug2, 'store'))
+        self.add.set_noise_level(1.0)
+        self.add.set_noise_dist(pdu_utils.GAUSSIAN)
+        self.add.set_fast_rng(True)
+        self.add.set_seed(42)
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.05)
+        self.tb.stop()
+        self.tb.wait()
+
+        # same seed, same noise
+        out1 = np.array(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0))))
+        out2 = np.array(pmt.c32vector_elements(pmt.cdr(debug2.get_message(0))))
+        self.assertTrue(np.array_equal(out1, out2))
+        # unit total power split evenly between I and Q
+        self.assertAlmostEqual(np.mean(np.abs(out1)**2), 1.0, delta=0.05)
+        self.assertAlmostEqual(np.var(out1.real), 0.5, delta=0.03)
+        self.assertAlmostEqual(np.mean(out1), 0, delta=0.03)
+
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_add_noise)
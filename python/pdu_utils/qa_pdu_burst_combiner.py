@@ -95,6 +95,76 @@ class qa_pdu_burst_combiner (gr_unittest.TestCase):
         out_data = pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0)))
         self.assertComplexTuplesAlmostEqual(out_data, expected_data)
 
+    def make_fragment(self, burst_id, x, y, data):
+        meta = pmt.dict_add(pmt.make_dict(), pmt.intern("burst_index"), pmt.cons(pmt.from_uint64(x), pmt.from_uint64(y)))
+        meta = pmt.dict_add(meta, pmt.intern("burst_id"), pmt.from_uint64(burst_id))
+        return pmt.cons(meta, pmt.init_c32vector(len(data), data))
+
+    def test_003_interleaved (self):
+        a = [[1+1j, 2], [3j], [4, 5, 6]]
+        b = [[-1], [-2j, -3]]
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(self.make_fragment(10, 1, 3, a[0]))
+        self.emitter.emit(self.make_fragment(11, 2, 2, b[1]))
+        self.emitter.emit(self.make_fragment(10, 2, 3, a[1]))
+        self.emitter.emit(self.make_fragment(11, 1, 2, b[0]))
+        self.emitter.emit(self.make_fragment(10, 3, 3, a[2]))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 2)
+        out_b = self.debug.get_message(0)
+        out_a = self.debug.get_message(1)
+        self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(out_a)), a[0] + a[1] + a[2])
+        self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(out_b)), b[0] + b[1])
+        # metadata comes from the first fragment
+        self.assertTrue(pmt.equal(pmt.dict_ref(pmt.car(out_b), pmt.intern("burst_index"), pmt.PMT_NIL),
+                                  pmt.cons(pmt.from_uint64(1), pmt.from_uint64(2))))
+        self.assertEqual(pmt.to_uint64(pmt.dict_ref(pmt.car(out_a), pmt.intern("burst_id"), pmt.PMT_NIL)), 10)
+
+    def test_004_timeout_and_limit (self):
+        self.combiner.set_timeout(0.05)
+
+        self.tb.start()
+        time.sleep(.001)
+        # first burst times out before its last fragment arrives
+        self.emitter.emit(self.make_fragment(1, 1, 2, [1, 1]))
+        time.sleep(.1)
+        self.emitter.emit(self.make_fragment(1, 2, 2, [2, 2]))
+        # second burst is dropped by the buffer limit when the third arrives
+        self.combiner.set_max_samples(5)
+        self.emitter.emit(self.make_fragment(2, 1, 2, [3, 3, 3]))
+        self.emitter.emit(self.make_fragment(3, 1, 2, [4, 4, 4]))
+        self.emitter.emit(self.make_fragment(2, 2, 2, [5]))
+        self.emitter.emit(self.make_fragment(3, 2, 2, [6]))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 1)
+        self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0))), [4, 4, 4, 6])
+
+    def test_005_timeout_without_traffic (self):
+        self.combiner.set_timeout(0.05)
+
+        self.tb.start()
+        time.sleep(.001)
+        # nothing arrives after the first fragment, it must still time out
+        self.emitter.emit(self.make_fragment(1, 1, 2, [1, 1]))
+        time.sleep(.2)
+        self.assertEqual(self.combiner.get_n_dropped(), 1)
+        # partial bursts left at stop are dropped
+        self.emitter.emit(self.make_fragment(2, 1, 2, [2, 2]))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 0)
+        self.assertEqual(self.combiner.get_n_dropped(), 2)
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_burst_combiner)
@@ -0,0 +1,151 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import time
+import numpy as np
+import pmt
+
+class qa_pdu_burst_demod(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        self.pmt_sample_rate = pmt.intern("sample_rate")
+        self.pmt_symbol_rate = pmt.intern("symbol_rate")
+
+    def tearDown(self):
+        self.tb = None
+
+    def fsk_burst(self, bits, sps, dev=0.05):
+        freq = np.repeat(bits*2-1, sps) * dev
+        return np.exp(2j*np.pi*np.cumsum(freq)).astype(np.complex64)
+
+    def test_001_chain_equivalence(self):
+        taps = [0.1, 0.2, 0.4, 0.2, 0.1]
+        emitter = pdu_utils.message_emitter()
+        fused = pdu_utils.pdu_burst_demod(1.0, taps, 2)
+        demod = pdu_utils.pdu_quadrature_demod_cf(1.0)
+        fir = pdu_utils.pdu_fir_filter(2, taps)
+        clock_rec = pdu_utils.pdu_clock_recovery(True)
+        fused_debug = blocks.message_debug()
+        chain_debug = blocks.message_debug()
+
+        self.tb.msg_connect((emitter, 'msg'), (fused, 'pdu_in'))
+        self.tb.msg_connect((fused, 'pdu_out'), (fused_debug, 'store'))
+        self.tb.msg_connect((emitter, 'msg'), (demod, 'cpdus'))
+        self.tb.msg_connect((demod, 'fpdus'), (fir, 'pdu_in'))
+        self.tb.msg_connect((fir, 'pdu_out'), (clock_rec, 'pdu_in'))
+        self.tb.msg_connect((clock_rec, 'pdu_out'), (chain_debug, 'store'))
+
+        np.random.seed(1)
+        bits = np.random.randint(0, 2, 200)
+        data = self.fsk_burst(bits, 8)
+        meta = pmt.dict_add(pmt.make_dict(), self.pmt_sample_rate, pmt.from_double(1e6))
+
+        self.tb.start()
+        time.sleep(.001)
+        emitter.emit(pmt.cons(meta, pmt.init_c32vector(len(data), data)))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(fused_debug.num_messages(), 1)
+        self.assertEqual(chain_debug.num_messages(), 1)
+        fused_out = fused_debug.get_message(0)
+        chain_out = chain_debug.get_message(0)
+        self.assertTrue(pmt.equal(pmt.cdr(fused_out), pmt.cdr(chain_out)))
+        self.assertFalse(pmt.dict_has_key(pmt.car(fused_out), self.pmt_sample_rate))
+        self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(fused_out), self.pmt_symbol_rate, pmt.PMT_NIL)),
+                               pmt.to_double(pmt.dict_ref(pmt.car(chain_out), self.pmt_symbol_rate, pmt.PMT_NIL)),
+                               delta=1.0)
+
+    def test_002_bits(self):
+        emitter = pdu_utils.message_emitter()
+        fused = pdu_utils.pdu_burst_demod(1.0, [], 1, True, True, False, pdu_utils.TUKEY_WIN, 100e3, 150e3)
+        debug = blocks.message_debug()
+        self.tb.msg_connect((emitter, 'msg'), (fused, 'pdu_in'))
+        self.tb.msg_connect((fused, 'pdu_out'), (debug, 'store'))
+
+        np.random.seed(2)
+        bits = np.random.randint(0, 2, 300)
+        # carrier offset is removed by remove_dc
+        data = self.fsk_burst(bits, 8) * np.exp(2j*np.pi*0.01*np.arange(300*8)).astype(np.complex64)
+        meta = pmt.dict_add(pmt.make_dict(), self.pmt_sample_rate, pmt.from_double(1e6))
+
+        self.tb.start()
+        time.sleep(.001)
+        emitter.emit(pmt.cons(meta, pmt.init_c32vector(len(data), data)))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(debug.num_messages(), 1)
+        result = debug.get_message(0)
+        rate = pmt.to_double(pmt.dict_ref(pmt.car(result), self.pmt_symbol_rate, pmt.PMT_NIL))
+        self.assertAlmostEqual(rate, 125e3, delta=125e3*0.001)
+        symbols = np.array(pmt.u8vector_elements(pmt.cdr(result)))
+        self.assertTrue(abs(len(symbols) - len(bits)) <= 2)
+        # the first symbol may be lost to the conjugate multiply, allow for edge symbols
+        n = min(len(symbols), len(bits)) - 1
+        errors = min(np.sum(symbols[:n] != bits[:n]), np.sum(symbols[:n] != bits[1:n+1]))
+        self.assertTrue(errors <= 2)
+
+    def test_003_debug_ports(self):
+        emitter = pdu_utils.message_emitter()
+        fused = pdu_utils.pdu_burst_demod(1.0, [0.25, 0.25, 0.25, 0.25], 2, False, False, True)
+        demod_debug = blocks.message_debug()
+        filtered_debug = blocks.message_debug()
+        out_debug = blocks.message_debug()
+        self.tb.msg_connect((emitter, 'msg'), (fused, 'pdu_in'))
+        self.tb.msg_connect((fused, 'demod'), (demod_debug, 'store'))
+        self.tb.msg_connect((fused, 'filtered'), (filtered_debug, 'store'))
+        self.tb.msg_connect((fused, 'pdu_out'), (out_debug, 'store'))
+
+        np.random.seed(3)
+        bits = np.random.randint(0, 2, 200)
+        data = self.fsk_burst(bits, 8)
+        meta = pmt.dict_add(pmt.make_dict(), self.pmt_sample_rate, pmt.from_double(1e6))
+        meta = pmt.dict_add(meta, pmt.intern("start_time"), pmt.from_double(1.0))
+
+        self.tb.start()
+        time.sleep(.001)
+        emitter.emit(pmt.cons(meta, pmt.init_c32vector(len(data), data)))
+        emitter.emit(pmt.cons(meta, pmt.init_f32vector(10, [0]*10)))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # the f32vector PDU is dropped
+        self.assertEqual(demod_debug.num_messages(), 1)
+        self.assertEqual(filtered_debug.num_messages(), 1)
+        self.assertEqual(out_debug.num_messages(), 1)
+        expected = np.angle(data[1:] * np.conj(data[:-1]))
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(demod_debug.get_message(0))), expected, 5)
+
+        # even number of taps, one extra output sample before decimation
+        filtered = filtered_debug.get_message(0)
+        self.assertEqual(pmt.length(pmt.cdr(filtered)), len(data) // 2)
+        self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(filtered), self.pmt_sample_rate, pmt.PMT_NIL)), 0.5e6)
+        self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(filtered), pmt.intern("start_time"), pmt.PMT_NIL)), 1.0 - 1e-6)
+        self.assertTrue(pmt.is_f32vector(pmt.cdr(out_debug.get_message(0))))
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_burst_demod)
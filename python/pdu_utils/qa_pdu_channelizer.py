@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import pmt
+import time
+import numpy as np
+
+
+class qa_pdu_channelizer (gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        self.emitter = pdu_utils.message_emitter()
+        self.debug = blocks.message_debug()
+
+    def connectUp(self):
+        self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
+        self.tb.msg_connect((self.dut, 'pdu_out'), (self.debug, 'store'))
+
+    def tearDown(self):
+        self.tb = None
+
+    def reference(self, data, taps, decimation, phase_inc):
+        '''
+        pdu_rotate followed by pdu_fir_filter, odd number of taps
+        '''
+        rotated = np.array(data) * np.exp(1j * phase_inc * np.arange(len(data)))
+        full = np.convolve(rotated, taps)
+        gd = (len(taps) - 1) // 2
+        return full[gd:gd + len(data)][::decimation][:len(data) // decimation]
+
+    def run_pdus(self, pdus):
+        self.tb.start()
+        time.sleep(.01)
+        for pdu in pdus:
+            self.emitter.emit(pdu)
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+    def test_001_three_channels(self):
+        '''
+        complex input, three channels, compare each against rotate then filter
+        '''
+        taps = list(np.hamming(31) / np.sum(np.hamming(31)))
+        freqs = [-200.0, 0.0, 125.0]
+        sample_rate = 1000.0
+        self.dut = pdu_utils.pdu_channelizer(4, taps, freqs)
+        self.connectUp()
+
+        np.random.seed(0)
+        i_data = list(np.random.randn(400) + 1j * np.random.randn(400))
+        i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_double(sample_rate))
+        i_meta = pmt.dict_add(i_meta, pmt.intern("center_frequency"), pmt.from_double(1e6))
+        self.run_pdus([pmt.cons(i_meta, pmt.init_c32vector(len(i_data), i_data))])
+
+        self.assertEqual(self.debug.num_messages(), len(freqs))
+        for c, f in enumerate(freqs):
+            msg = self.debug.get_message(c)
+            meta = pmt.car(msg)
+            self.assertEqual(pmt.to_uint64(pmt.dict_ref(meta, pmt.intern("channel"), pmt.PMT_NIL)), c)
+            self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(meta, pmt.intern("center_frequency"), pmt.PMT_NIL)), 1e6 + f)
+            self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(meta, pmt.intern("sample_rate"), pmt.PMT_NIL)), sample_rate / 4)
+            e_data = self.reference(i_data, taps, 4, -2 * np.pi * f / sample_rate)
+            self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(msg)), e_data, 4)
+
+    def test_002_float_tone(self):
+        '''
+        real tone, the channel at the tone frequency sees it at DC
+        '''
+        taps = list(np.hamming(21) / np.sum(np.hamming(21)))
+        self.dut = pdu_utils.pdu_channelizer(2, taps, [100.0, 300.0])
+        self.connectUp()
+
+        i_data = list(np.cos(2 * np.pi * 100.0 / 1000.0 * np.arange(400)))
+        i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_double(1000.0))
+        no_rate = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(i_data), i_data))
+        self.run_pdus([no_rate, pmt.cons(i_meta, pmt.init_f32vector(len(i_data), i_data))])
+
+        # the PDU without a sample rate is dropped
+        self.assertEqual(self.debug.num_messages(), 2)
+        on_tone = np.array(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0))))
+        off_tone = np.array(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(1))))
+        # away from the edges the tone is a constant 0.5 at DC
+        self.assertComplexTuplesAlmostEqual(on_tone[20:-20], [0.5] * (len(on_tone) - 40), 2)
+        self.assertTrue(np.max(np.abs(off_tone[20:-20])) < 0.01)
+
+    def test_003_invalid_decimation(self):
+        '''
+        decimation below 1 is rejected, the previous value is kept
+        '''
+        taps = list(np.hamming(21) / np.sum(np.hamming(21)))
+        with self.assertRaises(ValueError):
+            pdu_utils.pdu_channelizer(0, taps, [0.0])
+
+        self.dut = pdu_utils.pdu_channelizer(2, taps, [0.0])
+        self.dut.set_decimation(0)
+        self.dut.set_decimation(-3)
+        self.connectUp()
+
+        i_data = list(np.cos(0.3 * np.arange(200)))
+        i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_double(1000.0))
+        self.run_pdus([pmt.cons(i_meta, pmt.init_f32vector(len(i_data), i_data))])
+
+        self.assertEqual(self.debug.num_messages(), 1)
+        msg = self.debug.get_message(0)
+        self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(msg), pmt.intern("sample_rate"), pmt.PMT_NIL)), 500.0)
+        self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(msg)), self.reference(i_data, taps, 2, 0.0), 4)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_channelizer)
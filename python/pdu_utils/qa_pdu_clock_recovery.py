@@ -91,5 +91,50 @@ class qa_pdu_clock_recovery(gr_unittest.TestCase):
 
       self.assertTrue(True)
 
+    def test_symbol_rate_hint(self):
+      emitter = pdu_utils.message_emitter()
+      clock_rec = pdu_utils.pdu_clock_recovery(True, False, pdu_utils.TUKEY_WIN, 100e3, 150e3)
+      msg_debug = blocks.message_debug()
+
+      # make connections
+      self.tb.msg_connect((emitter,'msg'),(clock_rec,'pdu_in'))
+      self.tb.msg_connect((clock_rec,'pdu_out'),(msg_debug,'store'))
+
+      # run
+      self.tb.start()
+      time.sleep(.05)
+
+      # non-integer samples per symbol, block level hint
+      n_symbols = 400
+      sps = 7.7
+      sample_rate = 1e6
+      symbol_rate = sample_rate/sps
+      original_bits = np.random.randint(0,2,n_symbols)
+      data = np.repeat(original_bits*2-1, 8)
+      data = np.interp(np.arange(0, len(data), 8/sps), np.arange(len(data)), data)
+
+      meta = pmt.make_dict()
+      meta = pmt.dict_add(meta, self.pmt_sample_rate, pmt.from_double(sample_rate))
+      emitter.emit(pmt.cons(meta, pmt.init_f32vector(len(data), data)))
+      time.sleep(.05)
+
+      # same burst with a metadata hint that overrides the block setting
+      meta = pmt.dict_add(meta, pmt.intern("symbol_rate_min"), pmt.from_double(120e3))
+      meta = pmt.dict_add(meta, pmt.intern("symbol_rate_max"), pmt.from_double(140e3))
+      emitter.emit(pmt.cons(meta, pmt.init_f32vector(len(data), data)))
+      time.sleep(.05)
+
+      # shut down
+      self.tb.stop()
+      self.tb.wait()
+
+      self.assertEqual(msg_debug.num_messages(), 2)
+      for i in range(2):
+        result = msg_debug.get_message(i)
+        result_rate = pmt.to_double(pmt.dict_ref(pmt.car(result), self.pmt_symbol_rate, pmt.PMT_NIL))
+        result_vector = pmt.to_python(pmt.cdr(result))
+        self.assertAlmostEqual(result_rate, symbol_rate, delta=symbol_rate*0.001)
+        self.assertTrue(abs(len(result_vector) - n_symbols) <= 2)
+
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_clock_recovery)
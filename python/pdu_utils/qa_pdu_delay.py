@@ -181,5 +181,29 @@ class qa_pdu_delay(gr_unittest.TestCase):
         dti = t[1][0] - t[0][0]
         self.assertAlmostEqual(dti, self.input_delays[1]+self.input_delays[2], 2, "")
 
+    # verify that PDUs are released in order of release time, not arrival
+    def test_006_t(self):
+        self.delay.set_delay(0.05)
+        i_vec = pmt.init_u8vector(2, [0, 1])
+        delays = (0.3, 0.2, None, 0.2)
+        self.tb.start()
+        time.sleep(.001)
+        for i, d in enumerate(delays):
+            meta = pmt.dict_add(pmt.make_dict(), pmt.intern('id'), pmt.from_long(i))
+            if d is not None:
+                meta = pmt.dict_add(meta, self.delay.delay_key, pmt.from_double(d))
+            self.emitter.emit(pmt.cons(meta, i_vec))
+        time.sleep(.1)
+        self.assertEqual(self.delay.get_pending(), 3)
+        time.sleep(.25)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 4)
+        ids = [pmt.to_long(pmt.dict_ref(pmt.car(self.debug.get_message(j)),
+                                        pmt.intern('id'), pmt.PMT_NIL)) for j in range(4)]
+        # equal release times keep their arrival order
+        self.assertEqual(ids, [2, 1, 3, 0])
+
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_delay)
@@ -146,6 +146,34 @@ class qa_pdu_fine_time_measure (gr_unittest.TestCase):
 
         self.assertTrue(pmt.equal(self.debug.get_message(0), e_pdu))
 
+    def test_003_trim_end(self):
+        '''
+        Input data has extra quiet time front and rear, both are trimmed
+        '''
+        self.dut = pdu_utils.pdu_fine_time_measure(0.005, 0.005, 10, 15, True)
+        self.connectUp()
+
+        i_data = [0.1 + 0j] * 10 + [1.0 + 0j] * 980 + [0.1 + 0j] * 10
+        i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("start_time"), pmt.from_double(1.0))
+        i_meta = pmt.dict_add(i_meta, pmt.intern("sample_rate"), pmt.from_float(1000.0))
+        i_meta = pmt.dict_add(i_meta, pmt.intern("duration"), pmt.from_float(1000.0))
+        in_pdu = pmt.cons(i_meta, pmt.init_c32vector(len(i_data), i_data))
+
+        e_data = [1.0 + 0j] * 980
+        e_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_float(1000.0))
+        e_meta = pmt.dict_add(e_meta, pmt.intern("start_time"), pmt.from_double(1.01))
+        e_meta = pmt.dict_add(e_meta, pmt.intern("duration"), pmt.from_float(999.98))
+        e_pdu = pmt.cons(e_meta, pmt.init_c32vector(len(e_data), e_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertTrue(pmt.equal(self.debug.get_message(0), e_pdu))
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_fine_time_measure)
@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import time
+import pmt
+
+class qa_pdu_flow_ctrl(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        self.emitter = pdu_utils.message_emitter()
+        self.debug = blocks.message_debug()
+        # not part of the flowgraph, so messages posted to it are never handled
+        self.stalled = blocks.message_debug()
+        self.pdu = pmt.cons(pmt.make_dict(), pmt.init_u8vector(4, [1, 2, 3, 4]))
+
+    def tearDown(self):
+        self.tb = None
+
+    def stall(self, n):
+        for i in range(n):
+            self.stalled.to_basic_block()._post(pmt.intern('store'), self.pdu)
+
+    def test_001_pass_and_drop(self):
+        dut = pdu_utils.pdu_flow_ctrl([self.stalled.to_basic_block()], 3)
+        self.tb.msg_connect((self.emitter, 'msg'), (dut, 'pdu_in'))
+        self.tb.msg_connect((dut, 'pdu_out'), (self.debug, 'store'))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(self.pdu)
+        self.emitter.emit(self.pdu)
+        time.sleep(.01)
+        self.stall(3)
+        self.emitter.emit(self.pdu)
+        self.emitter.emit(self.pdu)
+        self.emitter.emit(self.pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 2)
+        self.assertEqual(dut.get_dropped(), 3)
+        self.assertEqual(dut.get_held(), 0)
+
+    def test_002_backpressure(self):
+        dut = pdu_utils.pdu_flow_ctrl([self.stalled.to_basic_block()], 3, True)
+        self.tb.msg_connect((self.emitter, 'msg'), (dut, 'pdu_in'))
+        self.tb.msg_connect((dut, 'pdu_out'), (self.debug, 'store'))
+
+        self.stall(3)
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(self.pdu)
+        self.emitter.emit(self.pdu)
+        time.sleep(.01)
+
+        # the first PDU is held and the second waits behind it
+        self.assertEqual(self.debug.num_messages(), 0)
+        self.assertEqual(dut.get_held(), 1)
+
+        # switching to drop mode releases the held PDU, the queue is still full so
+        # the next one is dropped
+        dut.set_backpressure(False)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 1)
+        self.assertEqual(dut.get_dropped(), 1)
+
+    def test_003_watch_downstream(self):
+        dut = pdu_utils.pdu_flow_ctrl([], 2)
+        self.tb.msg_connect((self.emitter, 'msg'), (dut, 'pdu_in'))
+        self.tb.msg_connect((dut, 'pdu_out'), (self.debug, 'store'))
+
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(5):
+            self.emitter.emit(self.pdu)
+            time.sleep(.002)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # message_debug keeps up, nothing is dropped
+        self.assertEqual(self.debug.num_messages(), 5)
+        self.assertEqual(dut.get_dropped(), 0)
+
+    def test_004_stats(self):
+        dut = pdu_utils.pdu_flow_ctrl([self.stalled.to_basic_block()], 10, False, -1, .005)
+        stats = blocks.message_debug()
+        self.tb.msg_connect((self.emitter, 'msg'), (dut, 'pdu_in'))
+        self.tb.msg_connect((dut, 'pdu_out'), (self.debug, 'store'))
+        self.tb.msg_connect((dut, 'stats'), (stats, 'store'))
+
+        self.stall(4)
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(3):
+            self.emitter.emit(self.pdu)
+        time.sleep(.05)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertGreater(stats.num_messages(), 1)
+        msg = stats.get_message(stats.num_messages() - 1)
+        self.assertEqual(pmt.to_uint64(pmt.dict_ref(msg, pmt.intern('dropped'), pmt.PMT_NIL)), 0)
+        latency = pmt.dict_ref(msg, pmt.intern('latency_us'), pmt.PMT_NIL)
+        self.assertEqual(pmt.to_uint64(pmt.dict_ref(latency, pmt.intern('count'), pmt.PMT_NIL)), 3)
+
+        # every input port of the watched block is reported, only 'store' is backed up
+        ports = pmt.dict_ref(msg, pmt.intern('ports'), pmt.PMT_NIL)
+        store = [pmt.nth(i, ports) for i in range(pmt.length(ports))
+                 if pmt.eq(pmt.dict_ref(pmt.nth(i, ports), pmt.intern('port'), pmt.PMT_NIL),
+                           pmt.intern('store'))]
+        self.assertEqual(len(store), 1)
+        self.assertEqual(pmt.to_long(pmt.dict_ref(store[0], pmt.intern('depth'), pmt.PMT_NIL)), 4)
+        self.assertEqual(pmt.to_long(pmt.dict_ref(store[0], pmt.intern('high_water'), pmt.PMT_NIL)), 4)
+        self.assertEqual(dut.get_high_water(), 4)
+
+        dut.reset_stats()
+        self.assertEqual(dut.get_latency_p99(), 0)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_flow_ctrl)
@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import pmt
+import time
+import numpy as np
+
+
+class qa_pdu_freq_xlating_fir_filter (gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        self.emitter = pdu_utils.message_emitter()
+        self.debug = blocks.message_debug()
+
+    def connectUp(self):
+        self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
+        self.tb.msg_connect((self.dut, 'pdu_out'), (self.debug, 'store'))
+
+    def tearDown(self):
+        self.tb = None
+
+    def reference(self, data, taps, decimation, phase_inc):
+        '''
+        pdu_rotate followed by pdu_fir_filter, odd number of taps
+        '''
+        rotated = np.array(data) * np.exp(1j * phase_inc * np.arange(len(data)))
+        full = np.convolve(rotated, taps)
+        gd = (len(taps) - 1) // 2
+        return full[gd:gd + len(data)][::decimation][:len(data) // decimation]
+
+    def run_pdus(self, pdus):
+        self.tb.start()
+        time.sleep(.01)
+        for pdu in pdus:
+            self.emitter.emit(pdu)
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+    def test_001_complex_decimate(self):
+        '''
+        complex input, decimation by 4, compare against rotate then filter
+        '''
+        taps = list(np.hamming(31) / np.sum(np.hamming(31)))
+        phase_inc = -np.pi / 5
+        self.dut = pdu_utils.pdu_freq_xlating_fir_filter(4, taps, phase_inc)
+        self.connectUp()
+
+        np.random.seed(0)
+        i_data = list(np.random.randn(400) + 1j * np.random.randn(400))
+        i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_double(1000.0))
+        self.run_pdus([pmt.cons(i_meta, pmt.init_c32vector(len(i_data), i_data))])
+
+        e_data = self.reference(i_data, taps, 4, phase_inc)
+        rcv = self.debug.get_message(0)
+        self.assertEqual(pmt.to_double(pmt.dict_ref(pmt.car(rcv), pmt.intern("sample_rate"), pmt.PMT_NIL)), 250.0)
+        self.assertComplexTuplesAlmostEqual(pmt.c32vector_elements(pmt.cdr(rcv)), e_data, 4)
+
+    def test_002_float_metadata_phase_inc(self):
+        '''
+        float input, per PDU phase_inc from metadata overrides the block setting
+        '''
+        taps = list(np.hamming(15) / np.sum(np.hamming(15)))
+        self.dut = pdu_utils.pdu_freq_xlating_fir_filter(2, taps, 0.0)
+        self.connectUp()
+
+        i_data = list(np.cos(0.3 * np.arange(200)))
+        pdus = []
+        for phase_inc in [0.0, -0.3, 0.3]:
+            i_meta = pmt.dict_add(pmt.make_dict(), pmt.intern("phase_inc"), pmt.from_double(phase_inc))
+            pdus.append(pmt.cons(i_meta, pmt.init_f32vector(len(i_data), i_data)))
+        self.run_pdus(pdus)
+
+        for i, phase_inc in enumerate([0.0, -0.3, 0.3]):
+            e_data = self.reference(i_data, taps, 2, phase_inc)
+            rcv = pmt.c32vector_elements(pmt.cdr(self.debug.get_message(i)))
+            self.assertComplexTuplesAlmostEqual(rcv, e_data, 4)
+
+    def test_003_invalid_decimation(self):
+        '''
+        decimation below 1 is rejected, the previous value is kept
+        '''
+        taps = list(np.hamming(15) / np.sum(np.hamming(15)))
+        with self.assertRaises(RuntimeError):
+            pdu_utils.pdu_freq_xlating_fir_filter(0, taps, 0.0)
+
+        self.dut = pdu_utils.pdu_freq_xlating_fir_filter(2, taps, 0.0)
+        self.dut.set_decimation(0)
+        self.dut.set_decimation(-3)
+        self.connectUp()
+
+        i_data = list(np.cos(0.3 * np.arange(200)))
+        self.run_pdus([pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(i_data), i_data))])
+
+        rcv = pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0)))
+        self.assertComplexTuplesAlmostEqual(rcv, self.reference(i_data, taps, 2, 0.0), 4)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_freq_xlating_fir_filter)
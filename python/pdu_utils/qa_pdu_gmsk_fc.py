@@ -72,6 +72,32 @@ class qa_pdu_gmsk (gr_unittest.TestCase):
         out_data = pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0)))
         self.assertComplexTuplesAlmostEqual(out_data, expected_data, 5)
 
+    def test_002_symbol_lut (self):
+        # symbol mode must match the per-sample modulator fed repeated NRZ symbols
+        emitter3 = pdu_utils.message_emitter()
+        sym_gmsk = pdu_utils.pdu_gmsk_fc(0.5, firdes.gaussian(1, 4, 0.35, 9), 4)
+        debug2 = blocks.message_debug()
+        self.tb.msg_connect((emitter3, 'msg'), (sym_gmsk, 'pdu_in'))
+        self.tb.msg_connect((sym_gmsk, 'pdu_out'), (debug2, 'store'))
+
+        symbols = [1, -1, -1, 1, 1, 1, -1, 1, -1, -1, -1, 1, 1, -1, 1, 1, 1, 1, -1, -1] * 4
+        samples = [s for s in symbols for _ in range(4)]
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter2.emit(pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(samples), samples)))
+        emitter3.emit(pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(symbols), symbols)))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(1, self.debug.num_messages())
+        self.assertEqual(1, debug2.num_messages())
+        expected_data = pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0)))
+        out_data = pmt.c32vector_elements(pmt.cdr(debug2.get_message(0)))
+        self.assertEqual(len(expected_data), len(out_data))
+        self.assertComplexTuplesAlmostEqual(out_data, expected_data, 4)
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_gmsk)
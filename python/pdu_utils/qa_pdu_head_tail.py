@@ -115,5 +115,64 @@ class qa_pdu_head_tail (gr_unittest.TestCase):
         self.assertTrue(pmt.equal(self.d_tail.get_message(4), e_tail_pdu))
 
 
+    def test_004_packed (self):
+        ht = pdu_utils.pdu_head_tail(pdu_utils.INPUTTYPE_PACKED_BYTE, 12, 2)
+        ht.set_bit_order(pdu_utils.BIT_ORDER_MSB_FIRST)
+        d_head = blocks.message_debug()
+        d_tail = blocks.message_debug()
+        self.tb.msg_connect((self.emitter, 'msg'), (ht, 'pdu_in'))
+        self.tb.msg_connect((ht, 'head'), (d_head, 'store'))
+        self.tb.msg_connect((ht, 'tail'), (d_tail, 'store'))
+
+        in_data = [0xA5, 0x0F, 0x3C]
+        short_data = [0x81]
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(len(in_data), in_data)))
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(len(short_data), short_data)))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # 10100101 00001111 00111100, MSB first
+        expected_head = [1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+                         1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0]
+        expected_tail = [1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0,
+                         0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1]
+        self.assertEqual(list(pmt.u8vector_elements(pmt.cdr(d_head.get_message(1)))), expected_head)
+        self.assertEqual(list(pmt.u8vector_elements(pmt.cdr(d_tail.get_message(1)))), expected_tail)
+
+    def test_005_float_interval_delta (self):
+        ht = pdu_utils.pdu_head_tail(pdu_utils.INPUTTYPE_FLOAT, 2, 3, 2)
+        d_head = blocks.message_debug()
+        d_tail = blocks.message_debug()
+        self.tb.msg_connect((self.emitter, 'msg'), (ht, 'pdu_in'))
+        self.tb.msg_connect((ht, 'head'), (d_head, 'store'))
+        self.tb.msg_connect((ht, 'tail'), (d_tail, 'store'))
+
+        self.tb.start()
+        time.sleep(.001)
+        for ii in range(5):
+            in_data = [ii, 0.5, 0.25, -ii]
+            self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(in_data), in_data)))
+            time.sleep(.001)
+        ht.set_delta(True)
+        ht.set_publish_interval(1)
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_f32vector(3, [7, 8, 9])))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # published after the 2nd and 4th updates, then the newest row only
+        self.assertEqual(d_head.num_messages(), 3)
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(d_head.get_message(0))), [0, 0.5, 1, 0.5])
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(d_head.get_message(1))), [1, 0.5, 2, 0.5, 3, 0.5])
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(d_tail.get_message(1))), [0.25, -1, 0.25, -2, 0.25, -3])
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(d_head.get_message(2))), [7, 8])
+        self.assertFloatTuplesAlmostEqual(pmt.f32vector_elements(pmt.cdr(d_tail.get_message(2))), [8, 9])
+
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_head_tail)
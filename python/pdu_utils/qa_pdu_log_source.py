@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import os
+import struct
+import time
+import pmt
+
+QA_LOG_DIR = '/tmp/pdu_utils-pdu_log_source-qa/'
+
+class qa_pdu_log_source(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        if not os.path.exists(QA_LOG_DIR):
+            os.mkdir(QA_LOG_DIR)
+
+    def tearDown(self):
+        self.tb = None
+        for name in os.listdir(QA_LOG_DIR):
+            os.remove(QA_LOG_DIR + name)
+        os.rmdir(QA_LOG_DIR)
+
+    def write_log(self, pdus):
+        tb = gr.top_block()
+        emitter = pdu_utils.message_emitter()
+        logger = pdu_utils.pdu_logger(QA_LOG_DIR + 'raw-', len(pdus), index=True)
+        tb.msg_connect((emitter, 'msg'), (logger, 'pdu_in'))
+        tb.start()
+        time.sleep(.001)
+        for pdu in pdus:
+            emitter.emit(pdu)
+        time.sleep(.01)
+        tb.stop()
+        tb.wait()
+
+    def make_pdus(self, n):
+        pdus = []
+        for i in range(n):
+            meta = pmt.dict_add(pmt.make_dict(), pmt.intern('pdu_num'), pmt.from_uint64(i))
+            meta = pmt.dict_add(meta, pmt.intern('burst_time'),
+                                pmt.make_tuple(pmt.from_uint64(5), pmt.from_double(i * 0.001)))
+            data = [complex(i, -i)] * (i + 1)
+            pdus.append(pmt.cons(meta, pmt.init_c32vector(len(data), data)))
+        return pdus
+
+    def run_source(self, source, duration):
+        debug = blocks.message_debug()
+        self.tb.msg_connect((source, 'pdu_out'), (debug, 'store'))
+        self.tb.start()
+        time.sleep(duration)
+        self.tb.stop()
+        self.tb.wait()
+        return [debug.get_message(i) for i in range(debug.num_messages())]
+
+    def test_001_asap(self):
+        pdus = self.make_pdus(20)
+        self.write_log(pdus)
+
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'raw-c32_0000.fc32', pdu_utils.REPLAY_ASAP)
+        out = self.run_source(source, .1)
+
+        self.assertEqual(source.get_size(), 20)
+        self.assertEqual(source.get_emitted(), 20)
+        self.assertTrue(source.is_done())
+        self.assertEqual(len(out), 20)
+        for a, b in zip(out, pdus):
+            self.assertTrue(pmt.equal(a, b))
+
+    def test_002_rate_and_timestamp(self):
+        pdus = self.make_pdus(5)
+        self.write_log(pdus)
+
+        # 5 PDUs at 20 PDUs/s take 200 ms
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'raw-c32_0000.fc32', pdu_utils.REPLAY_RATE, 20)
+        out = self.run_source(source, .1)
+        self.assertTrue(1 <= len(out) < 5)
+        self.assertFalse(source.is_done())
+
+        # recorded times span 4 ms, slowed down to 400 ms
+        self.tb = gr.top_block()
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'raw-c32_0000.fc32', pdu_utils.REPLAY_TIMESTAMP, 0.01)
+        out = self.run_source(source, .1)
+        self.assertTrue(1 <= len(out) < 5)
+
+        self.tb = gr.top_block()
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'raw-c32_0000.fc32', pdu_utils.REPLAY_TIMESTAMP, 1)
+        out = self.run_source(source, .1)
+        self.assertEqual(len(out), 5)
+
+    def test_003_stream_file_index(self):
+        # bursts within a raw u8 stream file, with no metadata file
+        with open(QA_LOG_DIR + 'stream.u8', 'wb') as f:
+            f.write(bytes(range(100)))
+        with open(QA_LOG_DIR + 'stream.u8.idx', 'wb') as f:
+            f.write(b'GRPDULOG' + struct.pack('=II16x', 1, 56))
+            for num, (offset, length) in enumerate([(10, 5), (50, 3)]):
+                f.write(struct.pack('=QQdQQQIBBH', num, 0, 0, offset, length, 0, 0,
+                                    int(pdu_utils.PDU_LOG_U8), pdu_utils.pdu_log_record.HAS_PDU_NUM, 0))
+
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'stream.u8', pdu_utils.REPLAY_ASAP, repeat=True)
+        out = self.run_source(source, .01)
+
+        self.assertFalse(source.is_done())
+        self.assertTrue(len(out) >= 2)
+        self.assertEqual(pmt.u8vector_elements(pmt.cdr(out[0])), list(range(10, 15)))
+        self.assertEqual(pmt.u8vector_elements(pmt.cdr(out[1])), list(range(50, 53)))
+        self.assertTrue(pmt.equal(pmt.car(out[0]), pmt.make_dict()))
+
+    def test_004_corrupt_metadata(self):
+        # the first record points at metadata that does not deserialize
+        with open(QA_LOG_DIR + 'stream.u8', 'wb') as f:
+            f.write(bytes(range(100)))
+        with open(QA_LOG_DIR + 'stream.u8.meta', 'wb') as f:
+            f.write(b'\xff\xff\xff\xff')
+        with open(QA_LOG_DIR + 'stream.u8.idx', 'wb') as f:
+            f.write(b'GRPDULOG' + struct.pack('=II16x', 1, 56))
+            for num, (offset, length, meta_length) in enumerate([(10, 5, 4), (50, 3, 0)]):
+                f.write(struct.pack('=QQdQQQIBBH', num, 0, 0, offset, length, 0, meta_length,
+                                    int(pdu_utils.PDU_LOG_U8), pdu_utils.pdu_log_record.HAS_PDU_NUM, 0))
+
+        source = pdu_utils.pdu_log_source(QA_LOG_DIR + 'stream.u8', pdu_utils.REPLAY_ASAP)
+        out = self.run_source(source, .05)
+
+        self.assertTrue(source.is_done())
+        self.assertEqual(source.get_emitted(), 1)
+        self.assertEqual(len(out), 1)
+        self.assertEqual(pmt.u8vector_elements(pmt.cdr(out[0])), list(range(50, 53)))
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_log_source)
@@ -22,6 +22,7 @@ from gnuradio import blocks
 import pmt
 import time
 import os
+import struct
 
 QA_LOG_DIR = '/tmp/pdu_utils-pdu_logger-qa/'
 
@@ -37,6 +38,12 @@ class qa_pdu_logger (gr_unittest.TestCase):
         self.tb = None
         os.rmdir(QA_LOG_DIR)
 
+    def read_file(self, name):
+        with open(QA_LOG_DIR + name, 'rb') as f:
+            data = f.read()
+        os.remove(QA_LOG_DIR + name)
+        return data
+
     def test_001_simplelog(self):
         self.dut = pdu_utils.pdu_logger(QA_LOG_DIR+'raw-', 1)
         self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
@@ -59,10 +66,12 @@ class qa_pdu_logger (gr_unittest.TestCase):
         self.tb.stop()
         self.tb.wait()
         
-        #TODO check contents of PDUs
-        os.remove(QA_LOG_DIR + 'raw-c32_0000.fc32')
-        os.remove(QA_LOG_DIR + 'raw-f32_0001.f32')
-        os.remove(QA_LOG_DIR + 'raw-u8_0002.u8')
+        self.assertEqual(self.dut.get_written(), 3)
+        self.assertEqual(self.dut.get_dropped(), 0)
+        self.assertEqual(self.read_file('raw-c32_0000.fc32'),
+                         struct.pack('<8f', *[v for c in in_data_c32 for v in (c.real, c.imag)]))
+        self.assertEqual(self.read_file('raw-f32_0001.f32'), struct.pack('<8f', *in_data_f32))
+        self.assertEqual(self.read_file('raw-u8_0002.u8'), bytes(in_data_u8))
 
     def test_002_badinput(self):
         self.dut = pdu_utils.pdu_logger(QA_LOG_DIR+'raw-')
@@ -81,6 +90,103 @@ class qa_pdu_logger (gr_unittest.TestCase):
         self.tb.stop()
         self.tb.wait()
 
+    def test_003_multiple_per_file(self):
+        self.dut = pdu_utils.pdu_logger(QA_LOG_DIR+'raw-', 2, 4, True, pdu_utils.FSYNC_ON_CLOSE)
+        self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
+
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(5):
+            self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(3, [i, i, i])))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # PDUs are appended until the file holds pdus_per_file of them
+        self.assertEqual(self.dut.get_written(), 5)
+        self.assertEqual(self.dut.get_dropped(), 0)
+        self.assertEqual(self.read_file('raw-u8_0000.u8'), bytes([0, 0, 0, 1, 1, 1]))
+        self.assertEqual(self.read_file('raw-u8_0001.u8'), bytes([2, 2, 2, 3, 3, 3]))
+        self.assertEqual(self.read_file('raw-u8_0002.u8'), bytes([4, 4, 4]))
+
+
+    def test_004_index(self):
+        self.dut = pdu_utils.pdu_logger(QA_LOG_DIR+'raw-', 3, index=True)
+        self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
+
+        pdus = []
+        for i in range(3):
+            meta = pmt.dict_add(pmt.make_dict(), pmt.intern('pdu_num'), pmt.from_uint64(10 + i))
+            meta = pmt.dict_add(meta, pmt.intern('burst_time'),
+                                pmt.make_tuple(pmt.from_uint64(100 + i), pmt.from_double(0.25)))
+            data = [float(i)] * (i + 2)
+            pdus.append(pmt.cons(meta, pmt.init_f32vector(len(data), data)))
+
+        self.tb.start()
+        time.sleep(.001)
+        for pdu in pdus:
+            self.emitter.emit(pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        reader = pdu_utils.pdu_log_reader(QA_LOG_DIR + 'raw-f32_0000.f32')
+        self.assertEqual(reader.size(), 3)
+        for i in range(3):
+            self.assertTrue(pmt.equal(reader.pdu(i), pdus[i]))
+            record = reader.record(i)
+            self.assertEqual(record.dtype, int(pdu_utils.PDU_LOG_F32))
+            self.assertEqual(record.data_length, 4 * (i + 2))
+            self.assertEqual(record.flags, pdu_utils.pdu_log_record.HAS_PDU_NUM | pdu_utils.pdu_log_record.HAS_TIME)
+        self.assertEqual(reader.find_pdu_num(11), 1)
+        self.assertEqual(reader.find_pdu_num(13), 3)
+        self.assertEqual(reader.find_time(101, 0.5), 2)
+        self.assertEqual(reader.find_time(0), 0)
+        reader = None
+
+        self.read_file('raw-f32_0000.f32')
+        self.read_file('raw-f32_0000.f32.idx')
+        self.read_file('raw-f32_0000.f32.meta')
+
+
+    # a burst_time that is not (uint64, double) falls back to start_time, or no time,
+    # instead of stopping the writer
+    def test_005_bad_burst_time(self):
+        self.dut = pdu_utils.pdu_logger(QA_LOG_DIR+'raw-', 3, index=True)
+        self.tb.msg_connect((self.emitter, 'msg'), (self.dut, 'pdu_in'))
+
+        bad_times = [pmt.make_tuple(pmt.intern('now'), pmt.from_double(0.25)),
+                     pmt.make_tuple(pmt.from_uint64(7), pmt.intern('later')),
+                     pmt.make_tuple(pmt.from_long(-1), pmt.from_double(0.25))]
+        pdus = []
+        for i, t in enumerate(bad_times):
+            meta = pmt.dict_add(pmt.make_dict(), pmt.intern('burst_time'), t)
+            if i == 0:
+                meta = pmt.dict_add(meta, pmt.intern('start_time'), pmt.from_double(12.5))
+            pdus.append(pmt.cons(meta, pmt.init_u8vector(2, [i, i])))
+
+        self.tb.start()
+        time.sleep(.001)
+        for pdu in pdus:
+            self.emitter.emit(pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.dut.get_written(), 3)
+        reader = pdu_utils.pdu_log_reader(QA_LOG_DIR + 'raw-u8_0000.u8')
+        self.assertEqual(reader.size(), 3)
+        record = reader.record(0)
+        self.assertEqual(record.flags, pdu_utils.pdu_log_record.HAS_TIME)
+        self.assertEqual(record.time_sec, 12)
+        self.assertAlmostEqual(record.time_frac, 0.5)
+        self.assertEqual(reader.record(1).flags, 0)
+        self.assertEqual(reader.record(2).flags, 0)
+        reader = None
+
+        self.read_file('raw-u8_0000.u8')
+        self.read_file('raw-u8_0000.u8.idx')
+        self.read_file('raw-u8_0000.u8.meta')
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_logger)
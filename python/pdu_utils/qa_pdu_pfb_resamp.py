@@ -21,6 +21,7 @@ from gnuradio import gr, gr_unittest
 from gnuradio import blocks
 import pmt
 import time
+import math
 
 
 class qa_pdu_pfb_resamp (gr_unittest.TestCase):
@@ -210,6 +211,165 @@ class qa_pdu_pfb_resamp (gr_unittest.TestCase):
 
         self.assertTrue(pmt.equal(self.debug.get_message(0), expected_pdu))
 
+    def test_009_fff_rational(self):
+        self.dut = pdu_utils.pdu_pfb_resamp_fff([1], 1, 1.5)
+        self.connectUp()
+
+        in_data = list(range(8))
+        in_meta = pmt.dict_add(pmt.make_dict(), pmt.intern('sample_rate'), pmt.from_double(1000.))
+        in_pdu = pmt.cons(in_meta, pmt.init_f32vector(len(in_data), in_data))
+
+        expected_data = [0, 0, 1, 2, 2, 3, 4, 4, 5, 6, 6, 7]
+        expected_meta = pmt.dict_add(pmt.make_dict(), pmt.intern('sample_rate'), pmt.from_double(1500.))
+        expected_pdu = pmt.cons(expected_meta, pmt.init_f32vector(len(expected_data), expected_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(1, self.debug.num_messages())
+        self.assertTrue(pmt.equal(self.debug.get_message(0), expected_pdu))
+
+    def test_010_fff_output_rate(self):
+        self.dut = pdu_utils.pdu_pfb_resamp_fff([1], 1, 1.0, 1500.)
+        self.connectUp()
+
+        in_data = [1, 2, 3, 4]
+        in_meta1 = pmt.dict_add(pmt.make_dict(), pmt.intern('sample_rate'), pmt.from_double(1000.))
+        in_meta2 = pmt.dict_add(pmt.make_dict(), pmt.intern('sample_rate'), pmt.from_double(500.))
+        in_pdu1 = pmt.cons(in_meta1, pmt.init_f32vector(len(in_data), in_data))
+        in_pdu2 = pmt.cons(in_meta2, pmt.init_f32vector(len(in_data), in_data))
+        in_pdu3 = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(in_data), in_data))
+
+        expected_meta = pmt.dict_add(pmt.make_dict(), pmt.intern('sample_rate'), pmt.from_double(1500.))
+        expected_data1 = [1, 1, 2, 3, 3, 4]
+        expected_data2 = [1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4]
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu1)
+        self.emitter.emit(in_pdu2)
+        self.emitter.emit(in_pdu3)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(3, self.debug.num_messages())
+        self.assertTrue(pmt.equal(self.debug.get_message(0),
+                                  pmt.cons(expected_meta, pmt.init_f32vector(6, expected_data1))))
+        self.assertTrue(pmt.equal(self.debug.get_message(1),
+                                  pmt.cons(expected_meta, pmt.init_f32vector(12, expected_data2))))
+        # no sample rate, falls back to the fixed rate
+        self.assertTrue(pmt.equal(self.debug.get_message(2), in_pdu3))
+
+    def test_011_fff_reset_per_pdu(self):
+        self.dut = pdu_utils.pdu_pfb_resamp_fff([1], 1, 1.5, 0, True)
+        self.connectUp()
+
+        in_data = list(range(7))
+        in_pdu = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(in_data), in_data))
+
+        expected_data = [0, 0, 1, 2, 2, 3, 4, 4, 5, 6, 6]
+        expected_pdu = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(expected_data), expected_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        # without the reset the second PDU would start on a different filter
+        self.assertEqual(2, self.debug.num_messages())
+        self.assertTrue(pmt.equal(self.debug.get_message(0), expected_pdu))
+        self.assertTrue(pmt.equal(self.debug.get_message(1), expected_pdu))
+
+    def test_012_ccf_threaded_order(self):
+        self.dut = pdu_utils.pdu_pfb_resamp_ccf([1], 1, 2.0, 0, False, 4)
+        self.connectUp()
+
+        n_pdus = 50
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(n_pdus):
+            in_data = [complex(i, -i)] * (1 + (i * 37) % 200)
+            self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_c32vector(len(in_data), in_data)))
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(n_pdus, self.debug.num_messages())
+        for i in range(n_pdus):
+            expected_data = [complex(i, -i)] * (2 * (1 + (i * 37) % 200))
+            self.assertEqual(expected_data, list(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(i)))))
+
+
+    def test_013_ccf_threaded_arbitrary(self):
+        # an irrational rate, so every PDU goes through the arbitrary rate kernel
+        rate = math.sqrt(0.5)
+        n_filters = 32
+        # hamming windowed low pass prototype
+        taps = []
+        for t in range(-4 * n_filters, 4 * n_filters + 1):
+            x = math.pi * 0.45 * t / n_filters
+            sinc = math.sin(x) / x if t else 1.0
+            taps.append(0.45 * sinc * (0.54 + 0.46 * math.cos(math.pi * t / (4 * n_filters))))
+        serial = pdu_utils.pdu_pfb_resamp_ccf(taps, n_filters, rate, 0, True, 1)
+        pool = pdu_utils.pdu_pfb_resamp_ccf(taps, n_filters, rate, 0, True, 3)
+        serial_debug = blocks.message_debug()
+        pool_debug = blocks.message_debug()
+        self.tb.msg_connect((self.emitter, 'msg'), (serial, 'pdu_in'))
+        self.tb.msg_connect((self.emitter, 'msg'), (pool, 'pdu_in'))
+        self.tb.msg_connect((serial, 'pdu_out'), (serial_debug, 'store'))
+        self.tb.msg_connect((pool, 'pdu_out'), (pool_debug, 'store'))
+
+        n_pdus = 20
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(n_pdus):
+            n = 10 + (i * 53) % 300
+            in_data = [complex(math.cos(0.1 * i * k), math.sin(0.07 * k)) for k in range(n)]
+            self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_c32vector(n, in_data)))
+        time.sleep(.2)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(n_pdus, serial_debug.num_messages())
+        self.assertEqual(n_pdus, pool_debug.num_messages())
+        for i in range(n_pdus):
+            expected = pmt.c32vector_elements(pmt.cdr(serial_debug.get_message(i)))
+            got = pmt.c32vector_elements(pmt.cdr(pool_debug.get_message(i)))
+            self.assertGreater(len(expected), 0)
+            self.assertComplexTuplesAlmostEqual(expected, got, 5)
+
+    def test_014_ccf_threaded_malformed(self):
+        with self.assertRaises(RuntimeError):
+            pdu_utils.pdu_pfb_resamp_ccf([1], 1, 0.0)
+
+        self.dut = pdu_utils.pdu_pfb_resamp_ccf([1], 1, 2.0, 1000., False, 2)
+        self.connectUp()
+
+        good = pmt.cons(pmt.make_dict(), pmt.init_c32vector(3, [1, 2j, 3]))
+        bad_rate = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.intern("fast"))
+        self.tb.start()
+        time.sleep(.001)
+        # malformed PDUs are dropped before they reach a worker thread
+        self.emitter.emit(pmt.cons(pmt.intern("NOT"), pmt.init_c32vector(1, [1])))
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.intern("PDU")))
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_c32vector(0, [])))
+        self.emitter.emit(pmt.cons(bad_rate, pmt.init_c32vector(3, [1, 2, 3])))
+        self.emitter.emit(good)
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(1, self.debug.num_messages())
+        self.assertEqual([1, 1, 2j, 2j, 3, 3], list(pmt.c32vector_elements(pmt.cdr(self.debug.get_message(0)))))
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_pfb_resamp)
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import time
+import pmt
+
+class qa_pdu_predicate_filter(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def make_pdu(self, length, **meta):
+        d = pmt.make_dict()
+        for k, v in meta.items():
+            d = pmt.dict_add(d, pmt.intern(k), pmt.to_pmt(v))
+        return pmt.cons(d, pmt.init_u8vector(length, [0] * length))
+
+    def run_filter(self, filt, pdus):
+        emitter = pdu_utils.message_emitter()
+        n = len(filt.get_expressions())
+        debugs = [blocks.message_debug() for i in range(n + 1)]
+        self.tb.msg_connect((emitter, 'msg'), (filt, 'pdu_in'))
+        for i in range(n):
+            self.tb.msg_connect((filt, 'pdu_out_' + str(i)), (debugs[i], 'store'))
+        self.tb.msg_connect((filt, 'unmatched'), (debugs[n], 'store'))
+
+        self.tb.start()
+        time.sleep(.01)
+        for pdu in pdus:
+            emitter.emit(pdu)
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+        ids = []
+        for d in debugs:
+            ids.append([pmt.to_long(pmt.dict_ref(pmt.car(d.get_message(j)),
+                                                 pmt.intern('id'), pmt.PMT_NIL))
+                        for j in range(d.num_messages())])
+        return ids
+
+    # routing to the first matching expression, with chained comparisons and
+    # missing keys
+    def test_001_route(self):
+        filt = pdu_utils.pdu_predicate_filter(['snr > 10 && 100 <= len < 2000',
+                                               "type == 'burst' || !has(snr)"])
+        pdus = [self.make_pdu(500, id=0, snr=12.5),
+                self.make_pdu(2000, id=1, snr=12.5),
+                self.make_pdu(500, id=2, snr=3, type='burst'),
+                self.make_pdu(500, id=3),
+                self.make_pdu(50, id=4, snr=20, type='noise'),
+                self.make_pdu(150, id=5, snr=11)]
+        ids = self.run_filter(filt, pdus)
+
+        self.assertEqual(ids, [[0, 5], [2, 3], [1, 4]])
+        self.assertEqual(list(filt.get_counts()), [2, 2, 2])
+
+    # arithmetic, keywords and comparisons between mismatched types
+    def test_002_expressions(self):
+        filt = pdu_utils.pdu_predicate_filter(['power - noise >= 6 and not flag',
+                                               'snr == "high"'])
+        pdus = [self.make_pdu(10, id=0, power=20, noise=12, flag=False),
+                self.make_pdu(10, id=1, power=20, noise=12, flag=True),
+                self.make_pdu(10, id=2, power=20, noise=18),
+                self.make_pdu(10, id=3, snr='high'),
+                self.make_pdu(10, id=4, snr=1)]
+        ids = self.run_filter(filt, pdus)
+
+        self.assertEqual(ids, [[0], [3], [1, 2, 4]])
+
+    # invalid expressions throw and leave the previous expression in place
+    def test_003_invalid(self):
+        with self.assertRaises(RuntimeError):
+            pdu_utils.pdu_predicate_filter(['snr > '])
+        with self.assertRaises(RuntimeError):
+            pdu_utils.pdu_predicate_filter(['(snr > 1'])
+
+        filt = pdu_utils.pdu_predicate_filter(['snr > 10'])
+        with self.assertRaises(RuntimeError):
+            filt.set_expression(0, 'snr >> 10')
+        with self.assertRaises(RuntimeError):
+            filt.set_expression(1, 'snr > 10')
+        self.assertEqual(list(filt.get_expressions()), ['snr > 10'])
+
+        filt.set_expression(0, 'len < 100')
+        pdus = [self.make_pdu(10, id=0, snr=1),
+                self.make_pdu(200, id=1, snr=20)]
+        ids = self.run_filter(filt, pdus)
+
+        self.assertEqual(ids, [[0], [1]])
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_predicate_filter)
@@ -60,6 +60,42 @@ class qa_pdu_quadrature_demod_cf(gr_unittest.TestCase):
         out_data = pmt.f32vector_elements(pmt.cdr(self.debug.get_message(1)))
         self.assertFloatTuplesAlmostEqual(out_data, expected_data, 4)
 
+    def test_002_remove_dc(self):
+        self.emitter = pdu_utils.message_emitter()
+        self.qd = pdu_utils.pdu_quadrature_demod_cf(1, True)
+        self.debug = blocks.message_debug()
+
+        self.tb.msg_connect((self.emitter, 'msg'), (self.qd, 'cpdus'))
+        self.tb.msg_connect((self.qd, 'fpdus'), (self.debug, 'store'))
+
+        # alternating phase steps of pi/2 and pi/4
+        phases = np.cumsum([0] + [PI/2, PI/4] * 1000)
+        in_data = np.exp(1j * phases).astype(np.complex64)
+        expected_data = [PI/8, -PI/8] * 1000
+        in_pdu = pmt.cons(pmt.make_dict(), pmt.init_c32vector(len(in_data), in_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        # malformed and short PDUs are dropped
+        self.emitter.emit(pmt.intern("MALFORMED PDU"))
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_f32vector(2, [1, 2])))
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_c32vector(1, [1])))
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.qd.set_remove_dc(False)
+        self.qd.set_sensitivity(2)
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(2, self.debug.num_messages())
+        out_data = pmt.f32vector_elements(pmt.cdr(self.debug.get_message(0)))
+        self.assertFloatTuplesAlmostEqual(out_data, expected_data, 4)
+        out_data = pmt.f32vector_elements(pmt.cdr(self.debug.get_message(1)))
+        self.assertFloatTuplesAlmostEqual(out_data, [PI, PI/2] * 1000, 4)
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_quadrature_demod_cf)
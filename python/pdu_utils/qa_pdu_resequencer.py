@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2026 National Technology & Engineering Solutions of Sandia, LLC
+# (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+# retains certain rights in this software.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+  from gnuradio import pdu_utils
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from gnuradio import pdu_utils
+
+import time
+import pmt
+
+class qa_pdu_resequencer(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+        self.emitters = [pdu_utils.message_emitter(), pdu_utils.message_emitter()]
+        self.debug = blocks.message_debug()
+
+    def tearDown(self):
+        self.tb = None
+
+    def connect(self, dut):
+        for i in range(2):
+            self.tb.msg_connect((self.emitters[i], 'msg'), (dut, 'pdu_in_{}'.format(i)))
+        self.tb.msg_connect((dut, 'pdu_out'), (self.debug, 'store'))
+
+    def pdu(self, n, key='pdu_num'):
+        meta = pmt.dict_add(pmt.make_dict(), pmt.intern(key), pmt.from_uint64(n))
+        return pmt.cons(meta, pmt.init_u8vector(1, [n]))
+
+    def received(self):
+        return [pmt.to_uint64(pmt.dict_ref(pmt.car(self.debug.get_message(i)),
+                                           pmt.intern('pdu_num'), pmt.PMT_NIL))
+                for i in range(self.debug.num_messages())]
+
+    def test_001_reorder(self):
+        dut = pdu_utils.pdu_resequencer(2, 'pdu_num', 64, .05)
+        self.connect(dut)
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [1, 0, 3, 2, 5, 4]:
+            self.emitters[n % 2].emit(self.pdu(n))
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.received(), [0, 1, 2, 3, 4, 5])
+        self.assertEqual(dut.get_skipped(), 0)
+        self.assertEqual(dut.get_max_depth(), 6)
+
+    def test_002_gap_timeout(self):
+        dut = pdu_utils.pdu_resequencer(2, 'pdu_num', 64, .05)
+        self.connect(dut)
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [0, 1, 3, 4]:
+            self.emitters[n % 2].emit(self.pdu(n))
+        time.sleep(.2)
+        # too late, 2 was skipped
+        self.emitters[0].emit(self.pdu(2))
+        self.emitters[1].emit(self.pdu(5))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.received(), [0, 1, 3, 4, 5])
+        self.assertEqual(dut.get_skipped(), 1)
+        self.assertEqual(dut.get_dropped(), 1)
+        self.assertEqual(dut.get_depth(), 0)
+
+    def test_003_window(self):
+        dut = pdu_utils.pdu_resequencer(2, 'seq', 2, 0)
+        self.connect(dut)
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [5, 7, 8, 9]:
+            self.emitters[n % 2].emit(self.pdu(n, 'seq'))
+        # no sequence number
+        self.emitters[0].emit(self.pdu(10))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        received = [pmt.to_uint64(pmt.dict_ref(pmt.car(self.debug.get_message(i)),
+                                               pmt.intern('seq'), pmt.PMT_NIL))
+                    for i in range(self.debug.num_messages())]
+        self.assertEqual(received, [5, 7, 8, 9])
+        self.assertEqual(dut.get_skipped(), 1)
+        self.assertEqual(dut.get_dropped(), 1)
+        stats = dut.get_stats()
+        self.assertEqual(pmt.to_uint64(pmt.dict_ref(stats, pmt.intern('released'), pmt.PMT_NIL)), 4)
+
+    def test_004_restart(self):
+        dut = pdu_utils.pdu_resequencer(2, 'pdu_num', 64, .05)
+        self.connect(dut)
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [5, 6, 7]:
+            self.emitters[n % 2].emit(self.pdu(n))
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+        self.assertEqual(self.received(), [5, 6, 7])
+
+        # the sequence numbers start over, nothing is dropped as already released
+        self.tb.start()
+        time.sleep(.001)
+        for n in [1, 0, 2]:
+            self.emitters[n % 2].emit(self.pdu(n))
+        time.sleep(.1)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.received(), [5, 6, 7, 0, 1, 2])
+        self.assertEqual(dut.get_dropped(), 0)
+        self.assertEqual(dut.get_skipped(), 0)
+        self.assertEqual(dut.get_max_depth(), 3)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_pdu_resequencer)
@@ -67,6 +67,101 @@ class qa_pdu_round_robin (gr_unittest.TestCase):
         
         assert(msg_count == num_msgs)
 
+    def stalled_worker(self, out):
+        # a backpressured flow controller watching a block that never runs is a
+        # worker that stops handling messages after the first one
+        stalled = blocks.message_debug()
+        for i in range(3):
+            stalled.to_basic_block()._post(pmt.intern('store'), pmt.PMT_NIL)
+        worker = pdu_utils.pdu_flow_ctrl([stalled.to_basic_block()], 3, True)
+        self.tb.msg_connect((self.pdu_round_robin, "pdu_out_{}".format(out)), (worker, "pdu_in"))
+        self.tb.msg_connect((worker, "pdu_out"), (self.debug[out], "store"))
+        return stalled
+
+    def test_002_least_loaded(self):
+        self.tb = gr.top_block()
+        self.pdu_round_robin = pdu_utils.pdu_round_robin(2, pdu_utils.DISPATCH_LEAST_LOADED)
+        self.tb.msg_connect((self.emitter, "msg"), (self.pdu_round_robin, "pdu_in"))
+        self.tb.msg_connect((self.pdu_round_robin, "pdu_out_1"), (self.debug[1], "store"))
+        stalled = self.stalled_worker(0)
+
+        self.tb.start()
+        time.sleep(.001)
+        for i in range(6):
+          self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(4, [0, 1, 2, 3])))
+          time.sleep(.005)
+        time.sleep(.01)
+
+        # the first PDU is held by the stalled worker, the next one that ties waits
+        # behind it and everything after that goes to the free output
+        self.assertEqual(list(self.pdu_round_robin.get_counts()), [2, 4])
+        self.assertEqual(self.debug[1].num_messages(), 4)
+        self.tb.stop()
+        self.tb.wait()
+
+    def test_003_size_weighted(self):
+        self.tb = gr.top_block()
+        self.pdu_round_robin = pdu_utils.pdu_round_robin(2, pdu_utils.DISPATCH_SIZE_WEIGHTED)
+        self.tb.msg_connect((self.emitter, "msg"), (self.pdu_round_robin, "pdu_in"))
+        stalled = [self.stalled_worker(0), self.stalled_worker(1)]
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [100, 10, 100, 10, 10, 10, 10, 10]:
+          self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(n, [0] * n)))
+          time.sleep(.005)
+        time.sleep(.01)
+
+        # each worker holds its first PDU with an empty queue, so after two dispatches
+        # that PDU no longer counts and the second 100 item PDU goes to output 0 in
+        # turn. It waits in output 0's queue, so the small ones all go to output 1
+        self.assertEqual(list(self.pdu_round_robin.get_counts()), [2, 6])
+        self.tb.stop()
+        self.tb.wait()
+
+    def test_004_size_weighted_in_flight(self):
+        self.tb = gr.top_block()
+        self.pdu_round_robin = pdu_utils.pdu_round_robin(2, pdu_utils.DISPATCH_SIZE_WEIGHTED)
+        self.tb.msg_connect((self.emitter, "msg"), (self.pdu_round_robin, "pdu_in"))
+        self.tb.msg_connect((self.pdu_round_robin, "pdu_out_1"), (self.debug[1], "store"))
+        stalled = self.stalled_worker(0)
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [1000, 10, 10, 10, 10, 10]:
+          self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(n, [0] * n)))
+          time.sleep(.005)
+        time.sleep(.01)
+
+        # output 0 is busy with the large PDU even though its queue is empty, so the
+        # next small PDU goes to output 1. Once both queues have been seen empty twice
+        # the outputs tie, and the PDU then waiting in output 0's queue keeps the rest
+        # on output 1
+        self.assertEqual(list(self.pdu_round_robin.get_counts()), [2, 4])
+        self.assertEqual(self.debug[1].num_messages(), 4)
+        self.tb.stop()
+        self.tb.wait()
+
+    def test_005_size_weighted_idle(self):
+        self.tb = gr.top_block()
+        self.pdu_round_robin = pdu_utils.pdu_round_robin(2, pdu_utils.DISPATCH_SIZE_WEIGHTED)
+        self.tb.msg_connect((self.emitter, "msg"), (self.pdu_round_robin, "pdu_in"))
+        for i in range(2):
+          self.tb.msg_connect((self.pdu_round_robin, "pdu_out_{}".format(i)), (self.debug[i], "store"))
+
+        self.tb.start()
+        time.sleep(.001)
+        for n in [1000, 10, 10, 10, 10, 10]:
+          self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_u8vector(n, [0] * n)))
+          time.sleep(.005)
+        time.sleep(.01)
+
+        # both outputs finish each PDU before the next arrives, so the large PDU output
+        # 0 handled first is forgotten and the outputs take turns
+        self.assertEqual(list(self.pdu_round_robin.get_counts()), [3, 3])
+        self.tb.stop()
+        self.tb.wait()
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_round_robin, "qa_pdu_round_robin.xml")
@@ -111,5 +111,63 @@ class qa_pdu_set_m (gr_unittest.TestCase):
         print("expected = ",expected_pdu)
         self.assertTrue(pmt.equal(self.debug.get_message(0), expected_pdu))
 
+    def test_004_pairs (self):
+        in_data = [0, 0, 0, 0]
+        in_meta = pmt.dict_add(pmt.make_dict(), pmt.intern('num'), pmt.from_long(4))
+        in_meta = pmt.dict_add(in_meta, pmt.intern('name'), pmt.intern('rx'))
+        pairs = pmt.dict_add(pmt.make_dict(), pmt.intern('id'), pmt.intern('{name}-{num}'))
+        pairs = pmt.dict_add(pairs, pmt.intern('plain'), pmt.intern('no_braces'))
+        pairs = pmt.dict_add(pairs, pmt.intern('name'), pmt.intern('tx'))
+        pairs = pmt.dict_add(pairs, pmt.intern('bad'), pmt.intern('x}{y'))
+        in_pdu = pmt.cons(in_meta, pmt.init_u8vector(len(in_data), in_data))
+
+        self.set.set_v_overwrite(False)
+        self.set.set_kv(pmt.intern('n'), pmt.intern('{num}'))
+        self.set.set_kv_merge(True)
+        self.set.set_pairs(pairs)
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 1)
+        out_meta = pmt.car(self.debug.get_message(0))
+        self.assertTrue(pmt.equal(pmt.dict_ref(out_meta, pmt.intern('n'), pmt.PMT_NIL), pmt.intern('4')))
+        self.assertTrue(pmt.equal(pmt.dict_ref(out_meta, pmt.intern('id'), pmt.PMT_NIL), pmt.intern('rx-4')))
+        self.assertTrue(pmt.equal(pmt.dict_ref(out_meta, pmt.intern('plain'), pmt.PMT_NIL), pmt.intern('no_braces')))
+        # 'name' is already present and overwrite is disabled, 'bad' does not parse
+        self.assertTrue(pmt.equal(pmt.dict_ref(out_meta, pmt.intern('name'), pmt.PMT_NIL), pmt.intern('rx')))
+        self.assertFalse(pmt.dict_has_key(out_meta, pmt.intern('bad')))
+        self.assertTrue(pmt.equal(self.set.pairs(), pairs))
+
+    # with merge_bytes, templated values are u8vectors and constant values stay symbols
+    def test_005_merge_bytes (self):
+        in_meta = pmt.dict_add(pmt.make_dict(), pmt.intern('num'), pmt.from_long(4))
+        in_pdu = pmt.cons(in_meta, pmt.init_u8vector(2, [0, 0]))
+        pairs = pmt.dict_add(pmt.make_dict(), pmt.intern('plain'), pmt.intern('no_braces'))
+
+        self.set.set_kv(pmt.intern('id'), pmt.intern('rx-{num}'))
+        self.set.set_kv_merge(True)
+        self.set.set_pairs(pairs)
+        self.set.set_merge_bytes(True)
+        self.assertTrue(self.set.merge_bytes())
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_pdu)
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 1)
+        out_meta = pmt.car(self.debug.get_message(0))
+        out_id = pmt.dict_ref(out_meta, pmt.intern('id'), pmt.PMT_NIL)
+        self.assertTrue(pmt.is_u8vector(out_id))
+        self.assertEqual(bytes(pmt.u8vector_elements(out_id)), b'rx-4')
+        self.assertTrue(pmt.equal(pmt.dict_ref(out_meta, pmt.intern('plain'), pmt.PMT_NIL), pmt.intern('no_braces')))
+
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_set_m)
@@ -293,6 +293,47 @@ class qa_pdu_slice(gr_unittest.TestCase):
         print
 
         self.assertTrue(pmt.equal(self.debug.get_message(0), e_pdu))
+    # Time metadata and reparsing tests
+    def test_025_t(self):
+        self.slice = pdu_utils.pdu_slice('[2:8:2]')
+        self.connectUp()
+        i_vec = pmt.init_u8vector(10, [0, 1, 2, 3, 4, 5, 6, 7, 8, 9])
+        meta = pmt.dict_add(pmt.make_dict(), pmt.intern("sample_rate"), pmt.from_double(100.0))
+        meta = pmt.dict_add(meta, pmt.intern("start_time"), pmt.from_double(1.0))
+        meta = pmt.dict_add(meta, pmt.intern("duration"), pmt.from_float(0.1))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(meta, i_vec))
+        time.sleep(.001)
+        self.slice.set_slice('[::-1]')
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(meta, i_vec))
+        time.sleep(.001)
+        # stride from the previous slice must not carry over
+        self.slice.set_slice('[7:]')
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(meta, i_vec))
+        time.sleep(.01)
+        self.tb.stop()
+        self.tb.wait()
+
+        self.assertEqual(self.debug.num_messages(), 3)
+        expected = [([2, 4, 6], 1.02, 0.06), ([9, 8, 7, 6, 5, 4, 3, 2, 1, 0], 1.0, 0.1), ([7, 8, 9], 1.07, 0.03)]
+        for ii, (data, start_time, duration) in enumerate(expected):
+            msg = self.debug.get_message(ii)
+            self.assertEqual(list(pmt.u8vector_elements(pmt.cdr(msg))), data)
+            self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(msg), pmt.intern("start_time"), pmt.PMT_NIL)), start_time)
+            self.assertAlmostEqual(pmt.to_double(pmt.dict_ref(pmt.car(msg), pmt.intern("duration"), pmt.PMT_NIL)), duration, 6)
+
+    def test_026_t(self):
+        # out of range start with a negative stride is empty, as in python
+        self.slice = pdu_utils.pdu_slice('[-17::-5]')
+        self.connectUp()
+        i_vec = pmt.init_u8vector(10, [0, 1, 2, 3, 4, 5, 6, 7, 8, 9])
+        e_vec = pmt.init_u8vector(0, [])
+        self.runTest(i_vec, e_vec)
+
 
 if __name__ == '__main__':
     gr_unittest.run(qa_pdu_slice)
@@ -140,8 +140,72 @@ class qa_upsample (gr_unittest.TestCase):
         self.assertTrue(pmt.equal(self.debug.get_message(0), expected_pdu))
         self.assertTrue(pmt.equal(self.debug.get_message(1), expected_pdu))
 
+    def interp_ref(self, in_data, n, taps, repeat):
+        # upsample then filter with group delay compensation, as pdu_fir_filter does
+        if repeat:
+            z = [x for x in in_data for _ in range(n)]
+        else:
+            z = [0] * (len(in_data) * n)
+            z[::n] = in_data
+        full = [0] * (len(z) + len(taps) - 1)
+        for i, x in enumerate(z):
+            for j, h in enumerate(taps):
+                full[i + j] += x * h
+        first = (len(taps) - 1) // 2
+        return full[first:first + len(z)]
+
+    def test_005_taps (self):
+        taps = [1, 2, 3, 4, 5, 4, 3, 2, 1]
+        self.upsample.set_taps(taps)
 
+        in_data = [0, 1, 2, 4, 8, 16, 32]
+        in_f32 = pmt.cons(pmt.make_dict(), pmt.init_f32vector(len(in_data), in_data))
+        in_c32 = pmt.cons(pmt.make_dict(), pmt.init_c32vector(len(in_data), [complex(x, -x) for x in in_data]))
+        in_u8 = pmt.cons(pmt.make_dict(), pmt.init_u8vector(len(in_data), in_data))
+        in_s32 = pmt.cons(pmt.make_dict(), pmt.init_s32vector(len(in_data), in_data))
+
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(in_f32)
+        self.emitter.emit(in_c32)
+        self.emitter.emit(in_u8)
+        # not supported by the interpolator
+        self.emitter.emit(in_s32)
+        time.sleep(.001)
+        self.upsample.set_repeat(True)
+        time.sleep(.001)
+        self.emitter.emit(in_f32)
+        time.sleep(.05)
+        self.tb.stop()
+        self.tb.wait()
+
+        expected = self.interp_ref(in_data, 4, taps, False)
+        self.assertEqual(4, self.debug.num_messages())
+        self.assertFloatTuplesAlmostEqual(expected, pmt.f32vector_elements(pmt.cdr(self.debug.get_message(0))))
+        self.assertComplexTuplesAlmostEqual([complex(x, -x) for x in expected],
+                                            pmt.c32vector_elements(pmt.cdr(self.debug.get_message(1))))
+        self.assertFloatTuplesAlmostEqual(expected, pmt.f32vector_elements(pmt.cdr(self.debug.get_message(2))))
+        self.assertFloatTuplesAlmostEqual(self.interp_ref(in_data, 4, taps, True),
+                                          pmt.f32vector_elements(pmt.cdr(self.debug.get_message(3))))
+
+
+    def test_006_s64_c64 (self):
+        self.upsample.set_n(2)
+        self.upsample.set_repeat(True)
+
+        in_s64 = [-5, 0, 1 << 40]
+        in_c64 = [1+2j, -3j]
+        self.tb.start()
+        time.sleep(.001)
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_s64vector(len(in_s64), in_s64)))
+        self.emitter.emit(pmt.cons(pmt.make_dict(), pmt.init_c64vector(len(in_c64), in_c64)))
+        time.sleep(.05)
+        self.tb.stop()
+        self.tb.wait()
 
+        self.assertEqual(2, self.debug.num_messages())
+        self.assertEqual([-5, -5, 0, 0, 1 << 40, 1 << 40], list(pmt.s64vector_elements(pmt.cdr(self.debug.get_message(0)))))
+        self.assertComplexTuplesAlmostEqual([1+2j, 1+2j, -3j, -3j], pmt.c64vector_elements(pmt.cdr(self.debug.get_message(1))))
 
 if __name__ == '__main__':
     gr_unittest.run(qa_upsample)